@@ -59,6 +59,7 @@ if [ "$#" -ge 1 ]; then
       rm -rf `find test -name "*.png"`
       rm -rf `find test -name "*.h5"`
       rm -rf src/.cccc
+      rm -rf bench
       printf "done\n"
       rm -rf test/out.scons
    fi
@@ -72,9 +73,12 @@ if [ "$#" -ge 1 ]; then
       target="test"
       proc=1
       k_switch="-k"
+   elif [ "$1" == "bench" ]; then
+      target="bench"
+      k_switch="-k"
    elif [ "$1" == "help" ]; then
       echo
-      echo "Usage: $0 [clean|compile|test]"
+      echo "Usage: $0 [clean|compile|test|bench]"
       echo
       echo "       $0 bin/enzo-p"
       echo
@@ -201,6 +205,12 @@ if [ $target == "test" ]; then
 
 fi
 
+# BENCHMARKS
+
+if [ $target == "bench" ]; then
+   ./tools/bench.sh bench
+fi
+
 if [ x$CELLO_ARCH == "xncsa-bw" ]; then
     echo "Relinking with static libpng15.a..."
     build_dir="build"
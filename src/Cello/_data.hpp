@@ -55,6 +55,22 @@ extern void png_array (const char * filename,
 #define PMIN_64 -4611686018427387904
 #define PMAX_64  4611686018427387904
 
+//----------------------------------------------------------------------
+// Enums
+//----------------------------------------------------------------------
+
+/// @enum history_type
+/// @brief How old values of a permanent field are saved for history
+enum history_type {
+  /// No history is saved for the field
+  history_none,
+  /// Current values are copied to history by save_history()
+  history_copy,
+  /// The method updating the field writes new values to a separate
+  /// buffer, and swap_history() exchanges buffers without copying
+  history_swap
+};
+
 //----------------------------------------------------------------------
 // Component class includes
 //----------------------------------------------------------------------
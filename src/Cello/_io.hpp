@@ -12,6 +12,7 @@
 // System includes
 //----------------------------------------------------------------------
 
+#include <functional>
 #include <limits>
 #include <boost/filesystem.hpp>
 #include "pngwriter.h"
@@ -31,6 +32,7 @@ enum meta_type {
 
 #include "io_Colormap.hpp"
 #include "io_ColormapRGB.hpp"
+#include "io_ImageEncoder.hpp"
 
 #include "io_Io.hpp"
 #include "io_IoBlock.hpp"
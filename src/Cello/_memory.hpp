@@ -16,12 +16,15 @@
 
 #include <stack>
 #include <memory>
+#include <vector>
+#include <algorithm>
 
 //----------------------------------------------------------------------
 // Component class includes
 //----------------------------------------------------------------------
 
 #include "memory_Memory.hpp"
+#include "memory_Scratch.hpp"
 
 #endif /* _MEMORY_HPP */
 
@@ -94,6 +94,7 @@ enum adapt_type {
 #include <string>
 #include <sstream>
 #include <vector>
+#include <algorithm>
 #include <memory>
 
 //----------------------------------------------------------------------
@@ -37,6 +37,7 @@ extern const char * parameter_type_name [];
 #include <string>
 #include <vector>
 #include <limits>
+#include <algorithm>
 
 //----------------------------------------------------------------------
 // Component class includes
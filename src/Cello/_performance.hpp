@@ -18,6 +18,7 @@
 #include <string>
 #include <sstream>
 #include <sys/resource.h>
+#include <time.h>
 
 #ifdef __linux__
 #   include <unistd.h>
@@ -35,6 +36,7 @@
 #include "performance_Papi.hpp"
 #endif
 #include "performance_Performance.hpp"
+#include "performance_Timeline.hpp"
 
 
 #endif /* _PERFORMANCE_HPP */
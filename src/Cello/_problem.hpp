@@ -49,6 +49,7 @@ extern void method_close_files_mutex_init();
 
 #include "problem_Refresh.hpp"
 #include "problem_Mask.hpp"
+#include "problem_MaskBitmap.hpp"
 #include "problem_MaskExpr.hpp"
 #include "problem_MaskPng.hpp"
 #include "problem_ScalarExpr.hpp"
@@ -13,6 +13,7 @@
 //----------------------------------------------------------------------
 
 #include <string.h>
+#include <algorithm>
 
 //----------------------------------------------------------------------
 // Component class includes
@@ -20,6 +21,7 @@
 
 #include "performance_Timer.hpp"
 #include "test_Unit.hpp"
+#include "test_Bench.hpp"
 
 #endif /* _TEST_HPP */
 
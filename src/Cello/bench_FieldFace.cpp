@@ -0,0 +1,94 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     bench_FieldFace.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-19
+/// @brief    Benchmark FieldFace loading and storing of ghost zones
+
+#include "main.hpp"
+#include "test.hpp"
+
+#include "data.hpp"
+
+//----------------------------------------------------------------------
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  bench_init("bench_FieldFace");
+
+  bench_class("FieldFace");
+
+  const int num_fields = 8;
+  const int mx=32, my=32, mz=32;
+  const int g = 4;
+
+  FieldDescr * field_descr = new FieldDescr;
+
+  std::vector<int> field_list;
+  for (int i_f=0; i_f<num_fields; i_f++) {
+    char name[20];
+    snprintf (name,20,"field_%d",i_f);
+    const int id = field_descr->insert_permanent(name);
+    field_descr->set_precision(id, precision_double);
+    field_descr->set_ghost_depth(id, g,g,g);
+    field_list.push_back(id);
+  }
+
+  FieldData * field_data = new FieldData (field_descr, mx, my, mz);
+  field_data->allocate_permanent(field_descr,true);
+
+  Field field (field_descr,field_data);
+
+  for (int i_f=0; i_f<num_fields; i_f++) {
+    double * values = (double *) field.values(i_f);
+    const int m = (mx+2*g)*(my+2*g)*(mz+2*g);
+    for (int i=0; i<m; i++) values[i] = i_f + 0.001*i;
+  }
+
+  Refresh refresh;
+  refresh.set_field_list(field_list);
+
+  // faces along each axis, then an edge and a corner
+
+  const int num_faces = 5;
+  const int face3[num_faces][3] =
+    { {1,0,0}, {0,1,0}, {0,0,1}, {1,1,0}, {1,1,1} };
+  const char * face_name[num_faces] =
+    { "face x", "face y", "face z", "edge xy", "corner" };
+
+  for (int k=0; k<num_faces; k++) {
+
+    FieldFace field_face (field);
+
+    field_face.set_refresh_type(refresh_same);
+    field_face.set_ghost(true,true,true);
+    field_face.set_face(face3[k][0],face3[k][1],face3[k][2]);
+    field_face.set_refresh(&refresh,false);
+
+    const int n = field_face.num_bytes_array(field);
+    std::vector<char> array(n);
+    const int64_t num_elements = n / sizeof(double);
+
+    char name[80];
+
+    snprintf (name,80,"face_to_array %s",face_name[k]);
+    bench_measure (name, num_elements, n, [&] ()
+		   { field_face.face_to_array(field,array.data()); });
+
+    snprintf (name,80,"array_to_face %s",face_name[k]);
+    bench_measure (name, num_elements, n, [&] ()
+		   { field_face.array_to_face(array.data(),field); });
+  }
+
+  delete field_data;
+  delete field_descr;
+
+  bench_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
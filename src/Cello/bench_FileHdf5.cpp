@@ -0,0 +1,65 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     bench_FileHdf5.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-19
+/// @brief    Benchmark writing Block fields using FileHdf5
+
+#include "main.hpp"
+#include "test.hpp"
+#include "disk.hpp"
+
+//----------------------------------------------------------------------
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  bench_init("bench_FileHdf5");
+
+  bench_class("FileHdf5");
+
+  // eight 32^3 fields with ghost depth 4, writing only active values
+
+  const int num_fields = 8;
+  const int nx = 32, ny = 32, nz = 32;
+  const int g = 4;
+  const int mx = nx+2*g, my = ny+2*g, mz = nz+2*g;
+  const int m = mx*my*mz;
+  const int64_t n = int64_t(num_fields)*nx*ny*nz;
+
+  std::vector<double> values(m);
+  for (int i=0; i<m; i++) values[i] = 1.0 + 0.001*i;
+
+  for (int compress=0; compress<=1; compress++) {
+
+    char name[80];
+    snprintf (name,80,"write 8 fields 32^3 compress %d",compress);
+
+    bench_measure (name, n, n*sizeof(double), [&] ()
+    {
+      FileHdf5 file ("./","bench_FileHdf5.h5");
+      if (compress) file.set_compress(1);
+      file.file_create();
+      for (int i_f=0; i_f<num_fields; i_f++) {
+	char field_name[20];
+	snprintf (field_name,20,"field_%d",i_f);
+	file.mem_create (mx,my,mz,nx,ny,nz,g,g,g);
+	file.data_create (field_name,type_double,nx,ny,nz,1);
+	file.data_write (values.data());
+	file.data_close ();
+	file.mem_close ();
+      }
+      file.file_close();
+    });
+  }
+
+  unlink ("bench_FileHdf5.h5");
+
+  bench_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
@@ -0,0 +1,76 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     bench_Parameters.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-19
+/// @brief    Benchmark evaluation of floating-point parameter expressions
+
+#include <fstream>
+
+#include "main.hpp"
+#include "test.hpp"
+
+#include "parameters.hpp"
+
+//----------------------------------------------------------------------
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  bench_init("bench_Parameters");
+
+  bench_class("Param");
+
+  std::fstream fp;
+  fp.open ("bench_Parameters.in",std::fstream::out);
+  fp << "Bench {\n";
+  fp << "  linear     = 1.0*x + 2.0*y - 5.0*z + t;\n";
+  fp << "  polynomial = 1.0 + x*(2.0 + y*(3.0 + z*(4.0 + t)));\n";
+  fp << "  function   = sin(x)*cos(y) + exp(-z*z) + sqrt(x*x + y*y + 1.0);\n";
+  fp << "}\n";
+  fp.close();
+
+  Parameters * parameters = new Parameters;
+  parameters->read("bench_Parameters.in");
+
+  // one 32^3 block of cell positions
+
+  const int nx = 32, ny = 32, nz = 32;
+  const int n = nx*ny*nz;
+
+  std::vector<double> x(n), y(n), z(n), values(n), deflts(n,0.0);
+  for (int iz=0; iz<nz; iz++) {
+    for (int iy=0; iy<ny; iy++) {
+      for (int ix=0; ix<nx; ix++) {
+	const int i = ix + nx*(iy + ny*iz);
+	x[i] = (ix + 0.5) / nx;
+	y[i] = (iy + 0.5) / ny;
+	z[i] = (iz + 0.5) / nz;
+      }
+    }
+  }
+  const double t = 0.5;
+
+  const int num_expr = 3;
+  const char * expr[num_expr] = { "linear", "polynomial", "function" };
+
+  for (int k=0; k<num_expr; k++) {
+    const std::string parameter = std::string("Bench:") + expr[k];
+    char name[80];
+    snprintf (name,80,"evaluate_float %s",expr[k]);
+    bench_measure (name, n, int64_t(n)*sizeof(double), [&] ()
+		   { parameters->evaluate_float
+		       (parameter,n,values.data(),deflts.data(),
+			x.data(),y.data(),z.data(),t); });
+  }
+
+  delete parameters;
+
+  bench_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
@@ -0,0 +1,116 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     bench_Particle.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-19
+/// @brief    Benchmark ParticleData insert, delete, scatter, and compress
+///
+/// Each kernel starts from empty ParticleData, so all but the first
+/// include the cost of inserting the particles.
+
+#include "main.hpp"
+#include "test.hpp"
+
+#include "data.hpp"
+
+//----------------------------------------------------------------------
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  bench_init("bench_Particle");
+
+  bench_class("ParticleData");
+
+  const int num_particles = 100000;
+  const int num_neighbors = 27;
+
+  ParticleDescr * particle_descr = new ParticleDescr;
+  particle_descr->set_batch_size (1024);
+
+  ParticleData * particle_data = new ParticleData;
+  Particle particle (particle_descr, particle_data);
+
+  const int it = particle.new_type ("dark");
+  particle.new_attribute (it, "position_x", type_double);
+  particle.new_attribute (it, "position_y", type_double);
+  particle.new_attribute (it, "position_z", type_double);
+  particle.new_attribute (it, "velocity_x", type_double);
+  particle.new_attribute (it, "velocity_y", type_double);
+  particle.new_attribute (it, "velocity_z", type_double);
+  particle.new_attribute (it, "mass",       type_double);
+
+  const int mb = particle_descr->batch_size();
+  const int64_t bytes = int64_t(num_particles)*
+    particle_descr->particle_bytes(it);
+
+  // delete every other particle; scatter round-robin to neighbors
+
+  bool * mask = new bool [mb];
+  std::vector<int> index(mb);
+  for (int ip=0; ip<mb; ip++) {
+    mask[ip]  = (ip % 2 == 0);
+    index[ip] = ip % num_neighbors;
+  }
+
+  bench_measure ("insert_particles", num_particles, bytes, [&] ()
+  {
+    ParticleData data;
+    data.allocate(particle_descr);
+    data.insert_particles (particle_descr,it,num_particles);
+  });
+
+  bench_measure ("delete_particles half", num_particles, bytes, [&] ()
+  {
+    ParticleData data;
+    data.allocate(particle_descr);
+    data.insert_particles (particle_descr,it,num_particles);
+    const int nb = data.num_batches(it);
+    for (int ib=0; ib<nb; ib++) {
+      data.delete_particles (particle_descr,it,ib,mask);
+    }
+  });
+
+  bench_measure ("compress", num_particles, bytes, [&] ()
+  {
+    ParticleData data;
+    data.allocate(particle_descr);
+    data.insert_particles (particle_descr,it,num_particles);
+    const int nb = data.num_batches(it);
+    for (int ib=0; ib<nb; ib++) {
+      data.delete_particles (particle_descr,it,ib,mask);
+    }
+    data.compress (particle_descr,it);
+  });
+
+  bench_measure ("scatter 27", num_particles, bytes, [&] ()
+  {
+    ParticleData data;
+    data.allocate(particle_descr);
+    data.insert_particles (particle_descr,it,num_particles);
+    std::vector<ParticleData> neighbor_data(num_neighbors);
+    std::vector<ParticleData *> neighbors(num_neighbors);
+    for (int k=0; k<num_neighbors; k++) {
+      neighbor_data[k].allocate(particle_descr);
+      neighbors[k] = &neighbor_data[k];
+    }
+    const int nb = data.num_batches(it);
+    for (int ib=0; ib<nb; ib++) {
+      const int np = data.num_particles(particle_descr,it,ib);
+      data.scatter (particle_descr,it,ib,np,NULL,index.data(),
+		    num_neighbors,neighbors.data());
+    }
+  });
+
+  delete [] mask;
+  delete particle_data;
+  delete particle_descr;
+
+  bench_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
@@ -0,0 +1,76 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     bench_ProlongRestrict.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-19
+/// @brief    Benchmark ProlongLinear and RestrictLinear kernels
+
+#include "main.hpp"
+#include "test.hpp"
+#include <math.h>
+#include "mesh.hpp"
+
+//----------------------------------------------------------------------
+
+template <class T>
+void bench_kernels (int rank)
+{
+  const precision_type precision =
+    (sizeof(T) == sizeof(float)) ? precision_single : precision_double;
+
+  // fine block of 32^rank cells from a coarse block with ghosts
+
+  int mf3[3]={1,1,1}, of3[3]={0,0,0}, nf3[3]={1,1,1};
+  int mc3[3]={1,1,1}, oc3[3]={0,0,0}, nc3[3]={1,1,1};
+  int nr3[3]={1,1,1};
+  for (int a=0; a<rank; a++) {
+    nf3[a] = 32;  mf3[a] = nf3[a] + 8; of3[a] = 4;
+    nc3[a] = 18;  mc3[a] = nc3[a] + 4; oc3[a] = 2;
+    nr3[a] = nf3[a] / 2;
+  }
+  const int mf = mf3[0]*mf3[1]*mf3[2];
+  const int mc = mc3[0]*mc3[1]*mc3[2];
+  const int nf = nf3[0]*nf3[1]*nf3[2];
+  const int nr = nr3[0]*nr3[1]*nr3[2];
+
+  std::vector<T> c(mc), f(mf);
+  for (int i=0; i<mc; i++) c[i] = 1.0 + (i % 17)*0.125 + sin(i);
+  for (int i=0; i<mf; i++) f[i] = 1.0 + (i % 13)*0.25 + cos(i);
+
+  ProlongLinear prolong;
+  RestrictLinear restrict;
+
+  const char * type = (precision == precision_single) ? "float" : "double";
+  char name[80];
+
+  snprintf (name,80,"ProlongLinear %s rank %d",type,rank);
+  bench_measure (name, nf, int64_t(nf)*sizeof(T), [&] ()
+		 { prolong.apply (precision,&f[0],mf3,of3,nf3,
+				  &c[0],mc3,oc3,nc3); });
+
+  snprintf (name,80,"RestrictLinear %s rank %d",type,rank);
+  bench_measure (name, nr, int64_t(nr)*sizeof(T), [&] ()
+		 { restrict.apply (precision,&c[0],mc3,oc3,nr3,
+				   &f[0],mf3,of3,nf3); });
+}
+
+//----------------------------------------------------------------------
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  bench_init("bench_ProlongRestrict");
+
+  for (int rank=1; rank<=3; rank++) {
+    bench_kernels<float>  (rank);
+    bench_kernels<double> (rank);
+  }
+
+  bench_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
@@ -18,14 +18,18 @@ CkReductionMsg * r_reduce_performance(int n, CkReductionMsg ** msgs)
   std::vector<long long> accum;
   ASSERT1 ("r_reduce_performance",
 	   "Sanity check failed on expected accumulator array %d",
-	   length, (length < 500));
-  accum.resize(length);
-  accum.clear();
+	   length, (length < 10000));
+  accum.resize(length,0);
 
   // save length
   accum [0] = num_sum;
   accum [1] = num_max;
 
+  // initialize maximums (values may be negated to compute minimums)
+  for (int j=2+num_sum; j<length; j++) {
+    accum[j] = std::numeric_limits<long long>::min();
+  }
+
   // sum remaining values
   for (int i=0; i<n; i++) {
     ASSERT4("r_reduce_performance()",
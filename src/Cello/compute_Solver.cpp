@@ -43,7 +43,8 @@ Solver::Solver (std::string name,
   max_level_(max_level),
   id_sync_(0),
   solve_type_(solve_type),
-  ir_post_(-1)
+  ir_post_(-1),
+  face_child_()
 {
   FieldDescr * field_descr = cello::field_descr();
   ix_ = field_descr->field_id(field_x);
@@ -66,7 +67,8 @@ Solver::Solver () throw()
   max_level_(std::numeric_limits<int>::max()),
   id_sync_(0),
   solve_type_(solve_leaf),
-  ir_post_(-1)
+  ir_post_(-1),
+  face_child_()
 {
   ir_post_ = add_new_refresh_();
   cello::refresh(ir_post_)->set_callback(CkIndex_Block::p_refresh_exit());
@@ -74,6 +76,23 @@ Solver::Solver () throw()
 
 //----------------------------------------------------------------------
 
+Solver::~Solver() throw()
+{
+  clear_face_child();
+}
+
+//----------------------------------------------------------------------
+
+void Solver::clear_face_child() throw()
+{
+  for (auto it=face_child_.begin(); it!=face_child_.end(); ++it) {
+    delete it->second;
+  }
+  face_child_.clear();
+}
+
+//----------------------------------------------------------------------
+
 int Solver::add_new_refresh_ ()
 {
   // set Solver::ir_post_
@@ -130,6 +149,35 @@ bool Solver::reuse_solution_ (int cycle) const throw()
 
 //----------------------------------------------------------------------
 
+FieldFace * Solver::field_face_child_
+(int index_field, int refresh_type, const int ic3[3]) throw()
+{
+  const bool is_fine = (refresh_type == refresh_fine);
+  const int key =
+    8*(2*index_field + (is_fine ? 1 : 0)) + ic3[0] + 2*(ic3[1] + 2*ic3[2]);
+
+  auto it = face_child_.find(key);
+  if (it != face_child_.end()) return it->second;
+
+  // Include ghost zones when prolonging
+
+  Refresh * refresh = new Refresh;
+  refresh->add_field(index_field);
+
+  FieldFace * field_face = new FieldFace;
+  field_face->set_refresh_type (refresh_type);
+  field_face->set_child (ic3[0],ic3[1],ic3[2]);
+  field_face->set_face (0,0,0);
+  field_face->set_ghost (is_fine,is_fine,is_fine);
+  field_face->set_refresh (refresh,true);
+
+  face_child_[key] = field_face;
+
+  return field_face;
+}
+
+//----------------------------------------------------------------------
+
 void Solver::begin_(Block * block)
 {
 #ifdef TRACE_SOLVER  
@@ -11,6 +11,7 @@
 #include <cstring>
 
 class Refresh;
+class FieldFace;
 class Solver : public PUP::able 
 {
   /// @class    Solver
@@ -47,12 +48,15 @@ public: // interface
     max_level_(  std::numeric_limits<int>::max()),
     id_sync_(0),
     solve_type_(solve_leaf),
-    ir_post_(-1)
+    ir_post_(-1),
+    face_child_()
   { }
 
   /// Destructor
-  virtual ~Solver() throw()
-  { }
+  virtual ~Solver() throw();
+
+  /// Delete FieldFace objects cached by field_face_child_()
+  void clear_face_child() throw();
   
   /// CHARM++ Pack / Unpack function
   void pup (PUP::er &p)
@@ -202,6 +206,12 @@ protected: // functions
 
   bool reuse_solution_ (int cycle) const throw();
 
+  /// Return a cached FieldFace for restricting the given field to the
+  /// parent (refresh_coarse) or prolonging it to child ic3
+  /// (refresh_fine), creating it on first use
+  FieldFace * field_face_child_
+  (int index_field, int refresh_type, const int ic3[3]) throw();
+
 protected: // attributes
 
   /// Name of the solver
@@ -239,6 +249,9 @@ protected: // attributes
 
   /// New Refresh id for after the solver
   int ir_post_;
+
+  /// Cached FieldFace objects for field_face_child_(); not packed
+  std::map<int,FieldFace*> face_child_;
 };
 
 #endif /* COMPUTE_SOLVER_HPP */
@@ -34,6 +34,7 @@ void Block::adapt_enter_()
 {
   if ( do_adapt_()) {
 
+    timeline_begin_("adapt");
     adapt_begin_();
     
   } else {
@@ -119,17 +120,31 @@ void Block::adapt_end_()
   for (size_t i=0; i<face_level_last_.size(); i++)
     face_level_last_[i] = -1;
 
+  // Neighbors may have changed, so rebuild refresh plans when next used
+  new_refresh_plan_clear_();
+
+  // Boundary conditions are only enforced on leaf Blocks
+  if (! is_leaf()) boundary_cache_clear();
+
+  // Release non-leaf Field storage until a solver, output, or
+  // refinement accesses it again
+  if (! is_leaf() && cello::config()->memory_lazy_non_leaf) {
+    data()->release_fields();
+  }
+
   sync_coarsen_.reset();
   sync_coarsen_.set_stop(cello::num_children());
 
   const int initial_cycle = cello::config()->initial_cycle;
   const bool is_first_cycle = (initial_cycle == cycle());
-  const int level_maximum = cello::config()->mesh_max_level;
-
-  bool adapt_again = (is_first_cycle && (adapt_step_++ < level_maximum));
 
-  if (adapt_again) {
-    control_sync_quiescence (CkIndex_Main::p_adapt_enter());
+  if (is_first_cycle) {
+    // Count Blocks that refined in this step to decide whether
+    // another step is needed to build the initial hierarchy
+    int count = adapt_refined_ ? 1 : 0;
+    adapt_refined_ = false;
+    CkCallback callback (CkIndex_Block::r_adapt_end_initial(NULL), thisProxy);
+    contribute (sizeof(int), &count, CkReduction::sum_int, callback);
   } else {
     control_sync_quiescence (CkIndex_Main::p_adapt_exit());
   }
@@ -138,6 +153,32 @@ void Block::adapt_end_()
 
 //----------------------------------------------------------------------
 
+/// @brief Repeat the adapt phase in the first cycle until no Block
+/// refines or the maximum level is reached.
+///
+/// Since refinement criteria are not changed by an adapt step that
+/// does not refine any Blocks, remaining steps would have no effect
+/// and are skipped.
+void Block::r_adapt_end_initial (CkReductionMsg * msg)
+{
+  performance_start_(perf_adapt_end);
+
+  const int count = ((int *)msg->getData())[0];
+  delete msg;
+
+  const int level_maximum = cello::config()->mesh_max_level;
+
+  if (count > 0 && (adapt_step_++ < level_maximum)) {
+    adapt_enter_();
+  } else {
+    adapt_exit_();
+  }
+
+  performance_stop_(perf_adapt_end);
+}
+
+//----------------------------------------------------------------------
+
 /// @brief Return whether the adapt phase should be called this cycle.
 bool Block::do_adapt_()
 {
@@ -168,19 +209,8 @@ int Block::adapt_compute_desired_level_(int level_maximum)
   int level = this->level();
   int level_desired = level;
 
-  Problem * problem = cello::problem();
-  Refine * refine;
-
-  int index_refine = 0;
-  while ((refine = problem->refine(index_refine++))) {
-
-    Schedule * schedule = refine->schedule();
+  adapt_ = adapt_evaluate_refine_();
 
-    if ((schedule==NULL) || schedule->write_this_cycle(cycle(),time()) ) {
-      adapt_ = std::max(adapt_,refine->apply(this));
-    }
-
-  }
   const int initial_cycle = cello::config()->initial_cycle;
   const bool is_first_cycle = (initial_cycle == cycle());
 
@@ -198,6 +228,138 @@ int Block::adapt_compute_desired_level_(int level_maximum)
 
 //----------------------------------------------------------------------
 
+/// @brief Evaluate all scheduled refinement criteria on the Block
+///
+/// Criteria supporting tiles are evaluated together in a single sweep
+/// over slabs of the Block so that field data is reused while in
+/// cache.  Evaluation stops as soon as a refine decision is reached,
+/// except for criteria that write an output field.  Remaining
+/// criteria are applied individually.  Results are reused if the
+/// Block's field data, cycle, and level are unchanged since the last
+/// evaluation and no output fields are requested.
+///
+/// @return The maximum adapt value over all criteria
+int Block::adapt_evaluate_refine_()
+{
+  Problem * problem = cello::problem();
+  Refine * refine;
+
+  // collect scheduled refinement criteria
+
+  std::vector<int> index_tiled;
+  std::vector<int> index_untiled;
+  bool any_output = false;
+
+  int index_refine = 0;
+  while ((refine = problem->refine(index_refine))) {
+
+    Schedule * schedule = refine->schedule();
+
+    if ((schedule==NULL) || schedule->write_this_cycle(cycle(),time()) ) {
+      if (refine->is_tiled()) index_tiled.push_back(index_refine);
+      else                    index_untiled.push_back(index_refine);
+      any_output = any_output || refine->has_output();
+    }
+
+    ++index_refine;
+  }
+
+  const int level = this->level();
+
+  // reuse cached result if field data is unchanged
+
+  if (! any_output &&
+      adapt_cache_version_ == data_version_ &&
+      adapt_cache_cycle_   == cycle_ &&
+      adapt_cache_level_   == level) {
+    return adapt_cache_result_;
+  }
+
+  int adapt = adapt_unknown;
+
+  // evaluate tiled criteria in a single sweep over the Block
+
+  const int nt = index_tiled.size();
+
+  if (nt > 0) {
+
+    std::vector<char> any_refine  (nt,false);
+    std::vector<char> all_coarsen (nt,true);
+    std::vector<char> done        (nt,false);
+    
+    for (int it=0; it<nt; it++) {
+      refine = problem->refine(index_tiled[it]);
+      performance_group_start_(perf_group_refine,index_tiled[it]);
+      refine->tile_begin(this);
+      performance_group_stop_(perf_group_refine,index_tiled[it]);
+    }
+
+    // tiles are slabs about four cells thick along the outermost axis
+
+    const int rank = cello::rank();
+    int nx,ny,nz;
+    data()->field_data()->size(&nx,&ny,&nz);
+    const int n_outer = (rank >= 3) ? nz : ((rank >= 2) ? ny : nx);
+    const int num_tiles = std::max(1,n_outer/4);
+
+    bool decided = false;
+
+    for (int tile=0; tile<num_tiles && ! decided; tile++) {
+
+      for (int it=0; it<nt; it++) {
+
+	if (done[it]) continue;
+
+	refine = problem->refine(index_tiled[it]);
+
+	performance_group_start_(perf_group_refine,index_tiled[it]);
+	bool b_refine  = any_refine[it];
+	bool b_coarsen = all_coarsen[it];
+	refine->tile_apply(this,tile,num_tiles,&b_refine,&b_coarsen);
+	any_refine[it]  = b_refine;
+	all_coarsen[it] = b_coarsen;
+	performance_group_stop_(perf_group_refine,index_tiled[it]);
+
+	const bool is_refine = any_refine[it] && (level < refine->max_level());
+
+	// criteria is decided once it refines and has no output to fill
+	done[it] = any_refine[it] && ! refine->has_output();
+
+	// all criteria are decided if one refines and none write output
+	decided = decided || (is_refine && ! any_output);
+      }
+    }
+
+    for (int it=0; it<nt; it++) {
+      refine = problem->refine(index_tiled[it]);
+      adapt = std::max
+	(adapt,refine->adapt_result(any_refine[it],all_coarsen[it],level));
+    }
+  }
+
+  // apply remaining criteria individually
+
+  for (size_t iu=0; iu<index_untiled.size(); iu++) {
+
+    refine = problem->refine(index_untiled[iu]);
+
+    if (adapt == adapt_refine && ! refine->has_output()) continue;
+
+    performance_group_start_(perf_group_refine,index_untiled[iu]);
+    adapt = std::max(adapt,refine->apply(this));
+    performance_group_stop_(perf_group_refine,index_untiled[iu]);
+  }
+
+  adapt_cache_version_ = data_version_;
+  adapt_cache_cycle_   = cycle_;
+  adapt_cache_level_   = level;
+  adapt_cache_result_  = adapt;
+
+  return adapt;
+}
+
+//----------------------------------------------------------------------
+
 void Block::adapt_refine_()
 {
   Monitor * monitor = cello::monitor();
@@ -322,6 +484,7 @@ void Block::adapt_refine_()
   cello::simulation()->data_delete_particles(count);
   
   is_leaf_ = false;
+  adapt_refined_ = true;
 #ifdef DEBUG_ADAPT
   CkPrintf ("%s adapt_refine is_leaf <- 0\n",name().c_str());
   fflush(stdout);
@@ -776,6 +939,7 @@ void Block::p_adapt_recv_child (MsgCoarsen * msg)
   performance_start_(perf_adapt_update);
 
   msg->update(data());
+  data_changed_();
 
   int * ic3 = msg->ic3();
   int * child_face_level_curr = msg->face_level();
@@ -39,12 +39,46 @@ void Block::initial_exit_()
   performance_start_(perf_initial);
   TRACE_CONTROL("initial_exit");
 
+  // All Blocks are initialized: let Initial objects start any
+  // collective operations that send data to Blocks
+
+  Problem * problem = cello::problem();
+  int index = 0;
+  while (Initial * initial = problem->initial(index++)) {
+    initial->enforce_block_exit(this);
+  }
+
+  if (initial_pending_ > 0) {
+    // wait for initial_received()
+    initial_waiting_ = true;
+  } else {
+    initial_done_();
+  }
+  performance_stop_(perf_initial);
+}
+
+//----------------------------------------------------------------------
+
+void Block::initial_received()
+{
+  data_changed_();
+  if (--initial_pending_ == 0 && initial_waiting_) {
+    initial_waiting_ = false;
+    initial_done_();
+  }
+}
+
+//----------------------------------------------------------------------
+
+void Block::initial_done_()
+{
+  TRACE_CONTROL("initial_done");
+
 #ifdef TRACE_CONTRIBUTE  
   CkPrintf ("%s %s:%d DEBUG_CONTRIBUTE calling r_adapt_enter\n",
 	    name().c_str(),__FILE__,__LINE__); fflush(stdout);
 #endif  
   control_sync_barrier (CkIndex_Block::r_adapt_enter(NULL));
-  performance_stop_(perf_initial);
 }
 
 //----------------------------------------------------------------------
@@ -53,6 +87,18 @@ void Block::adapt_exit_()
 {
   TRACE_CONTROL("adapt_exit");
 
+  if (do_adapt_()) timeline_end_("adapt");
+
+  // Apply initial conditions deferred while building the initial
+  // mesh hierarchy to leaf Blocks, now that they are known, and
+  // restrict them to their deferred ancestors.  Quiescence below
+  // waits until all restricted data has been received.
+
+  if (initial_deferred_ && is_leaf()) {
+    apply_initial_();
+    initial_deferred_restrict_();
+  }
+
   control_sync_quiescence(CkIndex_Main::p_output_enter());
 }
 
@@ -64,6 +110,8 @@ void Block::output_exit_()
 
   TRACE_CONTROL("output_exit");
 
+  timeline_end_("output");
+
   if (index_.is_root()) {
     cello::simulation()->monitor_output();
   }
@@ -84,6 +132,8 @@ void Block::stopping_exit_()
 {
   TRACE_CONTROL("stopping_exit");
 
+  timeline_end_("stopping");
+
   if (cello::simulation()->cycle_changed()) {
     // if performance counters haven't started yet for this cycle
     int cycle_initial = cello::config()->initial_cycle;
@@ -97,6 +147,15 @@ void Block::stopping_exit_()
 
   if (stop_) {
 
+    // Free cached FieldFace objects before the barrier, so that none
+    // remain on any process when Block::exit_() checks for leaks
+
+    Problem * problem = cello::problem();
+    for (int i=0; i<problem->num_solvers(); i++) {
+      problem->solver(i)->clear_face_child();
+    }
+    new_refresh_plan_clear_();
+
 #ifdef TRACE_CONTRIBUTE  
   CkPrintf ("%s %s:%d DEBUG_CONTRIBUTE calling r_exit()\n",
 	    name().c_str(),__FILE__,__LINE__); fflush(stdout);
@@ -116,6 +175,10 @@ void Block::compute_exit_ ()
 {
   TRACE_CONTROL("compute_exit");
 
+  timeline_end_("compute");
+
+  data_changed_();
+
   control_sync_barrier(CkIndex_Block::r_adapt_enter(NULL));
   //  adapt_enter_();
 }
@@ -22,6 +22,7 @@
 void Block::compute_enter_ ()
 {
   performance_start_(perf_compute,__FILE__,__LINE__);
+  timeline_begin_("compute");
   compute_begin_();
   performance_stop_(perf_compute,__FILE__,__LINE__);
 }
@@ -61,8 +62,32 @@ void Block::compute_next_ ()
     int ir_post = method->refresh_id_post();
     
     cello::refresh(ir_post)->set_active (is_leaf());
-    
-    new_refresh_start (ir_post,CkIndex_Block::p_compute_continue());
+
+    compute_overlap_ = method_overlap_(method);
+
+    if (compute_overlap_) {
+
+      // send ghost zone data, compute interior while waiting, then
+      // wait for ghost zones before computing the rest
+
+      new_refresh_start (ir_post,CkIndex_Block::p_compute_continue(),false);
+
+      timeline_begin_("compute_interior");
+
+      const int index_method = index_method_;
+      performance_group_start_(perf_group_method,index_method);
+      method->compute_interior (this);
+      performance_group_stop_(perf_group_method,index_method);
+
+      timeline_end_("compute_interior");
+
+      new_refresh_wait (ir_post,CkIndex_Block::p_compute_continue());
+
+    } else {
+
+      new_refresh_start (ir_post,CkIndex_Block::p_compute_continue());
+
+    }
     
   } else {
 
@@ -88,7 +113,8 @@ void Block::compute_continue_ ()
 
   Method * method = this->method();
   Schedule * schedule = method->schedule();
-  bool is_scheduled = 
+  // interior already computed if overlapping refresh
+  bool is_scheduled = compute_overlap_ ||
     (schedule==NULL) ||
     (schedule->write_this_cycle(cycle_,time_));
 
@@ -105,8 +131,17 @@ void Block::compute_continue_ ()
 #endif
     // Apply the method to the Block
 
-    method->compute (this);
-    
+    const int index_method = index_method_;
+    performance_group_start_(perf_group_method,index_method);
+
+    if (compute_overlap_) {
+      compute_overlap_ = false;
+      method->compute_boundary (this);
+    } else {
+      method->compute (this);
+    }
+
+    performance_group_stop_(perf_group_method,index_method);
     performance_stop_(perf_compute,__FILE__,__LINE__);
 
   } else {
@@ -119,12 +154,27 @@ void Block::compute_continue_ ()
 
 //----------------------------------------------------------------------
 
+bool Block::method_overlap_ (Method * method)
+{
+  // refresh is only active for leaf Blocks, and ghost zones need not
+  // be waited for if the Method is not scheduled this cycle
+  Schedule * schedule = method->schedule();
+  const bool is_scheduled =
+    (schedule==NULL) ||
+    (schedule->write_this_cycle(cycle_,time_));
+  return method->overlap_refresh() && is_leaf() && is_scheduled;
+}
+
+//----------------------------------------------------------------------
+
 void Block::compute_done ()
 {
 #ifdef DEBUG_COMPUTE
   if (cycle() >= CYCLE)
     CkPrintf ("%d %s DEBUG_COMPUTE Block::compute_done_()\n", CkMyPe(),name().c_str());
 #endif
+  // Method may have written any field
+  data_changed_();
   index_method_++;
   compute_next_();
 }
@@ -37,7 +37,7 @@
 
 //----------------------------------------------------------------------
 
-void Block::new_refresh_start (int id_refresh, int callback)
+void Block::new_refresh_start (int id_refresh, int callback, bool wait)
 {
   CHECK_ID(id_refresh);
   Refresh * refresh = cello::refresh(id_refresh);
@@ -58,6 +58,10 @@ void Block::new_refresh_start (int id_refresh, int callback)
 
     sync->set_state(RefreshState::ACTIVE);
 
+    timeline_begin_("refresh");
+
+    performance_group_start_(perf_group_refresh,id_refresh);
+
     // send Field face data
 
     int count_field=0;
@@ -78,6 +82,8 @@ void Block::new_refresh_start (int id_refresh, int callback)
     }
 
     const int count = count_field + count_particle + count_flux;
+
+    performance_group_stop_(perf_group_refresh,id_refresh);
     
     // Make sure sync counter is not active
     ASSERT4 ("Block::new_refresh_start()",
@@ -90,7 +96,7 @@ void Block::new_refresh_start (int id_refresh, int callback)
 
     TRACE_SYNC("A start");
 
-    new_refresh_wait(id_refresh,callback);
+    if (wait) new_refresh_wait(id_refresh,callback);
 
   } else {
 
@@ -190,6 +196,8 @@ void Block::new_refresh_check_done (int id_refresh)
 
     sync->set_state(RefreshState::INACTIVE);
 
+    timeline_end_("refresh");
+
     // Call callback
 
     new_refresh_exit(*refresh);
@@ -205,6 +213,8 @@ void Block::p_new_refresh_recv (MsgRefresh * msg)
   CHECK_ID(id_refresh);
   TRACE_NEW_REFRESH(this,cello::refresh(id_refresh),"recv");
 
+  data_changed_(*cello::refresh(id_refresh));
+
   Sync * sync = sync_(id_refresh);
 
   TRACE_SYNC("D recv");
@@ -251,10 +261,53 @@ void Block::new_refresh_exit (Refresh & refresh)
 
 int Block::new_refresh_load_field_faces_ (Refresh & refresh)
 {
-  int count = 0;
+  RefreshPlan & plan = new_refresh_plan_(refresh);
+
+  const int count = plan.index_list.size();
+
+  for (int i=0; i<count; i++) {
+    new_refresh_load_field_face_
+      (refresh,plan.index_list[i],plan.field_face_list[i]);
+  }
+
+  return count;
+}
+
+//----------------------------------------------------------------------
+
+RefreshPlan & Block::new_refresh_plan_ (Refresh & refresh)
+{
+  const int id_refresh = refresh.id();
+  CHECK_ID(id_refresh);
+
+  if (new_refresh_plan_list_.size() <= size_t(id_refresh)) {
+    new_refresh_plan_list_.resize(id_refresh + 1);
+  }
+
+  RefreshPlan & plan = new_refresh_plan_list_[id_refresh];
 
   const int min_face_rank = refresh.min_face_rank();
   const int neighbor_type = refresh.neighbor_type();
+  const int root_level    = refresh.root_level();
+
+  if (plan.is_valid &&
+      plan.min_face_rank == min_face_rank &&
+      plan.neighbor_type == neighbor_type &&
+      plan.root_level    == root_level) {
+    return plan;
+  }
+
+  // (Re)build the plan
+
+  for (size_t i=0; i<plan.field_face_list.size(); i++) {
+    delete plan.field_face_list[i];
+  }
+  plan.index_list.clear();
+  plan.field_face_list.clear();
+
+  plan.min_face_rank = min_face_rank;
+  plan.neighbor_type = neighbor_type;
+  plan.root_level    = root_level;
 
   if (neighbor_type == neighbor_leaf ||
       neighbor_type == neighbor_tree) {
@@ -265,7 +318,7 @@ int Block::new_refresh_load_field_faces_ (Refresh & refresh)
     
     ItNeighbor it_neighbor =
       this->it_neighbor(min_face_rank,index_,
-			neighbor_type,min_level,refresh.root_level());
+			neighbor_type,min_level,root_level);
 
     int if3[3];
     while (it_neighbor.next(if3)) {
@@ -283,8 +336,8 @@ int Block::new_refresh_load_field_faces_ (Refresh & refresh)
 	(level_face == level)     ? refresh_same :
 	(level_face == level + 1) ? refresh_fine : refresh_unknown;
 
-      new_refresh_load_field_face_ (refresh,refresh_type,index_neighbor,if3,ic3);
-      ++count;
+      new_refresh_plan_add_
+	(plan,refresh,refresh_type,index_neighbor,if3,ic3);
     }
 
   } else if (neighbor_type == neighbor_level) {
@@ -303,25 +356,27 @@ int Block::new_refresh_load_field_faces_ (Refresh & refresh)
 	
 	Index index_face = it_face.index();
 	int ic3[3] = {0,0,0};
-	new_refresh_load_field_face_ (refresh,refresh_same,index_face,if3,ic3);
-	++count;
+	new_refresh_plan_add_
+	  (plan,refresh,refresh_same,index_face,if3,ic3);
       }
 
     }
   }
 
-  return count;
+  plan.is_valid = true;
+
+  return plan;
 }
 
 //----------------------------------------------------------------------
 
-void Block::new_refresh_load_field_face_
-( Refresh & refresh,
+void Block::new_refresh_plan_add_
+( RefreshPlan & plan,
+  Refresh & refresh,
   int refresh_type,
   Index index_neighbor,
   int if3[3],
   int ic3[3])
-
 {
   // ... coarse neighbor requires child index of self in parent
 
@@ -329,30 +384,55 @@ void Block::new_refresh_load_field_face_
     index_.child(index_.level(),ic3,ic3+1,ic3+2);
   }
 
-  // ... copy field ghosts to array using FieldFace object
-
-  MsgRefresh * msg_refresh = new MsgRefresh;
-
   bool lg3[3] = {false,false,false};
 
   FieldFace * field_face = create_face
     (if3, ic3, lg3, refresh_type, &refresh,false);
 
+  plan.index_list.push_back(index_neighbor);
+  plan.field_face_list.push_back(field_face);
+}
+
+//----------------------------------------------------------------------
+
+void Block::new_refresh_plan_clear_ ()
+{
+  for (size_t id=0; id<new_refresh_plan_list_.size(); id++) {
+    RefreshPlan & plan = new_refresh_plan_list_[id];
+    for (size_t i=0; i<plan.field_face_list.size(); i++) {
+      delete plan.field_face_list[i];
+    }
+    plan.index_list.clear();
+    plan.field_face_list.clear();
+    plan.is_valid = false;
+  }
+}
+
+//----------------------------------------------------------------------
+
+void Block::new_refresh_load_field_face_
+( Refresh & refresh,
+  Index index_neighbor,
+  FieldFace * field_face)
+{
+  // ... copy field ghosts to array using the cached FieldFace object,
+  // which is not deleted with the message.  Local messages must be
+  // received before the plan is cleared in adapt_end_(), as with the
+  // Block's FieldData they also refer to
+
+  MsgRefresh * msg_refresh = new MsgRefresh;
+
   DataMsg * data_msg = new DataMsg;
 #ifdef DEBUG_NEW_REFRESH
   CkPrintf ("%d %s:%d DEBUG_REFRESH %p new DataMsg\n",
             CkMyPe(),__FILE__,__LINE__,data_msg);
 #endif  
-  data_msg -> set_field_face (field_face,true);
+  data_msg -> set_field_face_cached (field_face);
   data_msg -> set_field_data (data()->field_data(),false);
 
   const int id_refresh = refresh.id();
   CHECK_ID(id_refresh);
   
-  ASSERT1 ("Block::new_refresh_load_field_face_()",
-	  "id_refresh %d of refresh object is out of range",
-	   id_refresh,
-	   (0 <= id_refresh));
   msg_refresh->set_new_refresh_id (id_refresh);
   msg_refresh->set_data_msg (data_msg);
 
@@ -27,6 +27,7 @@ void Block::output_enter_ ()
 {
   TRACE_OUTPUT("Block::output_enter_()");
   performance_start_(perf_output);
+  timeline_begin_("output");
 #ifdef NEW_OUTPUT
   new_output_begin_();
 #else /* NEW_OUTPUT */
@@ -290,8 +291,62 @@ void Problem::output_wait(Simulation * simulation) throw()
   const int ip = CkMyPe();
   const int np = CkNumPes();
   const int ip_write = output->process_writer();
+  const int num_parts = output->num_parts();
 
-  if (ip == ip_write) {
+  if (num_parts > 1) {
+
+    // Send each part to its remote writer, so that different parts
+    // are reduced and written concurrently.  Parts written locally
+    // already hold this process's data and are not sent
+
+    bool is_part_writer = false;
+
+    for (int part=0; part<num_parts; part++) {
+
+      const int ip_part = output->process_writer_part(part);
+
+      if (ip == ip_part) {
+	is_part_writer = true;
+      } else {
+
+	int n=0;  char * buffer = 0;
+
+	output->prepare_remote_part(part,&n,&buffer);
+
+	proxy_simulation[ip_part].p_output_write_part (part, n, buffer);
+
+	output->cleanup_remote(&n,&buffer);
+      }
+    }
+
+    if (is_part_writer) {
+
+      // Count local data as one step for each part written locally;
+      // writers continue in output_write() once all data for their
+      // parts have been received
+
+      for (int part=0; part<num_parts; part++) {
+	if (ip == output->process_writer_part(part)) {
+	  output_write(simulation,0,0,part);
+	}
+      }
+
+    } else {
+
+      // Processes not writing any part are done
+
+      output->close();
+      output->finalize();
+      output_next(simulation);
+
+      const int stride = output->stride_wait();
+      const int ip_next = ip+1;
+      if (ip_next%stride != 0 && ip_next < np) {
+	proxy_simulation[ip_next].p_output_start(index_output_);
+      }
+    }
+
+  } else if (ip == ip_write) {
 
     output_write(simulation,0,0);
 
@@ -330,10 +385,19 @@ void Simulation::p_output_write (int n, char * buffer)
 
 //----------------------------------------------------------------------
 
+void Simulation::p_output_write_part (int part, int n, char * buffer)
+{
+  TRACE_OUTPUT("Simulation::p_output_write_part()");
+  problem()->output_write(this,n,buffer,part);
+}
+
+//----------------------------------------------------------------------
+
 void Problem::output_write 
 (
  Simulation * simulation,
- int n, char * buffer
+ int n, char * buffer,
+ int part
 ) throw()
 {
   TRACE_OUTPUT("Problem::output_write()");
@@ -341,7 +405,11 @@ void Problem::output_write
   Output * output = this->output(index_output_);
 
   if (n != 0) {
-    output->update_remote(n, buffer);
+    if (part >= 0) {
+      output->update_remote_part(part, n, buffer);
+    } else {
+      output->update_remote(n, buffer);
+    }
   }
 
   if (output->sync_write()->next()) {
@@ -89,6 +89,7 @@ void Block::p_refresh_store (MsgRefresh * msg)
   performance_start_(perf_refresh_store);
 
   msg->update(data());
+  data_changed_();
 
   delete msg;
 
@@ -37,6 +37,7 @@
 
 void Block::stopping_enter_()
 {
+  timeline_begin_("stopping");
   stopping_begin_();
 }
 
@@ -51,6 +52,8 @@ void Block::stopping_begin_()
 
   simulation->set_phase(phase_stopping);
 
+  simulation->timeline_update(cycle_,time_);
+
   int stopping_interval = simulation->config()->stopping_interval;
 
   bool stopping_reduce = stopping_interval ? 
@@ -151,6 +151,17 @@ void Data::allocate () throw()
   // initialize Flux field list
 }
 
+//----------------------------------------------------------------------
+
+int64_t Data::release_fields () throw()
+{
+  int64_t bytes = 0;
+  for (size_t i=0; i<field_data_.size(); i++) {
+    bytes += field_data_[i]->release_permanent(cello::field_descr());
+  }
+  return bytes;
+}
+
 //======================================================================
 
 void Data::copy_(const Data & data) throw()
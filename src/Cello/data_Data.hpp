@@ -121,6 +121,10 @@ public: // interface
 
   void allocate () throw();
 
+  /// Release Field storage until next accessed, e.g. for non-leaf
+  /// Blocks.  Returns the number of bytes released
+  int64_t release_fields () throw();
+
   //----------------------------------------------------------------------
   // fields
   //----------------------------------------------------------------------
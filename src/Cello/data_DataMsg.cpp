@@ -225,7 +225,7 @@ void DataMsg::update (Data * data, bool is_local)
     face_fluxes_list_.clear();
   }
   if (ff != NULL) {
-    delete field_face_;
+    if (! field_face_cached_) delete field_face_;
     field_face_ = NULL;
   }
 
@@ -22,6 +22,7 @@ public: // interface
   DataMsg() 
     : field_face_(nullptr),
       field_face_delete_   (false),
+      field_face_cached_   (false),
       field_data_(nullptr),
       field_data_delete_   (false),
       particle_data_(nullptr),
@@ -89,6 +90,16 @@ public: // interface
   {
     field_face_ = field_face; 
     field_face_delete_ = is_new;
+    field_face_cached_ = false;
+  }
+
+  /// Set a FieldFace object owned by the sender, which is neither
+  /// deleted in update() nor in the destructor
+  void set_field_face_cached (FieldFace * field_face)
+  {
+    field_face_ = field_face; 
+    field_face_delete_ = false;
+    field_face_cached_ = true;
   }
 
   /// Return the serialized FieldFace array
@@ -206,6 +217,8 @@ protected: // attributes
   FieldFace * field_face_;
   /// Whethere FieldFace data should be deleted in destructor
   bool field_face_delete_;
+  /// Whether FieldFace is owned by the sender and must not be deleted
+  bool field_face_cached_;
 
   /// Field data
   union {
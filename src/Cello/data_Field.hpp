@@ -202,6 +202,19 @@ public: // interface
   double history_time (int ih) const
   { return field_data_->history_time (field_descr_,ih); }
 
+  /// Set how history is saved for the given permanent field
+  void set_history_mode (int id_field, int history_mode)
+  { field_descr_->set_history_mode (id_field,history_mode); }
+
+  /// Return how history is saved for the given field
+  int history_mode (int id_field) const
+  { return field_descr_->history_mode (id_field); }
+
+  /// Make the values_next() array of a history_swap field current,
+  /// and the current values the newest history, without copying
+  void swap_history (int id_field)
+  { field_data_->swap_history(field_descr_,id_field); }
+
   //----------------------------------------------------------------------
   // Units operations
   //----------------------------------------------------------------------
@@ -244,6 +257,11 @@ public: // interface
   char * values (std::string name, int index_history=0) throw ()
   { return field_data_->values(field_descr_,name,index_history); }
 
+  /// Return the array to write updated values of a history_swap
+  /// field into before calling swap_history()
+  char * values_next (int id_field) throw ()
+  { return field_data_->values_next(field_descr_,id_field); }
+
   /// Return array for the corresponding field, which may or may not
   /// contain ghosts depending on if they're allocated
   const char * values (int id_field, int index_history=0) const throw ()
@@ -319,6 +337,14 @@ public: // interface
   void deallocate_permanent() throw()
   { field_data_->deallocate_permanent(); }
 
+  /// Release storage for the field data until next accessed
+  int64_t release_permanent() throw()
+  { return field_data_->release_permanent(field_descr_); }
+
+  /// Return whether storage is released until next accessed
+  bool permanent_released() const throw()
+  { return field_data_->permanent_released(); }
+
   /// Return whether ghost cells are allocated or not.  
   bool ghosts_allocated() const throw ()
   { return field_data_->ghosts_allocated(); }
@@ -20,9 +20,14 @@ FieldData::FieldData
     temporary_size_(),
     offsets_(),
     ghosts_allocated_(true),
+    permanent_released_(false),
+    current_id_(),
     history_id_(),
     history_time_(),
-    units_scaling_()
+    units_scaling_(),
+    version_(),
+    version_all_(0),
+    derived_()
 {
   if (nx != 0) {
     size_[0] = nx;
@@ -42,7 +47,16 @@ FieldData::FieldData
 //----------------------------------------------------------------------
 
 FieldData::~FieldData() throw()
-{  
+{
+  // Released fields are no longer saved once the FieldData is deleted
+  // (including after packing for migration, since pup() adds them back
+  // on the receiving process)
+  if (permanent_released_) {
+    Memory * memory = Memory::instance();
+    if (memory) {
+      memory->add_bytes_saved (- bytes_permanent_(cello::field_descr()));
+    }
+  }
   deallocate_permanent();
   for (size_t i=0; i<array_temporary_.size(); i++) {
     delete [] array_temporary_[i];
@@ -88,6 +102,14 @@ void FieldData::pup(PUP::er &p)
   p | history_id_;
   p | history_time_;
   p | units_scaling_;
+  p | permanent_released_;
+  p | current_id_;
+  if (p.isUnpacking() && permanent_released_) {
+    Memory * memory = Memory::instance();
+    if (memory) {
+      memory->add_bytes_saved (bytes_permanent_(cello::field_descr()));
+    }
+  }
 }
 
 
@@ -134,36 +156,29 @@ char * FieldData::values
 (const FieldDescr * field_descr,
  int id_field, int index_history ) throw ()
 {
-  char * values = nullptr;
+  if (id_field < 0) return nullptr;
 
-  if (id_field >= 0) {
+  if (permanent_released_) restore_released_(field_descr);
 
-    int nh = field_descr->num_history();
-    if (field_descr->is_permanent(id_field) &&
-	(1 <= index_history && index_history <= nh)) {
-      const int np = field_descr->num_permanent();
-      id_field = history_id_[id_field + np*(index_history-1)];
-    }
-  
-    if (field_descr->is_permanent(id_field)) {
-
-      const int num_fields = field_descr->field_count();
-      if (0 <= id_field && id_field < num_fields) {
-	values = &array_permanent_[0] + offsets_[id_field];
-      }
+  return values_storage_
+    (field_descr,storage_id_(field_descr,id_field,index_history));
+}
 
-    } else {
+//----------------------------------------------------------------------
 
-      // temporary field
+char * FieldData::values_next
+(const FieldDescr * field_descr, int id_field) throw ()
+{
+  if (field_descr->history_mode(id_field) != history_swap) {
+    return values(field_descr,id_field);
+  }
 
-      int id_temporary = id_field - field_descr->num_permanent();
+  if (permanent_released_) restore_released_(field_descr);
 
-      if (0 <= id_temporary && id_temporary < int(array_temporary_.size())) {
-	values = array_temporary_[id_temporary];
-      }
-    }
-  }
-  return values;
+  // oldest generation, which becomes current in swap_history()
+  const int np = field_descr->num_permanent();
+  const int nh = field_descr->num_history();
+  return values_storage_(field_descr,history_id_[id_field + np*(nh-1)]);
 }
 
 //----------------------------------------------------------------------
@@ -173,7 +188,7 @@ const char * FieldData::unknowns
   int id_field, int index_history ) const throw ()
 {
   return (const char *)
-    ((FieldData *)this) -> unknowns(field_descr,id_field);
+    ((FieldData *)this) -> unknowns(field_descr,id_field,index_history);
 }
 
 //----------------------------------------------------------------------
@@ -182,21 +197,11 @@ char * FieldData::unknowns
 (const FieldDescr * field_descr,
  int id_field, int index_history  ) throw ()
 {
-
-  // update field id if permanent and old value in history
-
-  int nh = field_descr->num_history();
-  if (field_descr->is_permanent(id_field) &&
-      (1 <= index_history && index_history <= nh)) {
-    const int np = field_descr->num_permanent();
-    id_field = history_id_[id_field + np*(index_history-1)];
-  }
-      
   // First get values including ghosts
-  // (note index_history ommitted since already have updated id_field)
-  char * unknowns = values(field_descr,id_field);
+  char * unknowns = values(field_descr,id_field,index_history);
 
-  // Then adjust for ghost zones
+  // Then adjust for ghost zones (history fields have the same ghost
+  // depth and centering as their permanent field)
   if ( ghosts_allocated() && unknowns ) {
 
     int gx,gy,gz;
@@ -236,6 +241,8 @@ void FieldData::clear
  int                id_field_first,
  int                id_field_last) throw()
 {
+  if (permanent_released_) restore_released_(field_descr);
+
   if ( permanent_allocated() ) {
     if (id_field_first == -1) {
       id_field_first = 0;
@@ -362,14 +369,7 @@ void FieldData::allocate_permanent
 
   // Allocate any "temporary" fields for history
 
-  const int np = field_descr->num_permanent();
-  const int nh = field_descr->num_history();
-  for (int ih=0; ih<nh; ih++) {
-    for (int ip=0; ip<np; ip++) {
-      int i = ip + np*ih;
-      allocate_temporary (field_descr,history_id_[i]);
-    }
-  }
+  history_allocate_(field_descr);
 }
 
 //----------------------------------------------------------------------
@@ -466,13 +466,95 @@ void FieldData::deallocate_permanent () throw()
 {
   if ( permanent_allocated() ) {
 
-    array_permanent_.clear();
+    // swap with an empty vector since clear() keeps the capacity
+    std::vector<char>().swap(array_permanent_);
     offsets_.clear();
   }
 }
 
 //----------------------------------------------------------------------
 
+int64_t FieldData::release_permanent (const FieldDescr * field_descr) throw()
+{
+  if (permanent_released_ || ! permanent_allocated()) return 0;
+
+  const int64_t bytes = bytes_permanent_(field_descr);
+
+  deallocate_permanent();
+
+  history_deallocate_(field_descr);
+
+  // Reset any swapped history buffers since values are not kept
+
+  const int np = field_descr->num_permanent();
+  const int nh = field_descr->num_history();
+  for (int ih=0; ih<nh; ih++) {
+    for (int ip=0; ip<np; ip++) {
+      history_id_[ip + np*ih] = field_descr->history_id(ip,ih+1);
+    }
+  }
+  for (int ip=0; ip<int(current_id_.size()); ip++) {
+    current_id_[ip] = ip;
+  }
+
+  permanent_released_ = true;
+
+  // Values are lost, so cached derived fields are no longer valid
+
+  set_modified_all();
+  derived_.clear();
+
+  Memory * memory = Memory::instance();
+  if (memory) memory->add_bytes_saved (bytes);
+
+  return bytes;
+}
+
+//----------------------------------------------------------------------
+
+void FieldData::restore_released_ (const FieldDescr * field_descr) throw()
+{
+  permanent_released_ = false;
+
+  // std::vector::resize() in allocate_permanent() clears values to 0
+  allocate_permanent(field_descr,ghosts_allocated_);
+  set_modified_all();
+
+  Memory * memory = Memory::instance();
+  if (memory) memory->add_bytes_saved (- bytes_permanent_(field_descr));
+}
+
+//----------------------------------------------------------------------
+
+int64_t FieldData::bytes_permanent_
+(const FieldDescr * field_descr) const throw()
+{
+  // array_permanent_ is empty if released, so compute its size from
+  // the FieldDescr instead
+  const int padding   = field_descr->padding();
+  const int alignment = field_descr->alignment();
+
+  int64_t bytes = alignment - 1;
+  for (int id_field=0; id_field<field_descr->field_count(); id_field++) {
+    const int size = field_size(field_descr,id_field);
+    bytes += adjust_padding_   (size,padding);
+    bytes += adjust_alignment_ (size,alignment);
+  }
+  const int np = field_descr->num_permanent();
+  const int nh = field_descr->num_history();
+  for (int ip=0; ip<np; ip++) {
+    if (field_descr->history_mode(ip) != history_none) {
+      int mx,my,mz;
+      dimensions(field_descr,ip,&mx,&my,&mz);
+      bytes += int64_t(nh)*mx*my*mz*
+	cello::sizeof_precision(field_descr->precision(ip));
+    }
+  }
+  return bytes;
+}
+
+//----------------------------------------------------------------------
+
 int FieldData::field_size
 (
  const FieldDescr * field_descr,
@@ -758,39 +840,38 @@ void FieldData::save_history (const FieldDescr * field_descr, double time)
   // history_id_[1] = history_id_[0];
   // history_id_[0] = history_id_[2];
   // copy history_id_[0] = permanent
+  //
+  // Fields with history_none are skipped, and fields with
+  // history_swap are cycled by swap_history() instead
 
   const int np = field_descr->num_permanent();
   const int nh = field_descr->num_history();
 
   if (nh > 0) {
 
-    // Save oldest history id's
-  
-    std::vector<int> history_id_save;
-    history_id_save.resize(np);
     for (int ip=0; ip<np; ip++) {
-      history_id_save[ip] = history_id_[ip+np*(nh-1)];
-    }
 
-    // Shuffle remaining id's
-    for (int ih=nh-1; ih>0; ih--) {
-      for (int ip=0; ip<np; ip++) {
+      if (field_descr->history_mode(ip) != history_copy) continue;
+
+      // Save oldest history id
+
+      const int id_save = history_id_[ip+np*(nh-1)];
+
+      // Shuffle remaining id's
+
+      for (int ih=nh-1; ih>0; ih--) {
 	history_id_[ip+np*(ih)] = history_id_[ip+np*(ih-1)];
       }
-    }
 
-    // Copy saved oldest id's to newest id's
-      
-    for (int ip=0; ip<np; ip++) {
-      history_id_[ip] = history_id_save[ip];
-    }
+      // Copy saved oldest id to newest id
+
+      history_id_[ip] = id_save;
+
+      // Copy field values to newest history
 
-    // Copy field values to newest history
-    for (int ip=0; ip<np; ip++) {
-      int mx,my,mz;
       char * src = values(field_descr,ip,0);
       char * dst = values(field_descr,ip,1);
-      const int bytes = field_size(field_descr,ip,&mx,&my,&mz);
+      const int bytes = field_size(field_descr,ip);
       memcpy (dst,src,bytes);
     }
 
@@ -806,6 +887,31 @@ void FieldData::save_history (const FieldDescr * field_descr, double time)
 
 //----------------------------------------------------------------------
 
+void FieldData::swap_history (const FieldDescr * field_descr, int id_field)
+{
+  ASSERT1 ("FieldData::swap_history",
+	   "Field %d does not have history_swap history",
+	   id_field, field_descr->history_mode(id_field) == history_swap);
+
+  // Current values become newest history, and the oldest history
+  // buffer (written by the Method via values_next()) becomes current
+
+  const int np = field_descr->num_permanent();
+  const int nh = field_descr->num_history();
+
+  const int id_next = history_id_[id_field+np*(nh-1)];
+
+  for (int ih=nh-1; ih>0; ih--) {
+    history_id_[id_field+np*(ih)] = history_id_[id_field+np*(ih-1)];
+  }
+
+  history_id_[id_field] = current_id_[id_field];
+
+  current_id_[id_field] = id_next;
+}
+
+//----------------------------------------------------------------------
+
 void FieldData::units_scale_cgs
 (const FieldDescr * field_descr, int id, double amount)
 {
@@ -846,6 +952,7 @@ void FieldData::units_scale_cgs
   }
   // update units_scaling_ to indicate it's scaled by amount
   units_scaling_[id] = amount;
+  set_modified(id);
 }
 
 //----------------------------------------------------------------------
@@ -880,6 +987,48 @@ void FieldData::units_scale_code (const FieldDescr * field_descr, int id, double
     }
 
     units_scaling_[id] = 1.0;
+    set_modified(id);
+  }
+}
+
+//----------------------------------------------------------------------
+
+bool FieldData::derived_is_current
+(int id_derived,
+ const std::vector<int> & id_inputs,
+ const std::vector<double> & params) const throw()
+{
+  auto it = derived_.find(id_derived);
+  if (it == derived_.end()) return false;
+
+  const DerivedRecord & record = it->second;
+
+  if (record.version != version(id_derived)) return false;
+  if (record.params != params) return false;
+  if (record.versions_in.size() != id_inputs.size()) return false;
+
+  for (size_t i=0; i<id_inputs.size(); i++) {
+    if (record.versions_in[i] != version(id_inputs[i])) return false;
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------
+
+void FieldData::set_derived_current
+(int id_derived,
+ const std::vector<int> & id_inputs,
+ const std::vector<double> & params) throw()
+{
+  // computing the derived field writes it
+  set_modified(id_derived);
+
+  DerivedRecord & record = derived_[id_derived];
+  record.version = version(id_derived);
+  record.params  = params;
+  record.versions_in.resize(id_inputs.size());
+  for (size_t i=0; i<id_inputs.size(); i++) {
+    record.versions_in[i] = version(id_inputs[i]);
   }
 }
 
@@ -1054,4 +1203,87 @@ void FieldData::set_history_(const FieldDescr * field_descr)
       history_time_[ih] = 0.0;
     }
   }
+
+  // Current values are in permanent storage until swap_history()
+
+  current_id_.resize(np);
+  for (int ip=0; ip<np; ip++) {
+    current_id_[ip] = ip;
+  }
+}
+
+//----------------------------------------------------------------------
+
+int FieldData::storage_id_
+(const FieldDescr * field_descr, int id_field, int index_history) const
+{
+  if (field_descr->is_permanent(id_field)) {
+    const int np = field_descr->num_permanent();
+    const int nh = field_descr->num_history();
+    if (1 <= index_history && index_history <= nh) {
+      return history_id_[id_field + np*(index_history-1)];
+    } else if (id_field < int(current_id_.size())) {
+      return current_id_[id_field];
+    }
+  }
+  return id_field;
+}
+
+//----------------------------------------------------------------------
+
+char * FieldData::values_storage_
+(const FieldDescr * field_descr, int id_storage) throw()
+{
+  char * values = nullptr;
+
+  if (field_descr->is_permanent(id_storage)) {
+
+    if (permanent_allocated()) {
+      values = &array_permanent_[0] + offsets_[id_storage];
+    }
+
+  } else {
+
+    // temporary field
+
+    int id_temporary = id_storage - field_descr->num_permanent();
+
+    if (0 <= id_temporary && id_temporary < int(array_temporary_.size())) {
+      values = array_temporary_[id_temporary];
+    }
+  }
+  return values;
+}
+
+//----------------------------------------------------------------------
+
+void FieldData::history_allocate_ (const FieldDescr * field_descr) throw()
+{
+  const int np = field_descr->num_permanent();
+  const int nh = field_descr->num_history();
+  for (int ih=0; ih<nh; ih++) {
+    for (int ip=0; ip<np; ip++) {
+      if (field_descr->history_mode(ip) != history_none) {
+	const int id = history_id_[ip + np*ih];
+	if (id != ip) allocate_temporary (field_descr,id);
+      }
+    }
+  }
+  for (int ip=0; ip<int(current_id_.size()); ip++) {
+    if (current_id_[ip] != ip) allocate_temporary (field_descr,current_id_[ip]);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void FieldData::history_deallocate_ (const FieldDescr * field_descr) throw()
+{
+  for (size_t i=0; i<history_id_.size(); i++) {
+    const int id = history_id_[i];
+    if (field_descr->is_temporary(id)) deallocate_temporary (field_descr,id);
+  }
+  for (int ip=0; ip<int(current_id_.size()); ip++) {
+    const int id = current_id_[ip];
+    if (field_descr->is_temporary(id)) deallocate_temporary (field_descr,id);
+  }
 }
@@ -56,6 +56,12 @@ public: // interface
 		 std::string name, int history=0) throw ()
   { return values (field_descr,field_descr->field_id(name),history); }
 
+  /// Return the array that swap_history() will make current, for
+  /// a Method to write updated values of a history_swap field
+  /// into.  Values, including ghost values, are those of the oldest
+  /// history generation.  Returns values() for other fields
+  char * values_next (const FieldDescr *, int id_field) throw ();
+
   /// Return array for the corresponding field, which may or may not
   /// contain ghosts depending on if they're allocated
   const char * values (const FieldDescr *,
@@ -118,6 +124,16 @@ public: // interface
   /// Deallocate storage for the permanent fields
   void deallocate_permanent() throw();
 
+  /// Release storage for the permanent and history fields until they
+  /// are next accessed, when they are reallocated and cleared to 0.
+  /// Marks all fields as modified and discards derived field records.
+  /// Returns the number of bytes released
+  int64_t release_permanent(const FieldDescr *) throw();
+
+  /// Return whether permanent storage is released until next accessed
+  bool permanent_released() const throw()
+  { return permanent_released_; }
+
   /// Deallocate storage for the temporary fields
   void deallocate_temporary(const FieldDescr *,int id) 
     throw ();
@@ -151,9 +167,14 @@ public: // interface
   // History operations
   //----------------------------------------------------------------------
 
-  /// Copy "current" fields to "old" fields
+  /// Copy "current" fields to "old" fields, for fields with
+  /// history_copy history
   void save_history (const FieldDescr *, double time);
 
+  /// Make the values_next() array of a history_swap field current,
+  /// and the current values the newest history, without copying
+  void swap_history (const FieldDescr *, int id_field);
+
   /// Return time for given history
   double history_time (const FieldDescr * field_descr, int ih) const
   {
@@ -180,6 +201,45 @@ public: // interface
   /// 1.0 if in code units, or the scaling factor if in cgs
   double units_scaling (const FieldDescr *, int id);
 
+  //----------------------------------------------------------------------
+  // Version operations
+  //----------------------------------------------------------------------
+
+  /// Return the modification version of the given field.  Versions
+  /// only increase, and change whenever the field may have been written
+  int version (int id_field) const throw()
+  {
+    return version_all_ +
+      ((0 <= id_field && id_field < (int)version_.size()) ?
+       version_[id_field] : 0);
+  }
+
+  /// Mark the given field as modified
+  void set_modified (int id_field) throw()
+  {
+    if (id_field < 0) return;
+    if (id_field >= (int)version_.size()) version_.resize(id_field+1,0);
+    ++version_[id_field];
+  }
+
+  /// Mark all fields as modified
+  void set_modified_all () throw()
+  { ++version_all_; }
+
+  /// Return whether the derived field id_derived is current, that is
+  /// whether it was last computed from fields id_inputs with the same
+  /// versions and the same parameters, and has not since been modified
+  bool derived_is_current (int id_derived,
+			   const std::vector<int> & id_inputs,
+			   const std::vector<double> & params) const throw();
+
+  /// Record that the derived field id_derived has just been computed
+  /// from the current versions of fields id_inputs with the given
+  /// parameters
+  void set_derived_current (int id_derived,
+			    const std::vector<int> & id_inputs,
+			    const std::vector<double> & params) throw();
+
   //--------------------------------------------------
 private: // functions
   //--------------------------------------------------
@@ -217,6 +277,26 @@ private: // functions
   /// (Re-)initialize temporary fields for history
   void set_history_ (const FieldDescr * field_descr);
 
+  /// Reallocate permanent and history fields released by
+  /// release_permanent()
+  void restore_released_ (const FieldDescr * field_descr) throw();
+
+  /// Return the number of bytes used by permanent and history fields
+  int64_t bytes_permanent_ (const FieldDescr *) const throw();
+
+  /// Return the field id of the storage for the given field and
+  /// history generation
+  int storage_id_ (const FieldDescr *, int id_field, int index_history) const;
+
+  /// Return the array for the given storage field id
+  char * values_storage_ (const FieldDescr *, int id_storage) throw();
+
+  /// Allocate temporary fields for history of fields with history
+  void history_allocate_ (const FieldDescr *) throw();
+
+  /// Deallocate temporary fields for history
+  void history_deallocate_ (const FieldDescr *) throw();
+
   /// Allocate (more) units_scaling_ array values
   void units_allocate_ (int n)
   {
@@ -260,6 +340,13 @@ private: // attributes
   /// Whether ghost values are allocated or not 
   bool ghosts_allocated_;
 
+  /// Whether permanent fields are released until next accessed
+  bool permanent_released_;
+
+  /// Field id of the storage holding current values of each
+  /// permanent field: itself unless swapped by swap_history()
+  std::vector<int> current_id_;
+
   /// Temporary field id's used for history.  May be permuted
   /// wrt FieldDescr when copying generations.  Initialized from
   /// FieldDescr copy
@@ -270,6 +357,22 @@ private: // attributes
 
   /// Current scaling of each field
   std::vector<double> units_scaling_;
+
+  /// Modification version of each field (not packed)
+  std::vector<int> version_;
+
+  /// Modification version shared by all fields (not packed)
+  int version_all_;
+
+  /// Versions of a derived field and its inputs when last computed
+  struct DerivedRecord {
+    int version;
+    std::vector<int> versions_in;
+    std::vector<double> params;
+  };
+
+  /// Derived field records indexed by field id (not packed)
+  std::map<int,DerivedRecord> derived_;
 };   
 
 #endif /* DATA_FIELD_DATA_HPP */
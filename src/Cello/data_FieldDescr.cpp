@@ -24,7 +24,8 @@ FieldDescr::FieldDescr () throw ()
     ghost_depth_(),
     conserved_(),
     history_(0),
-    history_id_()
+    history_id_(),
+    history_mode_()
 {
   for (int i=0; i<3; i++) {
     ghost_depth_default_[i] = 0;
@@ -217,6 +218,7 @@ int FieldDescr::insert_(const std::string & field_name,
   precision_.  push_back(precision);
   centering_.  push_back(centered);
   ghost_depth_.push_back(ghost_depth);
+  history_mode_.push_back(history_copy);
 
   return id;
 }
@@ -240,6 +242,16 @@ void FieldDescr::set_precision(int id_field, int precision) throw()
 
 //----------------------------------------------------------------------
 
+void FieldDescr::set_history_mode(int id_field, int history_mode) throw()
+{
+  ASSERT1 ("FieldDescr::set_history_mode",
+	   "Field %d must be a permanent field",
+	   id_field, is_permanent(id_field));
+  history_mode_.at(id_field) = history_mode;
+}
+
+//----------------------------------------------------------------------
+
 int FieldDescr::bytes_per_element(int id_field) const throw()
 {
   return cello::sizeof_precision (precision(id_field));
@@ -320,6 +332,7 @@ void FieldDescr::copy_(const FieldDescr & field_descr) throw()
   for (size_t i=0; i<field_descr.history_id_.size(); i++) {
     history_id_[i] = field_descr.history_id_[i];
   }
+  history_mode_ = field_descr.history_mode_;
   
 }
 
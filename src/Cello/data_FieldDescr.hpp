@@ -77,6 +77,7 @@ public: // functions
     p | conserved_;
     p | history_;
     p | history_id_;
+    p | history_mode_;
   }
 
   /// Set alignment
@@ -163,6 +164,17 @@ public: // functions
   int num_history () const throw()
   { return history_; }
 
+  /// Set how history is saved for the given permanent field
+  void set_history_mode (int id_field, int history_mode) throw();
+
+  /// Return how history is saved for the given field: history_none
+  /// if no history is saved or the field is not permanent
+  int history_mode (int id_field) const throw()
+  {
+    return (history_ > 0 && is_permanent(id_field)) ?
+      history_mode_.at(id_field) : history_none;
+  }
+
   /// Return the temporary field id for ih'th generation of permanent
   /// field ip (0 is current, 1 first generation, etc.)
   int history_id (int ip, int ih) const throw()
@@ -296,6 +308,9 @@ private: // attributes
   /// Temporary fields used for history.  Non-permuted.
   std::vector<int> history_id_;
 
+  /// How history is saved for each field (history_type)
+  std::vector<int> history_mode_;
+
 };
 
 #endif /* DATA_FIELD_DESCR_HPP */
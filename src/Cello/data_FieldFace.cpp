@@ -157,7 +157,8 @@ void FieldFace::face_to_array ( Field field,char * array) throw()
 {
   size_t index_array = 0;
 
-  std::vector <int> field_list = field_list_src_(field);
+  const std::vector <int> field_list = field_list_src_(field);
+  const std::vector <int> field_list_dst = field_list_dst_(field);
 
   for (size_t i_f=0; i_f < field_list.size(); i_f++) {
 
@@ -175,9 +176,7 @@ void FieldFace::face_to_array ( Field field,char * array) throw()
     field.ghost_depth(index_field,&g3[0],&g3[1],&g3[2]);
     field.centering(index_field,&c3[0],&c3[1],&c3[2]);
 
-    int index_src = field_list_src_(field)[i_f];
-    int index_dst = field_list_dst_(field)[i_f];
-    const bool accumulate = accumulate_(index_src,index_dst);
+    const bool accumulate = accumulate_(field_list[i_f],field_list_dst[i_f]);
 
     int i3[3], n3[3];
     if (!accumulate) {
@@ -237,7 +236,8 @@ void FieldFace::array_to_face (char * array, Field field) throw()
 {
   size_t index_array = 0;
 
-  std::vector<int> field_list = field_list_dst_(field);
+  const std::vector<int> field_list_src = field_list_src_(field);
+  const std::vector<int> field_list = field_list_dst_(field);
   
   for (size_t i_f=0; i_f < field_list.size(); i_f++) {
 
@@ -255,9 +255,7 @@ void FieldFace::array_to_face (char * array, Field field) throw()
     field.ghost_depth(index_field,&g3[0],&g3[1],&g3[2]);
     field.centering(index_field,&c3[0],&c3[1],&c3[2]);
 
-    int index_src = field_list_src_(field)[i_f];
-    int index_dst = field_list_dst_(field)[i_f];
-    const bool accumulate = accumulate_(index_src,index_dst);
+    const bool accumulate = accumulate_(field_list_src[i_f],field_list[i_f]);
 
     int i3[3], n3[3];
     if (!accumulate) {
@@ -430,7 +428,8 @@ int FieldFace::num_bytes_array(Field field) throw()
 {
   int array_size = 0;
 
-  std::vector<int> field_list = field_list_src_(field);
+  const std::vector<int> field_list = field_list_src_(field);
+  const std::vector<int> field_list_dst = field_list_dst_(field);
 
   for (size_t i_f=0; i_f < field_list.size(); i_f++) {
 
@@ -445,9 +444,7 @@ int FieldFace::num_bytes_array(Field field) throw()
     field.ghost_depth(index_field,&g3[0],&g3[1],&g3[2]);
     field.centering(index_field,&c3[0],&c3[1],&c3[2]);
 
-    int index_src = field_list_src_(field)[i_f];
-    int index_dst = field_list_dst_(field)[i_f];
-    const bool accumulate = accumulate_(index_src,index_dst);
+    const bool accumulate = accumulate_(field_list[i_f],field_list_dst[i_f]);
     int op_type = (refresh_type_ == refresh_fine) ? op_load : op_store;
 
     int i3[3], n3[3];
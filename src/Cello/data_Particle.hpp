@@ -250,6 +250,12 @@ public: // interface
   int batch_size() const
   { return particle_descr_->batch_size(); }
 
+  /// Return whether each type's batches are views into a single
+  /// contiguous "slab" array
+
+  bool is_slab() const
+  { return particle_descr_->slab(); }
+
   /// Return the batch and particle index given a global particle
   /// index i.  This is useful e.g. for iterating over range of
   /// particles, e.g. initializing new particles after insert().
@@ -277,6 +283,25 @@ public: // interface
   { return particle_data_->attribute_array 
       (particle_descr_, it,ia,ib); }
 
+  /// Return the attribute array for all particles of the given type.
+  /// Requires slab storage, and compresses the type if needed
+
+  char * attribute_array (int it,int ia)
+  { return particle_data_->attribute_array (particle_descr_, it,ia); }
+
+  /// Return the number of attribute arrays to loop over for the given
+  /// type: the number of batches, or with slab storage at most one
+  /// spanning all particles of the type (after compressing if needed).
+  /// Use with array_size() and attribute_array(it,ia,ib) to write
+  /// kernels that work with either storage
+
+  int num_arrays (int it)
+  { return particle_data_->num_arrays(particle_descr_,it); }
+
+  /// Return the number of particles in the ib'th array of the given type
+  int array_size (int it, int ib) const
+  { return particle_data_->array_size(particle_descr_,it,ib); }
+
   /// Return the number of batches of particles for the given type.
 
   int num_batches (int it) const
@@ -7,6 +7,7 @@
 
 #include "data.hpp"
 #include <algorithm>
+#include <cstring>
 
 // #define DEBUG_PARTICLES
 
@@ -17,7 +18,10 @@ int64_t ParticleData::counter[CONFIG_NODE_SIZE] = {0};
 ParticleData::ParticleData()
   : attribute_array_(),
     attribute_align_(),
-    particle_count_()
+    particle_count_(),
+    slab_array_(),
+    slab_align_(),
+    slab_capacity_()
 {
   ++counter[cello::index_static()]; 
 }
@@ -29,7 +33,10 @@ bool ParticleData::operator== (const ParticleData & particle_data) throw ()
   return 
     (attribute_array_ == particle_data.attribute_array_) &&
     (attribute_align_ == particle_data.attribute_align_) &&
-    (particle_count_  == particle_data.particle_count_);
+    (particle_count_  == particle_data.particle_count_) &&
+    (slab_array_      == particle_data.slab_array_) &&
+    (slab_align_      == particle_data.slab_align_) &&
+    (slab_capacity_   == particle_data.slab_capacity_);
 }
 
 //----------------------------------------------------------------------
@@ -39,6 +46,9 @@ void ParticleData::pup (PUP::er &p)
   p | attribute_array_;
   p | attribute_align_;
   p | particle_count_;
+  p | slab_array_;
+  p | slab_align_;
+  p | slab_capacity_;
 }
 
 //----------------------------------------------------------------------
@@ -59,20 +69,62 @@ char * ParticleData::attribute_array (ParticleDescr * particle_descr,
 
   char * array = NULL;
   if ( in_range ) {
-    int offset = particle_descr->attribute_offset(it,ia);
-    int align =  attribute_align_[it][ib];
-    array = &attribute_array_[it][ib][0] + (offset + align);
+    if (particle_descr->slab()) {
+      int batch_bytes;
+      array = slab_attribute_(particle_descr,it,ia,&batch_bytes);
+      array += ib*batch_bytes;
+    } else {
+      int offset = particle_descr->attribute_offset(it,ia);
+      int align =  attribute_align_[it][ib];
+      array = &attribute_array_[it][ib][0] + (offset + align);
+    }
   }
   return array;
 }
 
 //----------------------------------------------------------------------
 
+char * ParticleData::attribute_array (ParticleDescr * particle_descr,
+				      int it,int ia)
+{
+  ASSERT("ParticleData::attribute_array()",
+	 "Accessing all particles of a type requires Particle:slab",
+	 particle_descr->slab());
+
+  compress_slab_(particle_descr,it);
+
+  return attribute_array (particle_descr,it,ia,0);
+}
+
+//----------------------------------------------------------------------
+
 int ParticleData::num_batches (int it) const
 {
-  if ( !(0 <= it && it < (int) attribute_array_.size() )) return 0;
+  if ( !(0 <= it && it < (int) particle_count_.size() )) return 0;
+
+  return particle_count_[it].size();
+}
+
+//----------------------------------------------------------------------
+
+int ParticleData::num_arrays (ParticleDescr * particle_descr, int it)
+{
+  if (particle_descr->slab()) {
+    compress_slab_(particle_descr,it);
+    return (num_batches(it) > 0) ? 1 : 0;
+  } else {
+    return num_batches(it);
+  }
+}
 
-  return attribute_array_[it].size();
+//----------------------------------------------------------------------
+
+int ParticleData::array_size
+(ParticleDescr * particle_descr, int it, int ib) const
+{
+  return particle_descr->slab() ?
+    num_particles(particle_descr,it) :
+    num_particles(particle_descr,it,ib);
 }
 
 //----------------------------------------------------------------------
@@ -146,6 +198,14 @@ int ParticleData::insert_particles
 
   int np_left = np;
 
+  const bool slab = particle_descr->slab();
+
+  if (slab) {
+    // grow slab once for all new batches
+    reserve_slab_ (particle_descr,it,
+		   ib_last + (ip_last + np + mb - 1) / mb);
+  }
+
   while (np_left > 0) {
 
     // number of particles to add in this batch
@@ -158,8 +218,10 @@ int ParticleData::insert_particles
 	     "Trying to insert negative particles: ib_this = %d",
 	      ib_this, ib_this >= 0);
 
-      attribute_array_[it].resize(ib_this+1);
-      attribute_align_[it].resize(ib_this+1);
+      if (! slab) {
+	attribute_array_[it].resize(ib_this+1);
+	attribute_align_[it].resize(ib_this+1);
+      }
       particle_count_ [it].resize(ib_this+1);
     }
 
@@ -377,6 +439,11 @@ void ParticleData::compress (ParticleDescr * particle_descr)
 
 void ParticleData::compress (ParticleDescr * particle_descr, int it)
 {
+  if (particle_descr->slab()) {
+    compress_slab_(particle_descr,it);
+    return;
+  }
+
   const int nb = num_batches(it);
   const int mb = particle_descr->batch_size();
   const int na = particle_descr->num_attributes(it);
@@ -731,6 +798,7 @@ void ParticleData::update_position_int_
 
 int ParticleData::data_size (ParticleDescr * particle_descr) const
 {
+  if (particle_descr->slab()) return data_size_slab_(particle_descr);
 
   int size = 0;
   const int nt = particle_descr->num_types();
@@ -771,6 +839,8 @@ int ParticleData::data_size (ParticleDescr * particle_descr) const
 char * ParticleData::save_data (ParticleDescr * particle_descr,
 				char * buffer) const
 {
+  if (particle_descr->slab()) return save_data_slab_(particle_descr,buffer);
+
   union {
     int  * pi;
     char * pc;
@@ -846,6 +916,8 @@ char * ParticleData::save_data (ParticleDescr * particle_descr,
 char * ParticleData::load_data (ParticleDescr * particle_descr,
 				char * buffer)
 {
+  if (particle_descr->slab()) return load_data_slab_(particle_descr,buffer);
+
   // NOTE: integers stored first, then char's, to avoid alignment issues
 
   union {
@@ -1028,6 +1100,9 @@ void ParticleData::resize_attribute_array_
   // store number of particles allocated
   particle_count_[it][ib] = np;
 
+  // (slab storage is allocated by reserve_slab_())
+  if (particle_descr->slab()) return;
+
   const int mp = particle_descr->particle_bytes(it);
 
   if (!particle_descr->interleaved(it)) {
@@ -1052,6 +1127,278 @@ void ParticleData::resize_attribute_array_
 
 //----------------------------------------------------------------------
 
+void ParticleData::reserve_slab_
+(ParticleDescr * particle_descr, int it, int nb)
+{
+  const int nb_old = slab_capacity_[it];
+
+  if (nb <= nb_old) return;
+
+  // grow geometrically for amortized constant-time insertion
+
+  const int nb_new = std::max(nb,2*nb_old);
+
+  const int mb = particle_descr->batch_size();
+  const int mp = particle_descr->particle_bytes(it);
+
+  std::vector<char> array (size_t(nb_new)*mb*mp + (PARTICLE_ALIGN - 1));
+  uintptr_t iarray = (uintptr_t) array.data();
+  int defect = (iarray % PARTICLE_ALIGN);
+  const int align = (defect == 0) ? 0 : PARTICLE_ALIGN-defect;
+
+  // move existing batches
+
+  const int nb_used = num_batches(it);
+
+  if (nb_old > 0 && nb_used > 0) {
+    const char * base_old = slab_array_[it].data() + slab_align_[it];
+    char * base_new = array.data() + align;
+    if (particle_descr->interleaved(it)) {
+      std::memcpy (base_new,base_old,size_t(nb_used)*mb*mp);
+    } else {
+      const int na = particle_descr->num_attributes(it);
+      for (int ia=0; ia<na; ia++) {
+	const size_t offset = particle_descr->attribute_offset(it,ia);
+	const int ny = particle_descr->attribute_bytes(it,ia);
+	std::memcpy (base_new + nb_new*offset,
+		     base_old + nb_old*offset,
+		     size_t(nb_used)*mb*ny);
+      }
+    }
+  }
+
+  slab_array_[it].swap(array);
+  slab_align_[it] = align;
+  slab_capacity_[it] = nb_new;
+}
+
+//----------------------------------------------------------------------
+
+char * ParticleData::slab_attribute_
+(ParticleDescr * particle_descr, int it, int ia, int * batch_bytes) const
+{
+  const int mb = particle_descr->batch_size();
+
+  // attribute_offset() is the offset within a particle if interleaved,
+  // else within a batch, so scale by capacity for non-interleaved
+
+  size_t offset = particle_descr->attribute_offset(it,ia);
+  if (particle_descr->interleaved(it)) {
+    (*batch_bytes) = mb*particle_descr->particle_bytes(it);
+  } else {
+    (*batch_bytes) = mb*particle_descr->attribute_bytes(it,ia);
+    offset *= slab_capacity_[it];
+  }
+  return (char *)(slab_array_[it].data()) + slab_align_[it] + offset;
+}
+
+//----------------------------------------------------------------------
+
+void ParticleData::compress_slab_ (ParticleDescr * particle_descr, int it)
+{
+  const int nb = num_batches(it);
+  const int mb = particle_descr->batch_size();
+
+  // return if already compressed
+
+  int ib_gap = 0;
+  while (ib_gap < nb-1 && particle_count_[it][ib_gap] == mb) ib_gap++;
+  if (ib_gap >= nb-1 && (nb == 0 || particle_count_[it][nb-1] > 0)) return;
+
+  // Batches are consecutive in each attribute's array, so particle
+  // i = ip + mb*ib is at offset i*bytes.  Move particles down to fill
+  // gaps, keeping their order (destination never follows source)
+
+  const bool interleaved = particle_descr->interleaved(it);
+  const int na = particle_descr->num_attributes(it);
+  const int mp = particle_descr->particle_bytes(it);
+
+  std::vector<char *> array(na);
+  for (int ia=0; ia<na; ia++) {
+    int batch_bytes;
+    array[ia] = slab_attribute_(particle_descr,it,ia,&batch_bytes);
+  }
+
+  int i_dst = ib_gap*mb;
+  for (int ib=ib_gap; ib<nb; ib++) {
+    const int np = particle_count_[it][ib];
+    for (int ip=0; ip<np; ip++) {
+      const int i_src = ip + mb*ib;
+      if (i_src != i_dst) {
+	if (interleaved) {
+	  // copy whole particle
+	  char * a = slab_array_[it].data() + slab_align_[it];
+	  std::memcpy (a + size_t(i_dst)*mp, a + size_t(i_src)*mp, mp);
+	} else {
+	  for (int ia=0; ia<na; ia++) {
+	    const int ny = particle_descr->attribute_bytes(it,ia);
+	    std::memcpy (array[ia] + size_t(i_dst)*ny,
+			 array[ia] + size_t(i_src)*ny, ny);
+	  }
+	}
+      }
+      ++i_dst;
+    }
+  }
+
+  // update batch counts
+
+  const int nb_new = (i_dst + mb - 1) / mb;
+  particle_count_[it].resize(nb_new);
+  for (int ib=0; ib<nb_new; ib++) {
+    particle_count_[it][ib] = std::min(mb, i_dst - ib*mb);
+  }
+}
+
+//----------------------------------------------------------------------
+
+int ParticleData::data_size_slab_ (ParticleDescr * particle_descr) const
+{
+  const int nt = particle_descr->num_types();
+  const int mb = particle_descr->batch_size();
+
+  // number of types
+  int size = sizeof(int);
+
+  for (int it=0; it<nt; it++) {
+    const int nb = num_batches(it);
+    // number of batches and particle_count_[it] values
+    size += (1 + nb)*sizeof(int);
+    // attribute values for allocated batches
+    size += nb*mb*particle_descr->particle_bytes(it);
+  }
+  return size;
+}
+
+//----------------------------------------------------------------------
+
+char * ParticleData::save_data_slab_
+(ParticleDescr * particle_descr, char * buffer) const
+{
+  union {
+    int  * pi;
+    char * pc;
+  };
+
+  // NOTE: integers stored first, then char's, to avoid alignment issues
+
+  pc = (char *) buffer;
+
+  const int nt = (*pi++) = particle_descr->num_types();
+  const int mb = particle_descr->batch_size();
+
+  for (int it=0; it<nt; it++) {
+    const int nb = (*pi++) = num_batches(it);
+    for (int ib=0; ib<nb; ib++) {
+      (*pi++) = particle_count_[it][ib];
+    }
+  }
+
+  // store attribute arrays as if capacity were num_batches()
+
+  for (int it=0; it<nt; it++) {
+    const int nb = num_batches(it);
+    if (nb == 0) continue;
+    int batch_bytes;
+    if (particle_descr->interleaved(it)) {
+      const char * array = slab_array_[it].data() + slab_align_[it];
+      const size_t n = size_t(nb)*mb*particle_descr->particle_bytes(it);
+      std::memcpy (pc,array,n);
+      pc += n;
+    } else {
+      const int na = particle_descr->num_attributes(it);
+      for (int ia=0; ia<na; ia++) {
+	const char * array = slab_attribute_(particle_descr,it,ia,&batch_bytes);
+	const size_t n = size_t(nb)*batch_bytes;
+	std::memcpy (pc,array,n);
+	pc += n;
+      }
+    }
+  }
+
+  ASSERT2("ParticleData::save_data_slab_()",
+	  "Buffer has size %ld but expecting size %d",
+	  (pc-buffer),data_size(particle_descr),
+	  ((pc-buffer) == data_size(particle_descr)));
+
+  return pc;
+}
+
+//----------------------------------------------------------------------
+
+char * ParticleData::load_data_slab_
+(ParticleDescr * particle_descr, char * buffer)
+{
+  union {
+    int  * pi;
+    char * pc;
+  };
+
+  pc = (char *) buffer;
+
+  const int nt = (*pi++);
+
+  ASSERT1("ParticleData::load_data_slab_",
+	  "Trying to allocate negative particle types: nt = %d",
+	  nt, nt >= 0);
+
+  attribute_array_.resize(nt);
+  attribute_align_.resize(nt);
+  particle_count_.resize(nt);
+  slab_array_.resize(nt);
+  slab_align_.resize(nt);
+  slab_capacity_.resize(nt);
+
+  for (int it=0; it<nt; it++) {
+
+    const int nb = (*pi++);
+
+    ASSERT1("ParticleData::load_data_slab_",
+	    "Trying to allocate negative particle batches: nb = %d",
+	    nb, nb >= 0);
+
+    // allocate slab for exactly nb batches
+    particle_count_[it].clear();
+    slab_array_[it].clear();
+    slab_capacity_[it] = 0;
+    reserve_slab_(particle_descr,it,nb);
+
+    particle_count_[it].resize(nb);
+    for (int ib=0; ib<nb; ib++) {
+      particle_count_[it][ib] = (*pi++);
+    }
+  }
+
+  for (int it=0; it<nt; it++) {
+    const int nb = num_batches(it);
+    if (nb == 0) continue;
+    const int mb = particle_descr->batch_size();
+    int batch_bytes;
+    if (particle_descr->interleaved(it)) {
+      char * array = slab_array_[it].data() + slab_align_[it];
+      const size_t n = size_t(nb)*mb*particle_descr->particle_bytes(it);
+      std::memcpy (array,pc,n);
+      pc += n;
+    } else {
+      const int na = particle_descr->num_attributes(it);
+      for (int ia=0; ia<na; ia++) {
+	char * array = slab_attribute_(particle_descr,it,ia,&batch_bytes);
+	const size_t n = size_t(nb)*batch_bytes;
+	std::memcpy (array,pc,n);
+	pc += n;
+      }
+    }
+  }
+
+  ASSERT2("ParticleData::load_data_slab_()",
+	  "Buffer has size %ld but expecting size %d",
+	  (pc-buffer),data_size(particle_descr),
+	  ((pc-buffer) == data_size(particle_descr)));
+  return pc;
+}
+
+//----------------------------------------------------------------------
+
 void ParticleData::check_arrays_ (ParticleDescr * particle_descr,
 		    std::string file, int line) const
 {
@@ -1072,6 +1419,23 @@ void ParticleData::check_arrays_ (ParticleDescr * particle_descr,
 	   attribute_align_.size(),nt,
 	   attribute_align_.size()>=nt);
 
+  if (particle_descr->slab()) {
+    ASSERT4 ("ParticleData::check_arrays_",
+	     "%s:%d slab_capacity_ is size %lu < %lu",
+	     file.c_str(),line,
+	     slab_capacity_.size(),nt,
+	     slab_capacity_.size()>=nt);
+    for (size_t it=0; it<nt; it++) {
+      size_t nb = num_batches(it);
+      ASSERT5 ("ParticleData::check_arrays_",
+	       "%s:%d slab_capacity_[%lu] is %d < %lu",
+	       file.c_str(),line,
+	       it,slab_capacity_[it],nb,
+	       size_t(slab_capacity_[it])>=nb);
+    }
+    return;
+  }
+
   for (size_t it=0; it<nt; it++) {
     size_t nb = num_batches(it);
 
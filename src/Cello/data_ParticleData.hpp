@@ -37,6 +37,9 @@ public: // interface
     attribute_array_ = particle_data.attribute_array_;
     attribute_align_ = particle_data.attribute_align_;
     particle_count_  = particle_data.particle_count_;
+    slab_array_      = particle_data.slab_array_;
+    slab_align_      = particle_data.slab_align_;
+    slab_capacity_   = particle_data.slab_capacity_;
   }
   
   /// CHARM++ Pack / Unpack function
@@ -50,10 +53,27 @@ public: // interface
       ((ParticleData*)this) -> attribute_array (pd,it,ia,ib);
   }
 
+  /// Return the attribute array for all particles of the given type.
+  /// Requires slab storage, in which batches are consecutive views
+  /// into one array per type and attribute.  Compresses the type
+  /// first if any batch but the last is partially full.
+  char * attribute_array (ParticleDescr *pd, int it, int ia);
+
   /// Return the number of batches of particles for the given type.
 
   int num_batches (int it) const;
 
+  /// Return the number of attribute arrays to loop over: num_batches(),
+  /// or with slab storage 1 (0 if empty) after compressing, since then
+  /// the first batch's attribute arrays span all particles of the type
+
+  int num_arrays (ParticleDescr *, int it);
+
+  /// Return the number of particles in the ib'th attribute array
+  /// counted by num_arrays()
+
+  int array_size (ParticleDescr *, int it, int ib) const;
+
   /// Return the number of particles in the given batch, of the given
   /// type, or total on the block.
 
@@ -93,7 +113,9 @@ public: // interface
 
   /// Compress particles in batches so that all batches except
   /// possibly the last have batch_size() particles.  May be performed
-  /// periodically to recover unused memory from multiple insert/deletes
+  /// periodically to recover unused memory from multiple insert/deletes.
+  /// With slab storage particles are moved in place, keeping their
+  /// order, and trailing empty batches are removed
 
   void compress (ParticleDescr *);
   void compress (ParticleDescr *, int it);
@@ -132,6 +154,11 @@ public: // interface
     if (particle_count_.size() < nt) {
       particle_count_.resize(nt);
     }
+    if (slab_array_.size() < nt) {
+      slab_array_.resize(nt);
+      slab_align_.resize(nt,0);
+      slab_capacity_.resize(nt,0);
+    }
   };
 
   /// Fill a vector of position coordinates for the given type and batch
@@ -180,6 +207,25 @@ private: /// functions
   /// with updated attribute_align_
   void resize_attribute_array_ (ParticleDescr *, int it, int ib, int np);
 
+  /// With slab storage, grow slab_array_[it] geometrically if needed
+  /// to hold at least nb batches, moving existing batches
+  void reserve_slab_ (ParticleDescr *, int it, int nb);
+
+  /// With slab storage, return the start of the given attribute's
+  /// data for the first batch, and the number of bytes between batches
+  char * slab_attribute_ (ParticleDescr *, int it, int ia,
+			  int * batch_bytes) const;
+
+  /// With slab storage, move particles in place to fill gaps left by
+  /// deleted particles, and remove trailing empty batches
+  void compress_slab_ (ParticleDescr *, int it);
+
+  /// Slab storage versions of data_size(), save_data(), and
+  /// load_data().  Only the allocated batches are serialized
+  int data_size_slab_ (ParticleDescr *) const;
+  char * save_data_slab_ (ParticleDescr *, char * buffer) const;
+  char * load_data_slab_ (ParticleDescr *, char * buffer);
+
   void check_arrays_ (ParticleDescr * particle_descr,
 		      std::string file, int line) const;
 
@@ -229,6 +275,19 @@ private: /// attributes
   /// Number of particles in the batch particle_count_[it][ib];
   std::vector < std::vector < int > > particle_count_;
 
+  /// With slab storage, a single array slab_array_[it] holding all
+  /// batches of each type.  Interleaved types store batches
+  /// consecutively; otherwise each attribute has its own region of
+  /// slab_capacity_[it] batches, so that an attribute's values for
+  /// all particles of the type are contiguous
+  std::vector< std::vector<char> > slab_array_;
+
+  /// Alignment adjustment for the start of slab_array_[it]
+  std::vector< char > slab_align_;
+
+  /// Number of batches allocated in slab_array_[it]
+  std::vector< int > slab_capacity_;
+
 };
 
 #endif /* DATA_PARTICLE_DATA_HPP */
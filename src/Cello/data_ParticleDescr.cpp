@@ -38,7 +38,8 @@ ParticleDescr::ParticleDescr() throw()
     attribute_interleaved_(),
     attribute_offset_(),
     groups_(),
-    batch_size_(0)
+    batch_size_(0),
+    slab_(false)
 {
 }
 
@@ -65,6 +66,7 @@ void ParticleDescr::pup (PUP::er &p)
   p | attribute_offset_;
   p | groups_;
   p | batch_size_;
+  p | slab_;
 }
 
 //----------------------------------------------------------------------
@@ -173,6 +173,15 @@ public: // interface
 
   int batch_size() const;
 
+  /// Set whether each type's batches are views into a single
+  /// contiguous "slab" array instead of separately allocated
+  void set_slab(bool slab)
+  { slab_ = slab; }
+
+  /// Return whether particle data uses slab storage
+  bool slab() const
+  { return slab_; }
+
   /// Return the batch and particle indices given a global particle
   /// index i.  This is useful e.g. for iterating over a range of
   /// particles, e.g. initializing new particles after insert().
@@ -282,6 +291,9 @@ private: // attributes
   /// deallocated, and operated on a batch at a time
 
   int batch_size_;
+
+  /// Whether each type's batches are stored in one contiguous array
+  bool slab_;
   
 };
 
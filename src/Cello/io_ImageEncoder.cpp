@@ -0,0 +1,232 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     io_ImageEncoder.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-19
+/// @brief    Implementation of the ImageEncoder class
+
+#include "io.hpp"
+
+#include <zlib.h>
+
+//----------------------------------------------------------------------
+
+/// Write a big-endian 32-bit integer
+static void put_uint32_ (unsigned char * buffer, unsigned long value)
+{
+  buffer[0] = (value >> 24) & 0xff;
+  buffer[1] = (value >> 16) & 0xff;
+  buffer[2] = (value >>  8) & 0xff;
+  buffer[3] = (value      ) & 0xff;
+}
+
+//----------------------------------------------------------------------
+
+/// Write a PNG chunk with the given type and data
+static void write_chunk_
+(FILE * fp, const char * type, const unsigned char * data, size_t length)
+{
+  unsigned char buffer[4];
+  put_uint32_(buffer,length);
+  fwrite (buffer,1,4,fp);
+  fwrite (type,1,4,fp);
+  if (length > 0) fwrite (data,1,length,fp);
+  unsigned long crc = crc32(0L,Z_NULL,0);
+  crc = crc32(crc,(const Bytef *)type,4);
+  if (length > 0) crc = crc32(crc,data,length);
+  put_uint32_(buffer,crc);
+  fwrite (buffer,1,4,fp);
+}
+
+//----------------------------------------------------------------------
+
+ImageEncoder::ImageEncoder
+(int nx, int ny, int bit_depth, int num_bands, int level) throw()
+  : nx_(nx),
+    ny_(ny),
+    bit_depth_(bit_depth),
+    num_bands_(std::max(1,std::min(num_bands,ny))),
+    level_(level),
+    rgb_(),
+    band_data_(),
+    band_adler_(),
+    band_length_()
+{
+  ASSERT1 ("ImageEncoder::ImageEncoder()",
+           "bit_depth %d must be 8 or 16",
+           bit_depth, (bit_depth == 8 || bit_depth == 16));
+
+  rgb_.resize(row_bytes_()*ny_,0);
+  band_data_.resize(num_bands_);
+  band_adler_.resize(num_bands_,0);
+  band_length_.resize(num_bands_,0);
+}
+
+//----------------------------------------------------------------------
+
+void ImageEncoder::band_rows
+(int band, int * iy_begin, int * iy_end) const throw()
+{
+  (*iy_begin) = (ny_*band)     / num_bands_;
+  (*iy_end)   = (ny_*(band+1)) / num_bands_;
+}
+
+//----------------------------------------------------------------------
+
+void ImageEncoder::encode_band (int band) throw()
+{
+  int iy_begin, iy_end;
+  band_rows (band,&iy_begin,&iy_end);
+
+  // Filter rows using the PNG "Sub" filter (type 1)
+
+  const size_t mr = row_bytes_();
+  const int bpp = 3*bytes_();
+  const size_t n = (iy_end - iy_begin)*(mr + 1);
+
+  std::vector<unsigned char> filtered (n);
+  for (int iy=iy_begin; iy<iy_end; iy++) {
+    const unsigned char * row = &rgb_[mr*iy];
+    unsigned char * out = &filtered[(mr+1)*(iy-iy_begin)];
+    out[0] = 1;
+    for (int i=0; i<bpp; i++) out[1+i] = row[i];
+    for (size_t i=bpp; i<mr; i++) out[1+i] = row[i] - row[i-bpp];
+  }
+
+  band_adler_[band]  = adler32(adler32(0L,Z_NULL,0),filtered.data(),n);
+  band_length_[band] = n;
+
+  // Deflate as a raw stream; all but the last band end with a sync
+  // flush so that compressed bands can be concatenated
+
+  z_stream stream;
+  stream.zalloc = Z_NULL;
+  stream.zfree  = Z_NULL;
+  stream.opaque = Z_NULL;
+  int err = deflateInit2
+    (&stream,level_,Z_DEFLATED,-15,8,Z_DEFAULT_STRATEGY);
+  ASSERT1 ("ImageEncoder::encode_band()",
+           "deflateInit2() returned error %d",
+           err, (err == Z_OK));
+
+  const bool is_last = (band == num_bands_ - 1);
+  const int flush = is_last ? Z_FINISH : Z_SYNC_FLUSH;
+
+  std::vector<unsigned char> & out = band_data_[band];
+  out.resize(deflateBound(&stream,n) + 16);
+
+  stream.next_in  = filtered.data();
+  stream.avail_in = n;
+  stream.next_out  = out.data();
+  stream.avail_out = out.size();
+
+  do {
+    if (stream.avail_out == 0) {
+      const size_t size = out.size();
+      out.resize(2*size);
+      stream.next_out  = out.data() + size;
+      stream.avail_out = size;
+    }
+    err = deflate (&stream,flush);
+    ASSERT1 ("ImageEncoder::encode_band()",
+             "deflate() returned error %d",
+             err, (err == Z_OK || err == Z_STREAM_END || err == Z_BUF_ERROR));
+  } while (stream.avail_out == 0 ||
+           (is_last && err != Z_STREAM_END));
+
+  out.resize(stream.total_out);
+  deflateEnd(&stream);
+}
+
+//----------------------------------------------------------------------
+
+void ImageEncoder::write_png (std::string file_name) const throw()
+{
+  FILE * fp = fopen (file_name.c_str(),"wb");
+
+  ASSERT1 ("ImageEncoder::write_png()",
+           "Cannot open file %s for writing",
+           file_name.c_str(), (fp != NULL));
+
+  const unsigned char signature[8] =
+    { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+  fwrite (signature,1,8,fp);
+
+  // IHDR: RGB, no interlacing
+
+  unsigned char header[13];
+  put_uint32_(header+0,nx_);
+  put_uint32_(header+4,ny_);
+  header[8]  = bit_depth_;
+  header[9]  = 2;
+  header[10] = 0;
+  header[11] = 0;
+  header[12] = 0;
+  write_chunk_(fp,"IHDR",header,13);
+
+  // gAMA: same file gamma as pngwriter
+
+  unsigned char gamma[4];
+  put_uint32_(gamma,60000);
+  write_chunk_(fp,"gAMA",gamma,4);
+
+  // IDAT: zlib header, concatenated bands, combined Adler-32
+
+  size_t size = 2 + 4;
+  for (int band=0; band<num_bands_; band++) size += band_data_[band].size();
+
+  std::vector<unsigned char> idat (size);
+  const int level_flag = (level_ == Z_DEFAULT_COMPRESSION) ? 2 :
+    ((level_ < 2) ? 0 : ((level_ < 6) ? 1 : ((level_ == 6) ? 2 : 3)));
+  idat[0] = 0x78;
+  idat[1] = level_flag << 6;
+  idat[1] += (31 - (idat[0]*256 + idat[1]) % 31) % 31;
+
+  unsigned long adler = adler32(0L,Z_NULL,0);
+  size_t i = 2;
+  for (int band=0; band<num_bands_; band++) {
+    const std::vector<unsigned char> & data = band_data_[band];
+    if (data.size() > 0) memcpy (&idat[i],data.data(),data.size());
+    i += data.size();
+    adler = adler32_combine(adler,band_adler_[band],band_length_[band]);
+  }
+  put_uint32_(&idat[i],adler);
+
+  write_chunk_(fp,"IDAT",idat.data(),idat.size());
+  write_chunk_(fp,"IEND",NULL,0);
+
+  fclose (fp);
+}
+
+//----------------------------------------------------------------------
+
+void ImageEncoder::write_raw (std::string file_name) const throw()
+{
+  ASSERT1 ("ImageEncoder::write_raw()",
+           "bit_depth %d must be 8 for raw images",
+           bit_depth_, (bit_depth_ == 8));
+
+  write_raw (file_name,nx_,ny_,3,1,false,rgb_.data());
+}
+
+//----------------------------------------------------------------------
+
+void ImageEncoder::write_raw
+(std::string file_name,
+ int nx, int ny, int num_channels, int bytes, bool is_float,
+ const void * data) throw()
+{
+  FILE * fp = fopen (file_name.c_str(),"wb");
+
+  ASSERT1 ("ImageEncoder::write_raw()",
+           "Cannot open file %s for writing",
+           file_name.c_str(), (fp != NULL));
+
+  const int32_t header[6] =
+    { 1, nx, ny, num_channels, bytes, is_float ? 1 : 0 };
+  fwrite ("CELLORAW",1,8,fp);
+  fwrite (header,sizeof(int32_t),6,fp);
+  fwrite (data,bytes,size_t(nx)*ny*num_channels,fp);
+
+  fclose (fp);
+}
@@ -0,0 +1,120 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     io_ImageEncoder.hpp
+/// @author   agent (agent@local)
+/// @date     2026-10-19
+/// @brief    [\ref Io] Declaration of the ImageEncoder class
+
+#ifndef IO_IMAGE_ENCODER_HPP
+#define IO_IMAGE_ENCODER_HPP
+
+class ImageEncoder {
+
+  /// @class    ImageEncoder
+  /// @ingroup  Io
+  /// @brief    [\ref Io] Encode RGB images as PNG or raw image files
+  ///
+  /// @details ImageEncoder holds an RGB image split into horizontal
+  /// bands of rows.  Each band is filtered and deflated independently
+  /// by encode_band(), which may be called concurrently for
+  /// different bands; write_png() then joins the compressed bands
+  /// into a single zlib stream in a valid PNG file.  Rows are ordered
+  /// top to bottom.
+
+public: // interface
+
+  /// Constructor for an nx by ny image with the given bit depth (8
+  /// or 16), number of bands, and zlib compression level
+  ImageEncoder (int nx, int ny, int bit_depth = 16,
+                int num_bands = 1, int level = 6) throw();
+
+  /// Return the image width
+  int nx() const throw() { return nx_; }
+
+  /// Return the image height
+  int ny() const throw() { return ny_; }
+
+  /// Return the number of bands
+  int num_bands() const throw() { return num_bands_; }
+
+  /// Return the range of rows [*iy_begin, *iy_end) in the given band
+  void band_rows (int band, int * iy_begin, int * iy_end) const throw();
+
+  /// Set the color of pixel (ix,iy), with iy = 0 the top row and
+  /// color components in [0,1]
+  void set_pixel (int ix, int iy, double r, double g, double b) throw()
+  {
+    const int nc = (bit_depth_ == 16) ? 65535 : 255;
+    const int c3[3] = { clamp_(int(r*nc),nc),
+                        clamp_(int(g*nc),nc),
+                        clamp_(int(b*nc),nc) };
+    unsigned char * pixel = &rgb_[row_bytes_()*iy + 3*bytes_()*ix];
+    for (int i=0; i<3; i++) {
+      if (bit_depth_ == 16) {
+        *pixel++ = c3[i] >> 8;
+        *pixel++ = c3[i] & 0xff;
+      } else {
+        *pixel++ = c3[i];
+      }
+    }
+  }
+
+  /// Filter and compress the rows of the given band
+  void encode_band (int band) throw();
+
+  /// Write the PNG file; encode_band() must have been called for
+  /// all bands
+  void write_png (std::string file_name) const throw();
+
+  /// Write the uncompressed 8-bit RGB image with a raw image header
+  void write_raw (std::string file_name) const throw();
+
+  /// Write an uncompressed image with a raw image header: a 32-byte
+  /// header "CELLORAW" followed by six 32-bit integers (version, nx,
+  /// ny, channels, bytes per channel, and 1 if floating-point or 0
+  /// otherwise) in host byte order, then pixel data by rows from top
+  /// to bottom
+  static void write_raw (std::string file_name,
+                         int nx, int ny, int num_channels,
+                         int bytes, bool is_float,
+                         const void * data) throw();
+
+private: // functions
+
+  int bytes_() const
+  { return bit_depth_ / 8; }
+
+  size_t row_bytes_() const
+  { return size_t(3*bytes_())*nx_; }
+
+  static int clamp_ (int c, int nc)
+  { return (c < 0) ? 0 : ((c > nc) ? nc : c); }
+
+private: // attributes
+
+  /// Image size
+  int nx_;
+  int ny_;
+
+  /// Bits per color component: 8 or 16
+  int bit_depth_;
+
+  /// Number of bands of rows compressed independently
+  int num_bands_;
+
+  /// zlib compression level
+  int level_;
+
+  /// Pixel colors in PNG byte order, rows top to bottom
+  std::vector<unsigned char> rgb_;
+
+  /// Compressed data for each band
+  std::vector< std::vector<unsigned char> > band_data_;
+
+  /// Adler-32 checksum and length of the uncompressed data of each band
+  std::vector<unsigned long> band_adler_;
+  std::vector<size_t>        band_length_;
+
+};
+
+#endif /* IO_IMAGE_ENCODER_HPP */
@@ -221,6 +221,23 @@ public: // virtual functions
   virtual void cleanup_remote (int * n, char ** buffer) throw()
   {}
 
+  /// Return the number of parts of the output that are reduced and
+  /// written independently, possibly on different processes
+  virtual int num_parts () const throw()
+  { return 1; }
+
+  /// Return the process id of the writer for the given part
+  virtual int process_writer_part (int part) const throw()
+  { return process_writer(); }
+
+  /// Prepare local array with data for the given part
+  virtual void prepare_remote_part (int part, int * n, char ** buffer) throw()
+  { prepare_remote (n,buffer); }
+
+  /// Accumulate data for the given part sent from a remote process
+  virtual void update_remote_part (int part, int n, char * buffer) throw()
+  { update_remote (n,buffer); }
+
 protected:
 
   /// Return the name for the format and given arguments
@@ -7,6 +7,19 @@
 
 #include "cello.hpp"
 #include "io.hpp"
+#include "CkLoopAPI.h"
+
+//----------------------------------------------------------------------
+
+/// CkLoop helper function: call the band function for bands first
+/// through last
+
+static void image_bands_
+(int first, int last, void * result, int num_params, void * params)
+{
+  auto & function = *(std::function<void (int)> *) params;
+  for (int band=first; band<=last; band++) function(band);
+}
 
 //----------------------------------------------------------------------
 
@@ -38,8 +51,9 @@ OutputImage::OutputImage(int index,
     min_value_(min_value),max_value_(max_value),
     nxi_(image_size_x),
     nyi_(image_size_y),
-    png_(NULL),
     image_type_(image_type),
+    image_format_("png"),
+    num_threads_(1),
     face_rank_(face_rank),
     image_log_(image_log),
     image_abs_(image_abs),
@@ -50,15 +64,7 @@ OutputImage::OutputImage(int index,
 
 {
 
-  if      (image_reduce_type=="min") { op_reduce_ = reduce_min; } 
-  else if (image_reduce_type=="max") { op_reduce_ = reduce_max; }
-  else if (image_reduce_type=="avg") { op_reduce_ = reduce_avg; }
-  else if (image_reduce_type=="sum") { op_reduce_ = reduce_sum; }
-  else {
-    ERROR1 ("OutputImage::OutputImage()",
-	    "Unrecognized output_image_reduce_type %s",
-	    image_reduce_type.c_str());
-  }
+  op_reduce_ = reduce_op_(image_reduce_type);
 
   if      (image_mesh_color=="level")   mesh_color_type_ = mesh_color_level;
   else if (image_mesh_color=="process") mesh_color_type_ = mesh_color_process;
@@ -112,17 +118,22 @@ OutputImage::OutputImage(int index,
     image_lower_[axis] = image_lower[axis];
     image_upper_[axis] = image_upper[axis];
   }
+
+  // Default product: first field in field list along image axis
+
+  ImageProduct product;
+  product.name        = "";
+  product.index_field = -1;
+  product.axis        = axis_;
+  product.op_reduce   = op_reduce_;
+  products_.push_back(product);
 }
 
 //----------------------------------------------------------------------
 
 OutputImage::~OutputImage() throw ()
 {
-  delete png_;
-  png_ = NULL;
-  delete [] image_data_;
   image_data_ = NULL;
-  delete [] image_mesh_;
   image_mesh_ = NULL;
 }
 
@@ -144,28 +155,20 @@ void OutputImage::pup (PUP::er &p)
   p | nxi_;
   p | nyi_;
 
-  int has_data = (image_data_ != NULL);
-  p | has_data;
-  if (has_data) {
-    if (p.isUnpacking()) image_data_ = new double [nxi_*nyi_];
-    PUParray(p,image_data_,nxi_*nyi_);
-  } else {
-    image_data_ = NULL;
-  }
+  p | products_;
+  p | image_data_list_;
+  p | image_mesh_list_;
 
-  int has_mesh = (image_mesh_ != NULL);
-  p | has_mesh;
-  if (has_mesh) {
-    if (p.isUnpacking()) image_mesh_ = new double [nxi_*nyi_];
-    PUParray(p,image_mesh_,nxi_*nyi_);
-  } else {
+  if (p.isUnpacking()) {
+    image_data_ = NULL;
     image_mesh_ = NULL;
+    if (image_data_list_.size() > 0) select_product_(0);
   }
-  
-  WARNING("OutputImage::pup","skipping png");
-  // p | *png_;
-  if (p.isUnpacking()) png_ = NULL;
+
+  p | file_name_list_;
   p | image_type_;
+  p | image_format_;
+  p | num_threads_;
   p | min_level_;
   p | max_level_;
   p | leaf_only_;
@@ -196,29 +199,111 @@ void OutputImage::set_colormap
 
 }
 
+//----------------------------------------------------------------------
+
+void OutputImage::clear_products () throw()
+{
+  products_.clear();
+}
+
+//----------------------------------------------------------------------
+
+void OutputImage::add_product
+(std::string name, int index_field, int axis,
+ std::string reduce_type,
+ int n, double * map_r, double * map_g, double * map_b) throw()
+{
+  ASSERT1("OutputImage::add_product",
+	  "axis %d must be 0, 1, or 2",
+	  axis, 0 <= axis && axis < 3);
+
+  ImageProduct product;
+  product.name        = name;
+  product.index_field = index_field;
+  product.axis        = axis;
+  product.op_reduce   = reduce_op_(reduce_type);
+  product.map_r.resize(n);
+  product.map_g.resize(n);
+  product.map_b.resize(n);
+  for (int i=0; i<n; i++) {
+    product.map_r[i] = map_r[i];
+    product.map_g[i] = map_g[i];
+    product.map_b[i] = map_b[i];
+  }
+  products_.push_back(product);
+}
+
+//----------------------------------------------------------------------
+
+void OutputImage::set_format
+(std::string image_format, int num_threads) throw()
+{
+  ASSERT1("OutputImage::set_format",
+	  "Unknown image format %s",
+	  image_format.c_str(),
+	  (image_format == "png" ||
+	   image_format == "raw_uint8" ||
+	   image_format == "raw_float"));
+
+  image_format_ = image_format;
+  num_threads_  = num_threads;
+}
+
 //======================================================================
 
 void OutputImage::init () throw()
 {
   image_create_();
+
+  // Writers of multiple products wait for data from all processes
+  // for each product they write
+
+  if (num_parts() > 1) {
+    int num_written = 0;
+    for (int k=0; k<num_parts(); k++) {
+      if (is_writer_product_(k)) ++num_written;
+    }
+    sync_write_.set_stop(CkNumPes()*num_written);
+  }
 }
 
 //----------------------------------------------------------------------
 
 void OutputImage::open () throw()
 {
-  // Open file if writing a single block
+  // Open file for each product written by this process
+
+  file_name_list_.assign(products_.size(),"");
+
+  bool is_writer = false;
+
+  std::string dir_name = directory();
+
+  for (size_t k=0; k<products_.size(); k++) {
 
-  if (is_writer()) {
+    if (is_writer_product_(k)) {
 
-    std::string file_name = expand_name_ (&file_name_,&file_args_);
+      is_writer = true;
 
-    std::string dir_name = directory();
-    
-    // Create png object
-    Monitor::instance()->print ("Output","writing image file %s", 
-				(dir_name + "/" + file_name).c_str());
-    png_create_(dir_name + "/" + file_name);
+      std::string file_name = expand_name_ (&file_name_,&file_args_);
+
+      // Insert product name before the file extension
+
+      if (products_[k].name != "") {
+	const size_t i_ext = file_name.rfind('.');
+	const std::string suffix = "-" + products_[k].name;
+	if (i_ext == std::string::npos) file_name += suffix;
+	else                            file_name.insert(i_ext,suffix);
+      }
+
+      // Image file is written in close()
+      Monitor::instance()->print ("Output","writing image file %s",
+				  (dir_name + "/" + file_name).c_str());
+      file_name_list_[k] = dir_name + "/" + file_name;
+    }
+  }
+
+  if (is_writer) {
     if (chmod (dir_name.c_str(),0755) == -1) {
       ERROR2 ("OutputImage::open()",
 	      "chmod() return errno %d: error '%s'",
@@ -231,9 +316,11 @@ void OutputImage::open () throw()
 
 void OutputImage::close () throw()
 {
-  if (is_writer()) image_write_();
+  for (size_t k=0; k<products_.size(); k++) {
+    if (is_writer_product_(k)) image_write_(k);
+  }
   image_close_();
-  png_close_();
+  file_name_list_.clear();
 }
 
 //----------------------------------------------------------------------
@@ -254,32 +341,32 @@ void OutputImage::write_block ( const Block *  block ) throw()
   if (! is_active_(block) ) return;
 
   Field field = ((Data *)block->data())->field();
-  
+
   const int rank = cello::rank();
 
-  ASSERT("OutputImage::write_block",
-	 "axis_ must be = axis_z (2) for 2D problems",
-	 ! ( rank == 2 && axis_ != 2));
+  const int num_products = products_.size();
+
+  for (int k=0; k<num_products; k++) {
+    ASSERT("OutputImage::write_block",
+	   "axis_ must be = axis_z (2) for 2D problems",
+	   ! ( rank == 2 && products_[k].axis != 2));
+  }
 
   ASSERT("OutputImage::write_block",
 	 "cannot output rank == 1 problems",
 	 ! ( rank == 1) );
 
-  const int IX = (axis_+1) % 3;
-  const int IY = (axis_+2) % 3;
-  const int IZ = (axis_+0) % 3;
-
   // Field block size
   int nb3[3];
   field.size(&nb3[0],&nb3[1],&nb3[2]);
 
   const int level = block->level();
 
-  // Index of (single) field to write
+  // Index of default field to write
 
   it_field_index_->first();
 
-  int index_field = (it_field_index_->size() > 0) 
+  const int index_field_default = (it_field_index_->size() > 0)
     ? it_field_index_->value() : -1;
 
   // extents of domain
@@ -299,20 +386,51 @@ void OutputImage::write_block ( const Block *  block ) throw()
   block->lower(bm3,bm3+1,bm3+2);
   block->upper(bp3,bp3+1,bp3+2);
 
-  // image extents of box
-  int ixm, ixp;
-  int iym, iyp;
-  ixm = (bm3[IX]-dm3[IX])/(dp3[IX]-dm3[IX])*nxi_;
-  iym = (bm3[IY]-dm3[IY])/(dp3[IY]-dm3[IY])*nyi_;
-  ixp = (bp3[IX]-dm3[IX])/(dp3[IX]-dm3[IX])*nxi_;
-  iyp = (bp3[IY]-dm3[IY])/(dp3[IY]-dm3[IY])*nyi_;
+  // image extents of box for each product
+  std::vector<int> ixm(num_products), ixp(num_products);
+  std::vector<int> iym(num_products), iyp(num_products);
+  for (int k=0; k<num_products; k++) {
+    const int IX = (products_[k].axis+1) % 3;
+    const int IY = (products_[k].axis+2) % 3;
+    ixm[k] = (bm3[IX]-dm3[IX])/(dp3[IX]-dm3[IX])*nxi_;
+    iym[k] = (bm3[IY]-dm3[IY])/(dp3[IY]-dm3[IY])*nyi_;
+    ixp[k] = (bp3[IX]-dm3[IX])/(dp3[IX]-dm3[IX])*nxi_;
+    iyp[k] = (bp3[IY]-dm3[IY])/(dp3[IY]-dm3[IY])*nyi_;
+  }
 
   double h3[3];
   block->cell_width(h3,h3+1,h3+2);
-  
+
   if (type_is_data_()) {
 
-    if (index_field >= 0) {
+    // Field values, precision, array strides, and projection of
+    // block cells onto image pixels for each product
+
+    struct Projection {
+      const char * values;
+      int precision;
+      int d3[3];
+      double factor;
+      std::vector<int>  jm3[3];
+      std::vector<int>  jp3[3];
+      std::vector<char> in3[3];
+    };
+
+    std::vector<Projection> projection(num_products);
+
+    int m3[3] = {0,0,0};
+    bool is_first = true;
+
+    for (int k=0; k<num_products; k++) {
+
+      Projection & q = projection[k];
+
+      const int index_field = (products_[k].index_field >= 0) ?
+	products_[k].index_field : index_field_default;
+
+      q.values = NULL;
+
+      if (index_field < 0) continue;
 
       // Get ghost depth
 
@@ -326,55 +444,92 @@ void OutputImage::write_block ( const Block *  block ) throw()
       nd3[2] = nb3[2] + 2*ng3[2];
 
       // array offset multipliers
-      int d3[3];
-      d3[0] = 1;
-      d3[1] = nd3[0];
-      d3[2] = (rank >= 3) ? nd3[0]*nd3[1] : 0;
+      q.d3[0] = 1;
+      q.d3[1] = nd3[0];
+      q.d3[2] = (rank >= 3) ? nd3[0]*nd3[1] : 0;
+
+      // number of cells traversed
+      int mk3[3];
+      mk3[0] = ghost_ ? nd3[0] : nb3[0];
+      mk3[1] = ghost_ ? nd3[1] : nb3[1];
+      mk3[2] = ghost_ ? nd3[2] : nb3[2];
+
+      if (is_first) {
+	for (int i=0; i<3; i++) m3[i] = mk3[i];
+	is_first = false;
+      }
 
-      // add block contribution to image
+      ASSERT("OutputImage::write_block",
+	     "image product fields must have equal ghost depths "
+	     "when image_ghost is true",
+	     (mk3[0]==m3[0] && mk3[1]==m3[1] && mk3[2]==m3[2]));
 
-      const char * field_values = (ghost_) ? 
+      q.values = (ghost_) ?
 	field.values(index_field) :
 	field.unknowns(index_field);
 
-      float  * field_float  = (float*)field_values;
-      double * field_double = (double*)field_values;
-
-      const int precision = field.precision(index_field);
-
-      double factor = (nb3[IZ] > 1) ? 1.0 / pow(2.0,1.0*level) : 1.0;
-      if (rank >= 2 && (std::abs(dm3[IZ] - dp3[IZ]) < h3[IZ])) factor = 1.0;
-      
-      int m3[3];
-      m3[0] = ghost_ ? nd3[0] : nb3[0];
-      m3[1] = ghost_ ? nd3[1] : nb3[1];
-      m3[2] = ghost_ ? nd3[2] : nb3[2];
-      for (int ix=0; ix<m3[IX]; ix++) {
-	double x = bm3[IX] + (ix+0.5)*(bp3[IX]-bm3[IX])/m3[IX];
-	int jxm = ixm +  ix   *(ixp-ixm)/m3[IX];
-	int jxp = ixm + (ix+1)*(ixp-ixm)/m3[IX]-1;
-	if (dm3[IX] <= x && x <= dp3[IX]) {
-	  for (int iy=0; iy<m3[IY]; iy++) {
-	    double y = bm3[IY] + (iy+0.5)*(bp3[IY]-bm3[IY])/m3[IY];
-	    int jym = iym +  iy   *(iyp-iym)/m3[IY];
-	    int jyp = iym + (iy+1)*(iyp-iym)/m3[IY]-1;
-	    if (dm3[IY] <= y && y <= dp3[IY]) {
-	      for (int iz=0; iz<m3[IZ]; iz++) {
-		double z = bm3[IZ] + (iz+0.5)*(bp3[IZ]-bm3[IZ])/m3[IZ];
-		double zlo = dm3[IZ] - 0.5*h3[IZ];
-		double zhi = dp3[IZ] + 0.5*h3[IZ];
-		if (rank < 3 || (zlo <= z && z <= zhi)) {
-		  int i=ix*d3[IX] + iy*d3[IY] + iz*d3[IZ];
-		  double value = 0.0;
-		  if (precision == precision_single) {
-		    value = field_float[i];
-		  } else if (precision == precision_double) {
-		    value = field_double[i];
-		  }
-		  reduce_box_filled_(image_data_,jxm,jxp,jym,jyp, (value*factor));
-		}
-	      }
+      q.precision = field.precision(index_field);
+
+      const int IX = (products_[k].axis+1) % 3;
+      const int IY = (products_[k].axis+2) % 3;
+      const int IZ = (products_[k].axis+0) % 3;
+
+      q.factor = (nb3[IZ] > 1) ? 1.0 / pow(2.0,1.0*level) : 1.0;
+      if (rank >= 2 && (std::abs(dm3[IZ] - dp3[IZ]) < h3[IZ])) q.factor = 1.0;
+
+      // pixel ranges and inclusion of cells along image axes
+
+      const int IXY[2]  = { IX, IY };
+      const int im2[2] = { ixm[k], iym[k] };
+      const int ip2[2] = { ixp[k], iyp[k] };
+      for (int a=0; a<2; a++) {
+	const int I = IXY[a];
+	q.jm3[I].resize(m3[I]);
+	q.jp3[I].resize(m3[I]);
+	q.in3[I].resize(m3[I]);
+	for (int i=0; i<m3[I]; i++) {
+	  double x = bm3[I] + (i+0.5)*(bp3[I]-bm3[I])/m3[I];
+	  q.jm3[I][i] = im2[a] +  i   *(ip2[a]-im2[a])/m3[I];
+	  q.jp3[I][i] = im2[a] + (i+1)*(ip2[a]-im2[a])/m3[I]-1;
+	  q.in3[I][i] = (dm3[I] <= x && x <= dp3[I]);
+	}
+      }
+
+      // inclusion of cells along reduction axis
+
+      q.in3[IZ].resize(m3[IZ]);
+      for (int iz=0; iz<m3[IZ]; iz++) {
+	double z = bm3[IZ] + (iz+0.5)*(bp3[IZ]-bm3[IZ])/m3[IZ];
+	double zlo = dm3[IZ] - 0.5*h3[IZ];
+	double zhi = dp3[IZ] + 0.5*h3[IZ];
+	q.in3[IZ][iz] = (rank < 3 || (zlo <= z && z <= zhi));
+      }
+    }
+
+    // add block contribution to images in a single traversal
+
+    for (int iz=0; iz<m3[2]; iz++) {
+      for (int iy=0; iy<m3[1]; iy++) {
+	for (int ix=0; ix<m3[0]; ix++) {
+	  const int i3[3] = {ix,iy,iz};
+	  for (int k=0; k<num_products; k++) {
+	    const Projection & q = projection[k];
+	    if (q.values == NULL) continue;
+	    if (! (q.in3[0][ix] && q.in3[1][iy] && q.in3[2][iz])) continue;
+	    const int IX = (products_[k].axis+1) % 3;
+	    const int IY = (products_[k].axis+2) % 3;
+	    const int i = ix*q.d3[0] + iy*q.d3[1] + iz*q.d3[2];
+	    double value = 0.0;
+	    if (q.precision == precision_single) {
+	      value = ((float *)q.values)[i];
+	    } else if (q.precision == precision_double) {
+	      value = ((double *)q.values)[i];
 	    }
+	    select_product_(k);
+	    reduce_box_filled_(image_data_,
+			       q.jm3[IX][i3[IX]],q.jp3[IX][i3[IX]],
+			       q.jm3[IY][i3[IY]],q.jp3[IY][i3[IY]],
+			       (value*q.factor));
 	  }
 	}
       }
@@ -383,70 +538,9 @@ void OutputImage::write_block ( const Block *  block ) throw()
 
   if (type_is_mesh_()) {
 
-    // value for mesh
-    double value = 0;
-    value = mesh_color_(level,block->age());
-
-    if (face_rank_ >= 1) {
-      reduce_box_filled_(image_mesh_,ixm,ixp,iym,iyp,value);
-    } else {
-      reduce_box_filled_(image_mesh_,ixm+3,ixp-3,iym+3,iyp-3,value);
-    }
-    reduce_box_ (image_mesh_,ixm,ixp,iym,iyp,0.0,reduce_set);
-
-    int xm=(ixm+ixp)/2;
-    int ym=(iym+iyp)/2;
-    if (face_rank_ <= 1) {
-      {
-	int if3[3] = {-1,0,0};
-	int face_level = block->face_level(if3);
-	double face_color = mesh_color_(face_level,0);
-	reduce_box_filled_(image_mesh_,ixm+1,ixm+2,ym-1,ym+1, face_color);
-      }
-      {
-	int if3[3] = {1,0,0};
-	int face_level = block->face_level(if3);
-	double face_color = mesh_color_(face_level,0);
-	reduce_box_filled_(image_mesh_,ixp-2,ixp-1,ym-1,ym+1, face_color);
-      }
-      {
-	int if3[3] = {0,-1,0};
-	int face_level = block->face_level(if3);
-	double face_color = mesh_color_(face_level,0);
-	reduce_box_filled_(image_mesh_,xm-1,xm+1,iym+1,iym+2, face_color);
-      }
-      {
-	int if3[3] = {0,1,0};
-	int face_level = block->face_level(if3);
-	double face_color = mesh_color_(face_level,0);
-	reduce_box_filled_(image_mesh_,xm-1,xm+1,iyp-2,iyp-1, face_color);
-      }
-    }
-    if (face_rank_ <= 0) {
-      {
-	int if3[3] = {-1,-1,0};
-	int face_level = block->face_level(if3);
-	double face_color = mesh_color_(face_level,0);
-	reduce_box_filled_(image_mesh_,ixm+1,ixm+2,iym+1,iym+2, face_color);
-      }
-      {
-	int if3[3] = {1,-1,0};
-	int face_level = block->face_level(if3);
-	double face_color = mesh_color_(face_level,0);
-	reduce_box_filled_(image_mesh_,ixp-2,ixp-1,iym+1,iym+2, face_color);
-      }
-      {
-	int if3[3] = {-1,1,0};
-	int face_level = block->face_level(if3);
-	double face_color = mesh_color_(face_level,0);
-	reduce_box_filled_(image_mesh_,ixm+1,ixm+2,iyp-2,iyp-1, face_color);
-      }
-      {
-	int if3[3] = {1,1,0};
-	int face_level = block->face_level(if3);
-	double face_color = mesh_color_(face_level,0);
-	reduce_box_filled_(image_mesh_,ixp-2,ixp-1,iyp-2,iyp-1, face_color);
-      }
+    for (int k=0; k<num_products; k++) {
+      select_product_(k);
+      write_block_mesh_(block,ixm[k],ixp[k],iym[k],iyp[k]);
     }
   }
 
@@ -454,11 +548,6 @@ void OutputImage::write_block ( const Block *  block ) throw()
 
   Particle particle = ((Block * )block)->data()->particle();
 
-  double xdm = dm3[IX];
-  double ydm = dm3[IY];
-  double xdp = dp3[IX];
-  double ydp = dp3[IY];
-
   for (it_particle_index_->first();
        ! it_particle_index_->done();
        it_particle_index_->next()) {
@@ -483,30 +572,45 @@ void OutputImage::write_block ( const Block *  block ) throw()
       position[2].resize(np);
       particle.position
         (it,ib, position[0].data(),position[1].data(), position[2].data());
-      const double * xa = position[IX].data();
-      const double * ya = position[IY].data();
       double * pa = (double *) particle.attribute_array (it,ia_color,ib);
-      for (int ip=0; ip<np; ip++) {
-
- 	double x = xa[ip*dp];
- 	double y = ya[ip*dp];
- 	double value = (ia_color == -1) ? 1.0 : pa[ip*da];
-	double tx = nxi_*(x - xdm)/(xdp-xdm) - 0.5;
-	double ty = nyi_*(y - ydm)/(ydp-ydm) - 0.5;
-	int ix0 = floor(tx);
-	int iy0 = floor(ty);
-	int ix1 = ix0+1;
-	int iy1 = iy0+1;
-	double ax0 = 1.0 - (tx - floor(tx));
-	double ax1 = 1.0 - ax0;
-	double ay0 = 1.0 - (ty - floor(ty));
-	double ay1 = 1.0 - ay0;
-
-	reduce_point_(image_data_,ix0,iy0,value,ax0*ay0);
-	reduce_point_(image_data_,ix1,iy0,value,ax1*ay0);
-	reduce_point_(image_data_,ix0,iy1,value,ax0*ay1);
-	reduce_point_(image_data_,ix1,iy1,value,ax1*ay1);
 
+      for (int k=0; k<num_products; k++) {
+
+	select_product_(k);
+
+	const int IX = (axis_+1) % 3;
+	const int IY = (axis_+2) % 3;
+
+	const double xdm = dm3[IX];
+	const double ydm = dm3[IY];
+	const double xdp = dp3[IX];
+	const double ydp = dp3[IY];
+
+	const double * xa = position[IX].data();
+	const double * ya = position[IY].data();
+
+	for (int ip=0; ip<np; ip++) {
+
+	  double x = xa[ip*dp];
+	  double y = ya[ip*dp];
+	  double value = (ia_color == -1) ? 1.0 : pa[ip*da];
+	  double tx = nxi_*(x - xdm)/(xdp-xdm) - 0.5;
+	  double ty = nyi_*(y - ydm)/(ydp-ydm) - 0.5;
+	  int ix0 = floor(tx);
+	  int iy0 = floor(ty);
+	  int ix1 = ix0+1;
+	  int iy1 = iy0+1;
+	  double ax0 = 1.0 - (tx - floor(tx));
+	  double ax1 = 1.0 - ax0;
+	  double ay0 = 1.0 - (ty - floor(ty));
+	  double ay1 = 1.0 - ay0;
+
+	  reduce_point_(image_data_,ix0,iy0,value,ax0*ay0);
+	  reduce_point_(image_data_,ix1,iy0,value,ax1*ay0);
+	  reduce_point_(image_data_,ix0,iy1,value,ax0*ay1);
+	  reduce_point_(image_data_,ix1,iy1,value,ax1*ay1);
+
+	}
       }
     }
   }
@@ -514,9 +618,83 @@ void OutputImage::write_block ( const Block *  block ) throw()
 
 //----------------------------------------------------------------------
 
+void OutputImage::write_block_mesh_
+(const Block * block, int ixm, int ixp, int iym, int iyp) throw()
+{
+  const int level = block->level();
+
+  // value for mesh
+  double value = 0;
+  value = mesh_color_(level,block->age());
+
+  if (face_rank_ >= 1) {
+    reduce_box_filled_(image_mesh_,ixm,ixp,iym,iyp,value);
+  } else {
+    reduce_box_filled_(image_mesh_,ixm+3,ixp-3,iym+3,iyp-3,value);
+  }
+  reduce_box_ (image_mesh_,ixm,ixp,iym,iyp,0.0,reduce_set);
+
+  int xm=(ixm+ixp)/2;
+  int ym=(iym+iyp)/2;
+  if (face_rank_ <= 1) {
+    {
+      int if3[3] = {-1,0,0};
+      int face_level = block->face_level(if3);
+      double face_color = mesh_color_(face_level,0);
+      reduce_box_filled_(image_mesh_,ixm+1,ixm+2,ym-1,ym+1, face_color);
+    }
+    {
+      int if3[3] = {1,0,0};
+      int face_level = block->face_level(if3);
+      double face_color = mesh_color_(face_level,0);
+      reduce_box_filled_(image_mesh_,ixp-2,ixp-1,ym-1,ym+1, face_color);
+    }
+    {
+      int if3[3] = {0,-1,0};
+      int face_level = block->face_level(if3);
+      double face_color = mesh_color_(face_level,0);
+      reduce_box_filled_(image_mesh_,xm-1,xm+1,iym+1,iym+2, face_color);
+    }
+    {
+      int if3[3] = {0,1,0};
+      int face_level = block->face_level(if3);
+      double face_color = mesh_color_(face_level,0);
+      reduce_box_filled_(image_mesh_,xm-1,xm+1,iyp-2,iyp-1, face_color);
+    }
+  }
+  if (face_rank_ <= 0) {
+    {
+      int if3[3] = {-1,-1,0};
+      int face_level = block->face_level(if3);
+      double face_color = mesh_color_(face_level,0);
+      reduce_box_filled_(image_mesh_,ixm+1,ixm+2,iym+1,iym+2, face_color);
+    }
+    {
+      int if3[3] = {1,-1,0};
+      int face_level = block->face_level(if3);
+      double face_color = mesh_color_(face_level,0);
+      reduce_box_filled_(image_mesh_,ixp-2,ixp-1,iym+1,iym+2, face_color);
+    }
+    {
+      int if3[3] = {-1,1,0};
+      int face_level = block->face_level(if3);
+      double face_color = mesh_color_(face_level,0);
+      reduce_box_filled_(image_mesh_,ixm+1,ixm+2,iyp-2,iyp-1, face_color);
+    }
+    {
+      int if3[3] = {1,1,0};
+      int face_level = block->face_level(if3);
+      double face_color = mesh_color_(face_level,0);
+      reduce_box_filled_(image_mesh_,ixp-2,ixp-1,iyp-2,iyp-1, face_color);
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
 void OutputImage::write_field_data
 (
- const FieldData * field_data,  
+ const FieldData * field_data,
  int index_field) throw()
 {
   WARNING("OutputImage::write_field_data",
@@ -527,7 +705,7 @@ void OutputImage::write_field_data
 
 void OutputImage::write_particle_data
 (
- const ParticleData * particle_data,  
+ const ParticleData * particle_data,
  int index_particle) throw()
 {
   WARNING("OutputImage::write_particle_data",
@@ -538,6 +716,23 @@ void OutputImage::write_particle_data
 
 void OutputImage::prepare_remote (int * n, char ** buffer) throw()
 {
+  prepare_remote_part (0,n,buffer);
+}
+
+//----------------------------------------------------------------------
+
+void OutputImage::update_remote  ( int m, char * buffer) throw()
+{
+  update_remote_part (0,m,buffer);
+}
+
+//----------------------------------------------------------------------
+
+void OutputImage::prepare_remote_part
+(int part, int * n, char ** buffer) throw()
+{
+  select_product_(part);
+
   int size = 0;
   int nx = nxi_;
   int ny = nyi_;
@@ -565,13 +760,16 @@ void OutputImage::prepare_remote (int * n, char ** buffer) throw()
 
   for (int k=0; k<nx*ny; k++) *p.d++ = image_data_[k];
   for (int k=0; k<nx*ny; k++) *p.d++ = image_mesh_[k];
-  
+
 }
 
 //----------------------------------------------------------------------
 
-void OutputImage::update_remote  ( int m, char * buffer) throw()
+void OutputImage::update_remote_part
+( int part, int m, char * buffer) throw()
 {
+  select_product_(part);
+
   union {
     char   * c;
     double * d;
@@ -584,7 +782,7 @@ void OutputImage::update_remote  ( int m, char * buffer) throw()
   const int ny = *p.i++;
 
   const int n = nx*ny;
-  
+
   if (op_reduce_ == reduce_min) {
     for (int k=0; k<n; k++) image_data_[k] = std::min(image_data_[k],*p.d++);
     for (int k=0; k<n; k++) image_mesh_[k] = std::min(image_mesh_[k],*p.d++);
@@ -648,24 +846,28 @@ bool OutputImage::is_active_ (const Block * block) const
 
 //----------------------------------------------------------------------
 
-void OutputImage::png_create_ (std::string filename) throw()
+reduce_type OutputImage::reduce_op_ (std::string image_reduce_type) const
 {
-  if (is_writer()) {
-    const char * file_name = strdup(filename.c_str());
-    png_ = new pngwriter(nxi_, nyi_,0,file_name);
-    free ((void *)file_name);
+  if      (image_reduce_type=="min") { return reduce_min; }
+  else if (image_reduce_type=="max") { return reduce_max; }
+  else if (image_reduce_type=="avg") { return reduce_avg; }
+  else if (image_reduce_type=="sum") { return reduce_sum; }
+  else {
+    ERROR1 ("OutputImage::reduce_op_()",
+	    "Unrecognized output_image_reduce_type %s",
+	    image_reduce_type.c_str());
+    return reduce_unknown;
   }
 }
 
 //----------------------------------------------------------------------
 
-void OutputImage::png_close_ () throw()
+void OutputImage::select_product_ (int k) throw()
 {
-  if (is_writer()) {
-    png_->close();
-    delete png_;
-    png_ = 0;
-  }
+  axis_       = products_[k].axis;
+  op_reduce_  = products_[k].op_reduce;
+  image_data_ = image_data_list_[k].data();
+  image_mesh_ = image_mesh_list_[k].data();
 }
 
 //----------------------------------------------------------------------
@@ -674,85 +876,173 @@ void OutputImage::image_create_ () throw()
 {
   ASSERT("OutputImage::image_create_",
 	 "image_ already created",
-	 image_data_ == NULL || image_mesh_ == NULL);
+	 image_data_list_.size() == 0 || image_mesh_list_.size() == 0);
+
+  const int num_products = products_.size();
 
-  image_data_  = new double [nxi_*nyi_];
-  image_mesh_  = new double [nxi_*nyi_];
+  image_data_list_.resize(num_products);
+  image_mesh_list_.resize(num_products);
 
   const double min = std::numeric_limits<double>::max();
   const double max = -min;
 
-  double value0;
+  for (int k=0; k<num_products; k++) {
+
+    double value0;
+
+    switch (products_[k].op_reduce) {
+    case reduce_min:
+      value0 = min;
+      break;
+    case reduce_max:
+      value0 = max;
+      break;
+    case reduce_avg:
+    case reduce_sum:
+    case reduce_set:
+    default:
+      value0 = 0;
+      break;
+    }
 
-  switch (op_reduce_) {
-  case reduce_min: 
-    value0 = min;
-    break;
-  case reduce_max: 
-    value0 = max;
-    break;
-  case reduce_avg: 
-  case reduce_sum: 
-  case reduce_set:
-  default:         
-    value0 = 0; 
-    break;
+    image_data_list_[k].assign(nxi_*nyi_,value0);
+    image_mesh_list_[k].assign(nxi_*nyi_,value0);
   }
 
-  for (int i=0; i<nxi_*nyi_; i++) image_data_[i] = value0;
-  for (int i=0; i<nxi_*nyi_; i++) image_mesh_[i] = value0;
-
+  select_product_(0);
 }
 
 //----------------------------------------------------------------------
 
-void OutputImage::image_write_ () throw()
+void OutputImage::image_write_ (int k) throw()
 {
-  // simplified variable names
+  select_product_(k);
+
+  const std::string file_name = file_name_list_[k];
+
+  const int num_bands = image_num_bands_();
+
+  // Raw floating-point values: no colormap
+
+  if (image_format_ == "raw_float") {
+    std::vector<float> values (size_t(nxi_)*nyi_);
+    image_for_bands_ (num_bands, [&] (int band)
+    {
+      const int jy_begin = (nyi_*band)     / num_bands;
+      const int jy_end   = (nyi_*(band+1)) / num_bands;
+      for (int jy=jy_begin; jy<jy_end; jy++) {
+	const int iy = nyi_ - 1 - jy;
+	for (int ix=0; ix<nxi_; ix++) {
+	  double value = data_(ix + nxi_*iy);
+	  if (image_abs_) value = fabs(value);
+	  if (image_log_) value = log(value);
+	  values[ix + size_t(nxi_)*jy] = value;
+	}
+      }
+    });
+    ImageEncoder::write_raw
+      (file_name,nxi_,nyi_,1,sizeof(float),true,values.data());
+    return;
+  }
 
-  int mx = nxi_;
-  int my = nyi_;
-  int m  = mx*my;
+  // Use product colormap if specified
 
-  double min,max;
+  const ImageProduct & product = products_[k];
+  const bool is_map = (product.map_r.size() > 0);
+  const std::vector<double> & map_r = is_map ? product.map_r : map_r_;
+  const std::vector<double> & map_g = is_map ? product.map_g : map_g_;
+  const std::vector<double> & map_b = is_map ? product.map_b : map_b_;
 
+  // Compute min and max
 
-  min = std::numeric_limits<double>::max();
-  max = -min;
+  std::vector<double> band_min(num_bands), band_max(num_bands);
+  image_for_bands_ (num_bands, [&] (int band)
+  { image_range_band_(band,num_bands,&band_min[band],&band_max[band]); });
 
-  // Compute min and max
+  double min = std::numeric_limits<double>::max();
+  double max = -min;
+  for (int band=0; band<num_bands; band++) {
+    min = MIN(min,band_min[band]);
+    max = MAX(max,band_max[band]);
+  }
+
+  // Use min/max if specified
+
+  min = MIN(min,min_value_);
+  max = MAX(max,max_value_);
+
+  // Colormap and compress bands, then write the file
+
+  const int bit_depth = (image_format_ == "png") ? 16 : 8;
+
+  ImageEncoder encoder (nxi_,nyi_,bit_depth,num_bands);
+
+  image_for_bands_ (num_bands, [&] (int band)
+  { image_encode_band_(band,&encoder,min,max,map_r,map_g,map_b); });
+
+  if (image_format_ == "png") {
+    encoder.write_png(file_name);
+  } else {
+    encoder.write_raw(file_name);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void OutputImage::image_range_band_
+(int band, int num_bands, double * min_band, double * max_band) const throw()
+{
+  const int iy_begin = (nyi_*band)     / num_bands;
+  const int iy_end   = (nyi_*(band+1)) / num_bands;
+  const int i_begin = nxi_*iy_begin;
+  const int i_end   = nxi_*iy_end;
+
+  double min = std::numeric_limits<double>::max();
+  double max = -min;
 
   if (image_log_) {
-    for (int i=0; i<m; i++) {
+    for (int i=i_begin; i<i_end; i++) {
       min = MIN(min,log(data_(i)));
       max = MAX(max,log(data_(i)));
     }
   } else if (image_abs_) {
-    for (int i=0; i<m; i++) {
+    for (int i=i_begin; i<i_end; i++) {
       min = MIN(min,fabs(data_(i)));
       max = MAX(max,fabs(data_(i)));
     }
-  } else { 
-    for (int i=0; i<m; i++) {
+  } else {
+    for (int i=i_begin; i<i_end; i++) {
       min = MIN(min,data_(i));
       max = MAX(max,data_(i));
     }
   }
 
-  // Use min/max if specified
+  (*min_band) = min;
+  (*max_band) = max;
+}
 
-  min = MIN(min,min_value_);
-  max = MAX(max,max_value_);
+//----------------------------------------------------------------------
 
-  size_t n = map_r_.size();
+void OutputImage::image_encode_band_
+(int band, ImageEncoder * encoder, double min, double max,
+ const std::vector<double> & map_r,
+ const std::vector<double> & map_g,
+ const std::vector<double> & map_b) const throw()
+{
+  size_t n = map_r.size();
 
-  // loop over pixels (ix,iy)
+  int jy_begin, jy_end;
+  encoder->band_rows(band,&jy_begin,&jy_end);
 
-  for (int ix = 0; ix<mx; ix++) {
+  // loop over pixels (ix,jy), with image rows jy from top to bottom
 
-    for (int iy = 0; iy<my; iy++) {
+  for (int jy = jy_begin; jy<jy_end; jy++) {
 
-      int i = ix + mx*iy;
+    const int iy = nyi_ - 1 - jy;
+
+    for (int ix = 0; ix<nxi_; ix++) {
+
+      int i = ix + nxi_*iy;
 
       double value = data_(i);
 
@@ -764,7 +1054,6 @@ void OutputImage::image_write_ () throw()
       if (value < min) value = min;
       if (value > max) value = max;
 
-
       if (min <= value && value <= max) {
 
 	// map v to lower colormap index
@@ -780,23 +1069,46 @@ void OutputImage::image_write_ () throw()
 
 	double ratio = (value - lo) / (hi-lo);
 
-	r = (1-ratio)*map_r_[k] + ratio*map_r_[k+1];
-	g = (1-ratio)*map_g_[k] + ratio*map_g_[k+1];
-	b = (1-ratio)*map_b_[k] + ratio*map_b_[k+1];
+	r = (1-ratio)*map_r[k] + ratio*map_r[k+1];
+	g = (1-ratio)*map_g[k] + ratio*map_g[k+1];
+	b = (1-ratio)*map_b[k] + ratio*map_b[k+1];
 
-	png_->plot      (ix+1, iy+1, r,g,b);
+	encoder->set_pixel (ix, jy, r,g,b);
 
       } else {
-	
+
 	// red if out of bounds
-	png_->plot(ix+1, iy+1, 1.0, 0.0, 0.0);
+	encoder->set_pixel (ix, jy, 1.0, 0.0, 0.0);
 
       }
-
-      // Plot pixel
     }
-  }      
+  }
 
+  if (image_format_ == "png") encoder->encode_band(band);
+}
+
+//----------------------------------------------------------------------
+
+void OutputImage::image_for_bands_
+(int num_bands, std::function<void (int)> function) const throw()
+{
+  if (num_threads_ == 1 || num_bands == 1) {
+    for (int band=0; band<num_bands; band++) function(band);
+  } else {
+    // one band per CkLoop task; returns when all bands are done
+    CkLoop_Parallelize
+      (image_bands_, 1, &function, num_bands, 0, num_bands - 1);
+  }
+}
+
+//----------------------------------------------------------------------
+
+int OutputImage::image_num_bands_ () const throw()
+{
+  // bands are encoded by CkLoop tasks on PEs of this node
+  const int num_threads = (num_threads_ > 0) ?
+    std::min(num_threads_,CkMyNodeSize()) : CkMyNodeSize();
+  return std::max(1,std::min(num_threads,nyi_));
 }
 
 //----------------------------------------------------------------------
@@ -805,9 +1117,9 @@ double OutputImage::data_(int index) const
 {
   if (type_is_mesh_() && type_is_data_())
     return (image_data_[index] + 0.2*image_mesh_[index])/1.2;
-  else if (type_is_data_()) 
+  else if (type_is_data_())
     return image_data_[index];
-  else  if (type_is_mesh_()) 
+  else  if (type_is_mesh_())
     return image_mesh_[index];
   else {
     ERROR ("OutputImage::data_()",
@@ -822,12 +1134,12 @@ void OutputImage::image_close_ () throw()
 {
   ASSERT("OutputImage::image_create_",
 	 "image_ already created",
-	 image_data_ != NULL || image_mesh_ != NULL);
+	 image_data_list_.size() > 0 || image_mesh_list_.size() > 0);
 
-  delete [] image_data_;
+  image_data_list_.clear();
   image_data_ = nullptr;
 
-  delete [] image_mesh_;
+  image_mesh_list_.clear();
   image_mesh_ = nullptr;
 }
 
@@ -23,6 +23,12 @@ class OutputImage : public Output {
   /// @class    OutputImage
   /// @ingroup  Io
   /// @brief [\ref Io] class for writing images
+  ///
+  /// @details An OutputImage renders a list of image products, each
+  /// a (field, axis, reduction, colormap) combination, from a single
+  /// traversal of each Block's data.  With more than one product,
+  /// each product is a separate Output part, reduced onto and
+  /// written by a different process.
 
 public: // functions
 
@@ -62,6 +68,10 @@ public: // functions
   OutputImage (CkMigrateMessage *m)
     : Output (m),
       map_r_(),map_g_(),map_b_(),
+      products_(),
+      image_data_list_(),
+      image_mesh_list_(),
+      file_name_list_(),
       image_data_(NULL),
       image_mesh_(NULL),
       op_reduce_(reduce_unknown),
@@ -72,8 +82,9 @@ public: // functions
       max_value_(-std::numeric_limits<double>::max()),
       nxi_(0),
       nyi_(0),
-      png_(NULL),
       image_type_(""),
+      image_format_("png"),
+      num_threads_(1),
       face_rank_(0),
       image_log_(false),
       image_abs_(false),
@@ -96,6 +107,26 @@ public: // functions
   (int n, double * map_r, double * map_g, double * map_b)
   throw();
 
+  /// Remove all image products, including the default product of the
+  /// first field along the image axis
+  void clear_products () throw();
+
+  /// Add an image product of the given field, axis, and reduction
+  /// type, with colormap of size n (n = 0 for the image colormap)
+  void add_product
+  (std::string name, int index_field, int axis,
+   std::string reduce_type,
+   int n, double * map_r, double * map_g, double * map_b) throw();
+
+  /// Return the number of image products
+  int num_products () const throw()
+  { return products_.size(); }
+
+  /// Set the image file format ("png", "raw_uint8", or "raw_float")
+  /// and the number of node PEs used to colormap and compress each
+  /// image (0 for all PEs in the node)
+  void set_format (std::string image_format, int num_threads) throw();
+
 public: // virtual functions
 
   /// Prepare for accumulating block data
@@ -132,6 +163,22 @@ public: // virtual functions
   /// Free local array if allocated; NOP if not
   virtual void cleanup_remote (int * n, char ** buffer) throw();
 
+  /// Return the number of image products
+  virtual int num_parts () const throw()
+  { return products_.size(); }
+
+  /// Return the process writing the given image product: products
+  /// are distributed evenly across processes, with product 0 on the
+  /// root process
+  virtual int process_writer_part (int part) const throw()
+  { return (part * CkNumPes()) / products_.size(); }
+
+  /// Prepare local array with the image data of the given product
+  virtual void prepare_remote_part (int part, int * n, char ** buffer) throw();
+
+  /// Accumulate image data of the given product from a remote process
+  virtual void update_remote_part (int part, int n, char * buffer) throw();
+
 private: // functions
 
   /// value associated with the given mesh level
@@ -145,17 +192,45 @@ private: // functions
 
   bool is_active_ (const Block * block) const;
 
-  /// Create the png file object
-  void png_create_ (std::string filename) throw();
+  /// Whether this process writes the given image product
+  bool is_writer_product_ (int k) const
+  { return (CkMyPe() == process_writer_part(k)); }
+
+  /// Return the reduction operation for the given reduce type name
+  reduce_type reduce_op_ (std::string image_reduce_type) const;
 
-  /// Delete the png object
-  void png_close_() throw();
+  /// Set the current image, axis, and reduction to the given product
+  void select_product_ (int k) throw();
+
+  /// Add the mesh outline of the Block to the current mesh image
+  void write_block_mesh_
+  (const Block * block, int ixm, int ixp, int iym, int iyp) throw();
 
   /// Create the image data object
   void image_create_ () throw();
 
-  /// Generate PNG image, using given min and max for colormap
-  void image_write_ () throw();
+  /// Write the image file of the given product
+  void image_write_ (int k) throw();
+
+  /// Compute the range of image values in the given band of rows
+  void image_range_band_
+  (int band, int num_bands, double * min, double * max) const throw();
+
+  /// Colormap the given band of rows into the image encoder, and
+  /// compress it if writing a PNG file
+  void image_encode_band_
+  (int band, ImageEncoder * encoder, double min, double max,
+   const std::vector<double> & map_r,
+   const std::vector<double> & map_g,
+   const std::vector<double> & map_b) const throw();
+
+  /// Call the function for each band, concurrently across PEs in the
+  /// node if num_threads_ != 1
+  void image_for_bands_
+  (int num_bands, std::function<void (int)> function) const throw();
+
+  /// Return the number of bands used to write an image
+  int image_num_bands_ () const throw();
 
   /// Close the image data
   void image_close_ () throw();
@@ -179,11 +254,53 @@ private: // functions
 
 private: // attributes
 
+  /// Single image product
+  struct ImageProduct {
+
+    /// Suffix appended to the image file name ("" for none)
+    std::string name;
+
+    /// Field index, or -1 for the first field in the field list
+    int index_field;
+
+    /// Axis along which to reduce
+    int axis;
+
+    /// Reduction operation
+    reduce_type op_reduce;
+
+    /// Color map, or empty for the OutputImage color map
+    std::vector<double> map_r;
+    std::vector<double> map_g;
+    std::vector<double> map_b;
+
+    void pup (PUP::er &p)
+    {
+      p | name;
+      p | index_field;
+      p | axis;
+      p | op_reduce;
+      p | map_r;
+      p | map_g;
+      p | map_b;
+    }
+  };
+
   /// Color map
   std::vector<double> map_r_;
   std::vector<double> map_g_;
   std::vector<double> map_b_;
 
+  /// List of image products
+  std::vector<ImageProduct> products_;
+
+  /// Data and mesh images for each product
+  std::vector< std::vector<double> > image_data_list_;
+  std::vector< std::vector<double> > image_mesh_list_;
+
+  /// Image file name for each product written by this process
+  std::vector<std::string> file_name_list_;
+
   /// Current image for data
   double * image_data_;
 
@@ -199,7 +316,7 @@ private: // attributes
   /// Particle attribute defining color (default -1: constant)
   std::string color_particle_attribute_;
 
-  /// Axis along which to reduce
+  /// Axis along which to reduce for the current product
   axis_type axis_;
 
   /// Minimum and maximum values if specified
@@ -209,12 +326,15 @@ private: // attributes
   /// Current image size (depending on axis_)
   int nxi_, nyi_;
 
-  /// Current pngwriter
-  pngwriter * png_;
-
   /// Image type: data or mesh
   std::string image_type_;
 
+  /// Image file format: png, raw_uint8, or raw_float
+  std::string image_format_;
+
+  /// Number of node PEs used to colormap and compress images
+  int num_threads_;
+
   /// Minimal rank of faces to include face level indicators 
   int face_rank_;
 
@@ -228,6 +228,26 @@ int64_t Memory::bytes_highest ( std::string group_name )
 
 //----------------------------------------------------------------------
 
+void Memory::add_bytes_saved ( int64_t bytes )
+{
+#ifdef CONFIG_USE_MEMORY
+  bytes_saved_ += bytes;
+#endif
+}
+
+//----------------------------------------------------------------------
+
+int64_t Memory::bytes_saved ()
+{
+#ifdef CONFIG_USE_MEMORY
+  return bytes_saved_;
+#else
+  return 0;
+#endif
+}
+
+//----------------------------------------------------------------------
+
 void Memory::set_bytes_limit ( int64_t size, std::string group_name )
 {
 #ifdef CONFIG_USE_MEMORY
@@ -286,6 +306,7 @@ void Memory::print ()
       monitor->print ("Memory","  delete_calls  = %ld",long(delete_calls_[i]));
     }
   }
+  Monitor::instance()->print ("Memory","bytes_saved = %ld",long(bytes_saved_));
 #endif
 }
 
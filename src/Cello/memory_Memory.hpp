@@ -32,6 +32,7 @@ private: // interface
   Memory()
 #ifdef CONFIG_USE_MEMORY
   : is_active_(false),
+    bytes_saved_(0),
     warning_mb_(0.0),
     limit_gb_ (0.0)
 #endif
@@ -110,6 +111,13 @@ public: // interface
   /// Maximum number of bytes allocated during run
   int64_t bytes_highest ( std::string group = "" );
 
+  /// Add to (or subtract from if negative) the number of bytes saved
+  /// by storage that is released until next needed
+  void add_bytes_saved ( int64_t bytes );
+
+  /// Current number of bytes saved by released storage
+  int64_t bytes_saved ();
+
   /// Specify the maximum number of bytes to use
   void set_bytes_limit ( int64_t size, 
 			 std::string group = "");
@@ -221,6 +229,9 @@ private: // attributes
   /// High-water bytes allocated for different groups
   std::vector<int64_t> bytes_highest_;
 
+  /// Bytes of storage currently released until next needed
+  int64_t bytes_saved_;
+
   /// Number of calls to new for different groups
   std::vector<int64_t> new_calls_;
 
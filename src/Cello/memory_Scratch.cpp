@@ -0,0 +1,62 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     memory_Scratch.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-19
+/// @brief    Implementation of the Scratch class
+
+#include "cello.hpp"
+
+#include "memory.hpp"
+
+/// Alignment in bytes of Scratch arrays
+#define SCRATCH_ALIGN 64
+
+Scratch Scratch::instance_[CONFIG_NODE_SIZE];
+
+//----------------------------------------------------------------------
+
+void Scratch::deallocate ()
+{
+  std::vector< std::vector<char> >().swap(buffers_);
+  bytes_ = 0;
+}
+
+//----------------------------------------------------------------------
+
+char * Scratch::allocate_ (int slot, size_t bytes)
+{
+  if (slot >= int(buffers_.size())) buffers_.resize(slot+1);
+
+  std::vector<char> & buffer = buffers_[slot];
+
+  const size_t size = bytes + SCRATCH_ALIGN - 1;
+
+  if (buffer.size() < size) {
+
+    // Grow by at least a factor of 1.5 to limit reallocations while
+    // Block sizes or color counts vary
+
+    const size_t size_new = std::max(size, buffer.size() + buffer.size()/2);
+
+    Memory * memory = Memory::instance();
+    std::string group = memory ? memory->group() : "";
+    if (memory) {
+      if (memory->index_group("Scratch") == 0) memory->new_group("Scratch");
+      memory->set_group("Scratch");
+    }
+
+    bytes_ += size_new - buffer.size();
+
+    // Swap rather than resize since old values need not be copied
+    std::vector<char>(size_new).swap(buffer);
+
+    if (memory) memory->set_group(group);
+  }
+
+  const uintptr_t address = reinterpret_cast<uintptr_t>(buffer.data());
+
+  const size_t offset = (SCRATCH_ALIGN - address % SCRATCH_ALIGN) % SCRATCH_ALIGN;
+
+  return buffer.data() + offset;
+}
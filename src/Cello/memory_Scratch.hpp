@@ -0,0 +1,85 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     memory_Scratch.hpp
+/// @author   agent (agent@local)
+/// @date     2026-10-19
+/// @brief    [\ref Memory] Declaration of the Scratch class
+
+#ifndef MEMORY_SCRATCH_HPP
+#define MEMORY_SCRATCH_HPP
+
+class Scratch {
+
+  /// @class    Scratch
+  /// @ingroup  Memory
+  /// @brief    [\ref Memory] Reusable aligned work arrays, one set per
+  /// process
+  ///
+  /// Scratch keeps numbered slots of work arrays that grow to the
+  /// largest size requested and are kept between calls, replacing
+  /// allocate / deallocate pairs in compute kernels that are called
+  /// once per Block.  There is one Scratch object per process (as for
+  /// Memory), so arrays may be used until the calling entry method
+  /// returns.  Arrays requested from the same slot share storage, so
+  /// arrays used at the same time must use different slots.  Storage
+  /// is allocated in the "Scratch" Memory group.
+
+public: // interface
+
+  /// Get single instance of the Scratch object
+  static Scratch * instance()
+  { return & instance_[cello::index_static()]; }
+
+  /// Return an aligned work array of at least n values of type T
+  /// for the given slot.  Values are not initialized unless clear is
+  /// true
+  template <class T>
+  T * array (int slot, size_t n, bool clear = false)
+  {
+    T * array = (T *) allocate_(slot,n*sizeof(T));
+    if (clear) std::fill_n(array,n,T(0));
+    return array;
+  }
+
+  /// Return the number of bytes allocated for all slots
+  int64_t bytes () const
+  { return bytes_; }
+
+  /// Return the number of slots used
+  int num_slots () const
+  { return buffers_.size(); }
+
+  /// Deallocate all work arrays
+  void deallocate ();
+
+private: // functions
+
+  /// Create the (single) Scratch object
+  Scratch()
+    : buffers_(),
+      bytes_(0)
+  { }
+
+  /// Copy the (single) Scratch object
+  Scratch (const Scratch &);
+
+  /// Assign the (single) Scratch object
+  Scratch & operator = (const Scratch &);
+
+  /// Return aligned storage of at least the given size for the slot
+  char * allocate_ (int slot, size_t bytes);
+
+private: // attributes
+
+  /// Single instance of the Scratch object (singleton design pattern)
+  static Scratch instance_[CONFIG_NODE_SIZE];
+
+  /// Storage for each slot, including padding for alignment
+  std::vector< std::vector<char> > buffers_;
+
+  /// Total number of bytes allocated
+  int64_t bytes_;
+
+};
+
+#endif /* MEMORY_SCRATCH_HPP */
@@ -59,6 +59,10 @@ Block::Block ( MsgRefine * msg )
     dt_(0.0),
     stop_(false),
     index_initial_(0),
+    initial_pending_(0),
+    initial_waiting_(false),
+    initial_deferred_(false),
+    initial_restrict_count_(0),
     children_(),
     sync_coarsen_(),
     sync_count_(),
@@ -69,7 +73,13 @@ Block::Block ( MsgRefine * msg )
     child_face_level_next_(),
     count_coarsen_(0),
     adapt_step_(0),
+    adapt_refined_(false),
     adapt_(adapt_unknown),
+    data_version_(0),
+    adapt_cache_version_(-1),
+    adapt_cache_cycle_(-1),
+    adapt_cache_level_(-1),
+    adapt_cache_result_(adapt_unknown),
     coarsened_(false),
     delete_(false),
     is_leaf_(true),
@@ -77,6 +87,7 @@ Block::Block ( MsgRefine * msg )
     face_level_last_(),
     name_(""),
     index_method_(-1),
+    compute_overlap_(false),
     index_solver_(),
     refresh_()
 {
@@ -113,7 +124,13 @@ Block::Block ( MsgRefine * msg )
     delete msg;
   } else {
     delete msg;
-    apply_initial_();
+    // Blocks created while building the initial hierarchy may only
+    // need initial conditions once they are known to be leaves
+    if (initial_deferrable_()) {
+      initial_deferred_ = true;
+    } else {
+      apply_initial_();
+    }
   }
 
   performance_stop_(perf_block);
@@ -133,6 +150,10 @@ Block::Block ( process_type ip_source )
     dt_(0.0),
     stop_(false),
     index_initial_(0),
+    initial_pending_(0),
+    initial_waiting_(false),
+    initial_deferred_(false),
+    initial_restrict_count_(0),
     children_(),
     sync_coarsen_(),
     sync_count_(),
@@ -143,7 +164,13 @@ Block::Block ( process_type ip_source )
     child_face_level_next_(),
     count_coarsen_(0),
     adapt_step_(0),
+    adapt_refined_(false),
     adapt_(adapt_unknown),
+    data_version_(0),
+    adapt_cache_version_(-1),
+    adapt_cache_cycle_(-1),
+    adapt_cache_level_(-1),
+    adapt_cache_result_(adapt_unknown),
     coarsened_(false),
     delete_(false),
     is_leaf_(true),
@@ -151,6 +178,7 @@ Block::Block ( process_type ip_source )
     face_level_last_(),
     name_(""),
     index_method_(-1),
+    compute_overlap_(false),
     index_solver_(),
     refresh_()
 {
@@ -210,7 +238,11 @@ void Block::p_set_msg_refine(MsgRefine * msg)
     delete msg;
   } else {
     delete msg;
-    apply_initial_();
+    if (initial_deferrable_()) {
+      initial_deferred_ = true;
+    } else {
+      apply_initial_();
+    }
   } 
   
   performance_stop_(perf_block);
@@ -411,6 +443,10 @@ void Block::pup(PUP::er &p)
   p | dt_;
   p | stop_;
   p | index_initial_;
+  p | initial_pending_;
+  p | initial_waiting_;
+  p | initial_deferred_;
+  p | initial_restrict_count_;
   p | children_;
   p | sync_coarsen_;
   p | sync_count_;
@@ -421,7 +457,13 @@ void Block::pup(PUP::er &p)
   p | child_face_level_next_;
   p | count_coarsen_;
   p | adapt_step_;
+  p | adapt_refined_;
   p | adapt_;
+  p | data_version_;
+  p | adapt_cache_version_;
+  p | adapt_cache_cycle_;
+  p | adapt_cache_level_;
+  p | adapt_cache_result_;
   p | coarsened_;
   p | delete_;
   p | is_leaf_;
@@ -429,6 +471,7 @@ void Block::pup(PUP::er &p)
   p | face_level_last_;
   p | name_;
   p | index_method_;
+  p | compute_overlap_;
   p | index_solver_;
   p | refresh_;
   // SKIP method_: initialized when needed
@@ -567,10 +610,8 @@ void Block::compute_derived(const std::vector< std::string>& field_list
       for (auto i = 0; i < field_list.size(); i++){
         std::string name = field_list[i];
         if (field.groups()->is_in(name,"derived")){
-          Compute * compute = problem->create_compute(name,
-                                                      config);
+          Compute * compute = problem->compute(name,config);
           compute->compute(this);
-          delete compute; // must be done
         }
       }
     } else{ // else check full field list and compute all
@@ -579,10 +620,8 @@ void Block::compute_derived(const std::vector< std::string>& field_list
         std::string name = field.field_name(i);
         if (field.groups()->is_in(name,"derived")){
           // call the appropriate compute object
-          Compute * compute = problem->create_compute(name,
-                                                      config);
+          Compute * compute = problem->compute(name,config);
           compute->compute(this);
-          delete compute; // must be done
         }
       }
     }
@@ -603,8 +642,54 @@ void Block::apply_initial_() throw ()
   index_initial_ = 0;
   Problem * problem = cello::problem();
   while (Initial * initial = problem->initial(index_initial_++)) {
+    data_changed_();
     initial->enforce_block(this,cello::hierarchy());
   }
+  data_changed_();
+}
+
+//----------------------------------------------------------------------
+
+bool Block::initial_deferrable_() const
+{
+  // Only refined Blocks in the initial adapt phase, and only if no
+  // refinement criteria depend on Block data
+
+  if (level() <= 0 || ! cello::config()->adapt_interval) return false;
+
+  Problem * problem = cello::problem();
+  int index_refine = 0;
+  while (Refine * refine = problem->refine(index_refine++)) {
+    if (! refine->is_data_independent()) return false;
+  }
+  return (index_refine > 1);
+}
+
+//----------------------------------------------------------------------
+
+void Block::data_changed_()
+{
+  ++data_version_;
+  const int n = data_ ? data_->num_field_data() : 0;
+  for (int i=0; i<n; i++) {
+    data_->field_data(i)->set_modified_all();
+  }
+}
+
+//----------------------------------------------------------------------
+
+void Block::data_changed_(Refresh & refresh)
+{
+  if (refresh.all_fields()) {
+    data_changed_();
+  } else {
+    ++data_version_;
+    FieldData * field_data = data_->field_data();
+    std::vector<int> & field_list = refresh.field_list_dst();
+    for (size_t i=0; i<field_list.size(); i++) {
+      field_data->set_modified(field_list[i]);
+    }
+  }
 }
 
 //----------------------------------------------------------------------
@@ -639,24 +724,12 @@ Block::~Block()
     // Send restricted data to parent 
 
     int ic3[3];
-    index_.child(level,ic3,ic3+1,ic3+2);
-
     int n; 
     char * array;
-    int if3[3]={0,0,0};
-    bool lg3[3]={false,false,false};
     Refresh * refresh = new Refresh;
     refresh->add_all_data();
     
-    FieldFace * field_face = create_face
-      ( if3,ic3,lg3,refresh_coarse,refresh,true);
-#ifdef DEBUG_FIELD_FACE  
-    CkPrintf ("%d %s:%d DEBUG_FIELD_FACE creating %p\n",
-              CkMyPe(),__FILE__,__LINE__,(void*)field_face);
-#endif
-
-    field_face->face_to_array(data()->field(),&n,&array);
-    delete field_face;
+    restrict_to_array_ (refresh,&n,&array,ic3);
 
     const Index index_parent = index_.index_parent();
 
@@ -670,6 +743,8 @@ Block::~Block()
     delete [] array;
   }
 
+  new_refresh_plan_clear_();
+
   delete data_;
   data_ = 0;
 
@@ -690,11 +765,44 @@ void Block::p_refresh_child
  )
 {
   performance_start_(perf_refresh_child);
-  int  if3[3]  = {0,0,0};
-  bool lg3[3] = {false,false,false};
   Refresh * refresh = new Refresh;
   refresh->add_all_data();
   
+  restrict_from_array_ (refresh,n,buffer,ic3);
+  performance_stop_(perf_refresh_child);
+  performance_start_(perf_refresh_child_sync);
+}
+
+//----------------------------------------------------------------------
+
+void Block::restrict_to_array_
+(Refresh * refresh, int * n, char ** array, int ic3[3])
+{
+  index_.child(level(),ic3,ic3+1,ic3+2);
+
+  int if3[3]={0,0,0};
+  bool lg3[3]={false,false,false};
+    
+  FieldFace * field_face = create_face
+    ( if3,ic3,lg3,refresh_coarse,refresh,true);
+#ifdef DEBUG_FIELD_FACE  
+  CkPrintf ("%d %s:%d DEBUG_FIELD_FACE creating %p\n",
+	    CkMyPe(),__FILE__,__LINE__,(void*)field_face);
+#endif
+
+  field_face->face_to_array(data()->field(),n,array);
+  delete field_face;
+}
+
+//----------------------------------------------------------------------
+
+void Block::restrict_from_array_
+(Refresh * refresh, int n, char * array, int ic3[3])
+{
+  data_changed_();
+  int  if3[3]  = {0,0,0};
+  bool lg3[3] = {false,false,false};
+  
   FieldFace * field_face = create_face
     (if3, ic3, lg3, refresh_coarse,refresh,true);
 #ifdef DEBUG_FIELD_FACE  
@@ -702,10 +810,55 @@ void Block::p_refresh_child
             CkMyPe(),__FILE__,__LINE__,(void*)field_face);
 #endif
   
-  field_face -> array_to_face (buffer, data()->field());
+  field_face -> array_to_face (array, data()->field());
   delete field_face;
-  performance_stop_(perf_refresh_child);
-  performance_start_(perf_refresh_child_sync);
+}
+
+//----------------------------------------------------------------------
+
+void Block::initial_deferred_restrict_()
+{
+  initial_deferred_ = false;
+  initial_restrict_count_ = 0;
+
+  // Parents at level 0 were initialized when created, but deferred
+  // parents have no field values until restricted from children
+
+  if (level() > 1) {
+
+    int ic3[3];
+    int n;
+    char * array;
+    Refresh * refresh = new Refresh;
+    refresh->add_all_fields();
+
+    restrict_to_array_ (refresh,&n,&array,ic3);
+
+    const Index index_parent = index_.index_parent();
+
+    thisProxy[index_parent].p_initial_restrict(n,array,ic3);
+
+    delete [] array;
+  }
+}
+
+//----------------------------------------------------------------------
+
+void Block::p_initial_restrict 
+(
+ int    n, 
+ char * buffer, 
+ int    ic3[3]
+ )
+{
+  Refresh * refresh = new Refresh;
+  refresh->add_all_fields();
+
+  restrict_from_array_ (refresh,n,buffer,ic3);
+
+  if (++initial_restrict_count_ == cello::num_children()) {
+    initial_deferred_restrict_();
+  }
 }
 
 //----------------------------------------------------------------------
@@ -720,6 +873,10 @@ Block::Block ()
     dt_(0.0),
     stop_(false),
     index_initial_(0),
+    initial_pending_(0),
+    initial_waiting_(false),
+    initial_deferred_(false),
+    initial_restrict_count_(0),
     children_(),
     sync_coarsen_(),
     sync_count_(),
@@ -730,7 +887,13 @@ Block::Block ()
     child_face_level_next_(),
     count_coarsen_(0),
     adapt_step_(0),
+    adapt_refined_(false),
     adapt_(0),
+    data_version_(0),
+    adapt_cache_version_(-1),
+    adapt_cache_cycle_(-1),
+    adapt_cache_level_(-1),
+    adapt_cache_result_(adapt_unknown),
     coarsened_(false),
     delete_(false),
     is_leaf_(true),
@@ -738,6 +901,7 @@ Block::Block ()
     face_level_last_(),
     name_(""),
     index_method_(-1),
+    compute_overlap_(false),
     index_solver_(),
     refresh_()
 {
@@ -758,6 +922,10 @@ Block::Block (CkMigrateMessage *m)
     dt_(0.0),
     stop_(false),
     index_initial_(0),
+    initial_pending_(0),
+    initial_waiting_(false),
+    initial_deferred_(false),
+    initial_restrict_count_(0),
     children_(),
     sync_coarsen_(),
     sync_count_(),
@@ -768,7 +936,13 @@ Block::Block (CkMigrateMessage *m)
     child_face_level_next_(),
     count_coarsen_(0),
     adapt_step_(0),
+    adapt_refined_(false),
     adapt_(adapt_unknown),
+    data_version_(0),
+    adapt_cache_version_(-1),
+    adapt_cache_cycle_(-1),
+    adapt_cache_level_(-1),
+    adapt_cache_result_(adapt_unknown),
     coarsened_(false),
     delete_(false),
     is_leaf_(true),
@@ -776,6 +950,7 @@ Block::Block (CkMigrateMessage *m)
     face_level_last_(),
     name_(""),
     index_method_(-1),
+    compute_overlap_(false),
     index_solver_(),
     refresh_()
     
@@ -805,6 +980,7 @@ void Block::init_new_refresh_()
 #endif  
   new_refresh_sync_list_.resize(count);
   new_refresh_msg_list_.resize(count);
+  new_refresh_plan_list_.resize(count);
   for (int i=0; i<count; i++) {
     new_refresh_sync_list_[i].reset();
   }
@@ -1103,7 +1279,7 @@ Index Block::neighbor_
 //----------------------------------------------------------------------
 
 void Block::performance_start_
-(int index_region, std::string file, int line)
+(int index_region, const char * file, int line)
 {
   Simulation * simulation = cello::simulation();
   if (simulation)
@@ -1113,7 +1289,7 @@ void Block::performance_start_
 //----------------------------------------------------------------------
 
 void Block::performance_stop_
-(int index_region, std::string file, int line)
+(int index_region, const char * file, int line)
 {
   Simulation * simulation = cello::simulation();
   if (simulation)
@@ -1122,6 +1298,73 @@ void Block::performance_stop_
 
 //----------------------------------------------------------------------
 
+void Block::performance_group_start_ (int group, int index)
+{
+  Simulation * simulation = cello::simulation();
+  if (simulation) {
+    Performance * performance = simulation->performance();
+    const int index_region = performance->group_region(group,index);
+    if (index_region >= 0) performance->start_region(index_region);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void Block::performance_group_stop_ (int group, int index)
+{
+  Simulation * simulation = cello::simulation();
+  if (simulation) {
+    Performance * performance = simulation->performance();
+    const int index_region = performance->group_region(group,index);
+    if (index_region >= 0) performance->stop_region(index_region);
+  }
+}
+
+//----------------------------------------------------------------------
+
+int Block::performance_solver_start_ ()
+{
+  Simulation * simulation = cello::simulation();
+  int index_region = -2;
+  if (simulation && index_solver_.size() > 0) {
+    Performance * performance = simulation->performance();
+    index_region = std::max(-1,performance->group_region
+			    (perf_group_solver,index_solver_.back()));
+    if (index_region >= 0) performance->start_region(index_region);
+    timeline_begin_("solver");
+  }
+  return index_region;
+}
+
+//----------------------------------------------------------------------
+
+void Block::performance_solver_stop_ (int index_region)
+{
+  // index_region >= -1 if and only if a Timeline event was begun
+  Simulation * simulation = cello::simulation();
+  if (simulation && index_region >= -1)
+    timeline_end_("solver");
+  if (simulation && index_region >= 0)
+    simulation->performance()->stop_region(index_region);
+}
+
+//----------------------------------------------------------------------
+
+void Block::timeline_record_ (const char * name, int phase)
+{
+  Simulation * simulation = cello::simulation();
+  if (simulation) {
+    Timeline * timeline = simulation->timeline();
+    if (timeline->is_active()) {
+      int v3[3];
+      index_.values(v3);
+      timeline->record(name,phase,v3);
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
 void Block::check_leaf_()
 {
   if (level() >= 0 &&
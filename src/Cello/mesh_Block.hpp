@@ -34,6 +34,38 @@ class Solver;
 
 //----------------------------------------------------------------------
 
+/// @brief Neighbor Blocks and FieldFace objects used by a Block for
+/// a Refresh operation.  Plans are built when first used and cleared
+/// when the mesh changes, so that refreshing ghost zones between
+/// adapt phases does not recompute neighbors or face geometry.
+struct RefreshPlan {
+
+  RefreshPlan()
+    : is_valid(false),
+      neighbor_type(neighbor_unknown),
+      min_face_rank(0),
+      root_level(0),
+      index_list(),
+      field_face_list()
+  { }
+
+  /// Whether the plan is up to date
+  bool is_valid;
+
+  /// Refresh parameters the plan was built for
+  int neighbor_type;
+  int min_face_rank;
+  int root_level;
+
+  /// Neighbor Block indices
+  std::vector<Index> index_list;
+
+  /// FieldFace objects for each neighbor, owned by the Block
+  std::vector<FieldFace *> field_face_list;
+};
+
+//----------------------------------------------------------------------
+
 class Block : public CBase_Block
 {
   /// @class    Block
@@ -111,6 +143,17 @@ public: // interface
   inline const Data * child_data() const throw()  
   { return child_data_; };
 
+  /// Cached Boundary values
+  typedef Boundary::Cache BoundaryCache;
+
+  /// Return the Block's cache of time-independent Boundary values
+  inline BoundaryCache & boundary_cache() throw()
+  { return boundary_cache_; };
+
+  /// Free the Block's cached Boundary values
+  void boundary_cache_clear() throw()
+  { BoundaryCache().swap(boundary_cache_); }
+
   /// Return the index of the root block containing this block 
   inline void index_array (int * ix, int * iy, int * iz) const throw ()
   { index_.array(ix,iy,iz); }
@@ -274,11 +317,20 @@ public: // interface
   void r_end_initialize(CkReductionMsg * msg)
   {  initial_exit_();  delete msg;  }
   void initial_exit_();
+  void initial_done_();
   void p_initial_exit()
   {      initial_exit_();  }
   void r_initial_exit(CkReductionMsg * msg)
   {      initial_exit_();  delete msg;  }
 
+  /// Expect count more initial data messages from other chares
+  /// before leaving the initial phase
+  void initial_expect (int count)
+  { initial_pending_ += count; }
+
+  /// Called after applying an expected initial data message
+  void initial_received ();
+
   //--------------------------------------------------
   // COMPUTE
   //--------------------------------------------------
@@ -348,6 +400,8 @@ protected: // methods
   void compute_next_();
   /// Return after performing any Refresh operations
   void compute_continue_();
+  /// Whether to overlap the Method's refresh with its interior computation
+  bool method_overlap_(Method * method);
   /// Cleanup after all Methods have been applied
   void compute_end_();
   /// Exit control compute phase
@@ -491,6 +545,10 @@ public:
     performance_start_(perf_adapt_end_sync);
   }
 
+  /// Continue building the initial mesh hierarchy if any Block
+  /// refined in the last adapt step, else exit the adapt phase
+  void r_adapt_end_initial (CkReductionMsg * msg);
+
 
   /// Parent tells child to delete itself
   void p_adapt_delete();
@@ -509,6 +567,7 @@ public:
 
 protected:
   bool do_adapt_();
+  bool initial_deferrable_() const;
   void adapt_enter_();
   void adapt_begin_ ();
   void adapt_next_ ();
@@ -518,7 +577,15 @@ protected:
   void adapt_refine_();
   void adapt_called_();
   int adapt_compute_desired_level_(int level_maximum);
+  int adapt_evaluate_refine_();
   void adapt_delete_child_(Index index_child);
+
+  /// Mark the Block's field data as possibly changed, invalidating
+  /// cached refinement criteria results and derived fields
+  void data_changed_();
+
+  /// Mark only the fields written by the given Refresh as changed
+  void data_changed_(Refresh & refresh);
 public:
 
   //--------------------------------------------------
@@ -551,8 +618,10 @@ public:
   // REFRESH
   //--------------------------------------------------
 
-  /// Begin a refresh operation, optionally waiting then invoking callback
-  void new_refresh_start (int id_refresh, int callback);
+  /// Begin a refresh operation, optionally waiting then invoking
+  /// callback.  If wait is false and the refresh is active, the
+  /// caller must call new_refresh_wait() after sending data
+  void new_refresh_start (int id_refresh, int callback, bool wait = true);
 
   /// Wait for a refresh operation to complete, then continue with the callback
   void new_refresh_wait (int id_refresh, int callback);
@@ -564,14 +633,24 @@ public:
   /// Receive a Refresh data message from an adjacent Block
   void p_new_refresh_recv (MsgRefresh * msg);
 
+  /// Send field faces to neighbors using the cached RefreshPlan
   int new_refresh_load_field_faces_ (Refresh & refresh);
+  /// Return the RefreshPlan for the Refresh object, building it if needed
+  RefreshPlan & new_refresh_plan_ (Refresh & refresh);
+  /// Add a neighbor and its FieldFace to the RefreshPlan
+  void new_refresh_plan_add_
+  (RefreshPlan & plan, Refresh & refresh,
+   int refresh_type, Index index, int if3[3], int ic3[3]);
+  /// Delete all cached RefreshPlan FieldFace objects
+  void new_refresh_plan_clear_ ();
   /// Scatter particles in ghost zones to neighbors
   int new_refresh_load_particle_faces_ (Refresh & refresh);
   /// Send flux data to neighbors
   int new_refresh_load_flux_faces_ (Refresh & refresh);
   
+  /// Send field face data to a neighbor
   void new_refresh_load_field_face_
-  (Refresh & refresh, int refresh_type, Index index, int if3[3], int ic3[3]);
+  (Refresh & refresh, Index index, FieldFace * field_face);
   /// Send particles in list to corresponding indices
   void new_particle_send_(Refresh & refresh, int nl,Index index_list[], 
 			  ParticleData * particle_list[]);
@@ -614,6 +693,10 @@ public:
   /// Get restricted data from child when it is deleted
   void p_refresh_child (int n, char a[],int ic3[3]);
 
+  /// Get restricted data from child after deferred initial
+  /// conditions are applied
+  void p_initial_restrict (int n, char a[],int ic3[3]);
+
   void p_method_flux_correct_refresh();
   void r_method_flux_correct_sum_fields(CkReductionMsg * msg);
   void r_method_debug_sum_fields(CkReductionMsg * msg);
@@ -750,9 +833,31 @@ protected:
 protected:
   /// Start and stop measuring Block-based performance regions
   void performance_start_
-  (int index_region, std::string file="", int line=0);
+  (int index_region, const char * file="", int line=0);
   void performance_stop_
-  (int index_region, std::string file="", int line=0);
+  (int index_region, const char * file="", int line=0);
+
+  /// Start and stop measuring the performance sub-region of the ith
+  /// object in the given perf_group (Method, Solver, Refine, Refresh)
+  void performance_group_start_ (int group, int index);
+  void performance_group_stop_ (int group, int index);
+
+  /// Record a begin or end event in the Timeline for this Block
+  void timeline_begin_ (const char * name)
+  { timeline_record_(name,timeline_begin); }
+  void timeline_end_ (const char * name)
+  { timeline_record_(name,timeline_end); }
+  void timeline_record_ (const char * name, int phase);
+
+  /// Start measuring the region of the currently active Solver,
+  /// returning the value to pass to performance_solver_stop_(): the
+  /// region index if a region was started, -1 if only a Timeline
+  /// event was begun, or -2 if there is no active Solver.  The
+  /// Solver may finish inside the measured call, so
+  /// performance_solver_stop_() uses this value rather than the
+  /// Solver stack to decide what to end
+  int performance_solver_start_ ();
+  void performance_solver_stop_ (int index_region);
 
   //--------------------------------------------------
   // TESTING
@@ -885,6 +990,20 @@ protected: // functions
   /// Apply all initial conditions to this Block
   void apply_initial_() throw();
 
+  /// Complete deferred initial conditions: leaf Blocks apply them
+  /// and send restricted data to their parent, which does the same
+  /// once it has received data from all of its children
+  void initial_deferred_restrict_();
+
+  /// Pack this Block's field data restricted to its parent's
+  /// resolution, returning the child index in ic3
+  void restrict_to_array_ (Refresh * refresh, int * n, char ** array,
+			   int ic3[3]);
+
+  /// Unpack restricted field data from child ic3
+  void restrict_from_array_ (Refresh * refresh, int n, char * array,
+			     int ic3[3]);
+
   /// Determine which faces require boundary updates or communication
   void determine_boundary_
   (
@@ -973,6 +1092,20 @@ protected: // attributes
   /// Index of current initialization routine
   int index_initial_;
 
+  /// Number of initial data messages from other chares not yet received
+  int initial_pending_;
+
+  /// Whether initial_exit_() is waiting for initial data messages
+  bool initial_waiting_;
+
+  /// Whether initial conditions are deferred until the initial mesh
+  /// hierarchy is complete
+  bool initial_deferred_;
+
+  /// Number of children whose restricted data has been received
+  /// while completing deferred initial conditions
+  int initial_restrict_count_;
+
   /// MESH REFINEMENT
 
   /// list of child nodes
@@ -1003,9 +1136,28 @@ protected: // attributes
   /// Number of adapt steps in the adapt phase
   int adapt_step_;
 
+  /// Whether this Block refined in the current adapt step
+  bool adapt_refined_;
+
   /// Current adapt value for the block
   int adapt_;
 
+  /// Counter incremented whenever Block field data may have changed,
+  /// used to reuse refinement criteria results
+  int data_version_;
+
+  /// Value of data_version_ when adapt_cache_result_ was computed
+  int adapt_cache_version_;
+
+  /// Cycle when adapt_cache_result_ was computed
+  int adapt_cache_cycle_;
+
+  /// Level when adapt_cache_result_ was computed
+  int adapt_cache_level_;
+
+  /// Cached result of evaluating refinement criteria
+  int adapt_cache_result_;
+
   /// whether Block has been coarsened and should be deleted
   bool coarsened_;
 
@@ -1028,6 +1180,10 @@ protected: // attributes
   /// Index of currently-active Method
   int index_method_;
 
+  /// Whether the current Method's refresh is overlapped with
+  /// Method::compute_interior()
+  bool compute_overlap_;
+
   /// Stack of currently active solvers
   std::vector<int> index_solver_;
   
@@ -1038,6 +1194,12 @@ protected: // attributes
   std::vector < Sync > new_refresh_sync_list_;
   std::vector < std::vector <MsgRefresh * > > new_refresh_msg_list_;
 
+  /// Cached neighbor faces for each Refresh id (not packed)
+  std::vector < RefreshPlan > new_refresh_plan_list_;
+
+  /// Cached time-independent Boundary values (not packed)
+  BoundaryCache boundary_cache_;
+
 };
 
 #endif /* COMM_BLOCK_HPP */
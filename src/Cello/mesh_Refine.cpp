@@ -58,3 +58,23 @@ void * Refine::initialize_output_(FieldData * field_data)
   }
   return output;
 }
+
+//----------------------------------------------------------------------
+
+void * Refine::output_values_(FieldData * field_data) const
+{
+  if (output_ == "") return NULL;
+  Field field (cello::field_descr(),field_data);
+  return field.values(output_);
+}
+
+//----------------------------------------------------------------------
+
+int Refine::apply_tiles_ (Block * block) throw ()
+{
+  bool any_refine  = false;
+  bool all_coarsen = true;
+  tile_begin (block);
+  tile_apply (block, 0, 1, &any_refine, &all_coarsen);
+  return adapt_result (any_refine, all_coarsen, block->level());
+}
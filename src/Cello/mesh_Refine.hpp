@@ -61,6 +61,46 @@ public: // interface
   /// Return the name of the refinement criteria
   virtual std::string name () const { return "unknown"; }
 
+  /// Whether the criteria can be evaluated one tile of the Block at
+  /// a time using tile_begin() and tile_apply()
+  virtual bool is_tiled () const { return false; }
+
+  /// Whether the criteria depend only on Block position, level, and
+  /// time, and not on field or particle data.  If all criteria are
+  /// data-independent, initial conditions need only be applied to
+  /// the final leaf Blocks of the initial mesh hierarchy
+  virtual bool is_data_independent () const { return false; }
+
+  /// Prepare for evaluating tiles of the Block, e.g. computing
+  /// derived fields or initializing the output field
+  virtual void tile_begin (Block * block) throw ()
+  { }
+
+  /// Evaluate the refinement criteria on the given tile of the Block,
+  /// updating any_refine and all_coarsen.  Tiles partition the
+  /// outermost axis of the Block
+  virtual void tile_apply (Block * block, int tile, int num_tiles,
+			   bool * any_refine, bool * all_coarsen) throw ()
+  { }
+
+  /// Return the adapt result given accumulated tile results,
+  /// adjusted for the maximum level
+  int adapt_result (bool any_refine, bool all_coarsen, int level) const throw()
+  {
+    int result = any_refine ?
+      adapt_refine : (all_coarsen ? adapt_coarsen : adapt_same);
+    adjust_for_level_ (&result, level);
+    return result;
+  }
+
+  /// Whether the refinement criteria writes to an output field
+  bool has_output () const throw ()
+  { return output_ != ""; }
+
+  /// Return the maximum level allowed for this criteria
+  int max_level () const throw ()
+  { return max_level_; }
+
   /// Clear the output field to the default coarsen (-1)
   void * initialize_output_(FieldData * field_data);
 
@@ -73,6 +113,24 @@ public: // interface
 
 protected: // functions
 
+  /// Evaluate all tiles of the Block for criteria supporting tiles
+  int apply_tiles_ (Block * block) throw ();
+
+  /// Return the output field values without reinitializing them
+  void * output_values_ (FieldData * field_data) const;
+
+  /// Restrict loop limits [lo[i],hi[i]) to the given tile along the
+  /// outermost axis for the given rank
+  static void tile_limits_
+  (int tile, int num_tiles, int rank, int lo[3], int hi[3]) throw ()
+  {
+    const int axis = std::max(0,std::min(rank,3) - 1);
+    const int n = hi[axis] - lo[axis];
+    const int i0 = lo[axis];
+    lo[axis] = i0 + (n*tile)     / num_tiles;
+    hi[axis] = i0 + (n*(tile+1)) / num_tiles;
+  }
+
   /// Don't refine if already at max_level_
   void adjust_for_level_ (int * adapt_result, int level) const throw ()
   {
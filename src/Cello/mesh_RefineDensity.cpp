@@ -28,6 +28,17 @@ RefineDensity::RefineDensity
 
 int RefineDensity::apply ( Block * block ) throw ()
 {
+  return apply_tiles_(block);
+}
+
+//----------------------------------------------------------------------
+
+void RefineDensity::tile_apply
+( Block * block, int tile, int num_tiles,
+  bool * any_refine, bool * all_coarsen ) throw ()
+{
+  // refinement is already decided
+  if (*any_refine) return;
 
   Field field = block->data()->field();
 
@@ -42,60 +53,62 @@ int RefineDensity::apply ( Block * block ) throw ()
   } else {
     field.ghost_depth(id, &gx,&gy,&gz);
   }
-  char * array = field.values(id);
+  int lo[3] = {gx,gy,gz};
+  int hi[3] = {mx-gx,my-gy,mz-gz};
+  tile_limits_(tile,num_tiles,cello::rank(),lo,hi);
 
-  int adapt_result;
+  char * array = field.values(id);
 
   if (precision == precision_single) {
 
-    adapt_result = apply_ ((const float*)      array,mx,my,mz,gx,gy,gz);
+    apply_ ((const float*)      array,mx,my,mz,lo,hi,any_refine,all_coarsen);
 
   } else if (precision == precision_double) {
 
-    adapt_result = apply_ ((const double*)     array,mx,my,mz,gx,gy,gz);
+    apply_ ((const double*)     array,mx,my,mz,lo,hi,any_refine,all_coarsen);
 
   } else if (precision == precision_quadruple) {
 
-    adapt_result = apply_ ((const long double*)array,mx,my,mz,gx,gy,gz);
+    apply_ ((const long double*)array,mx,my,mz,lo,hi,any_refine,all_coarsen);
 
   } else {
     ERROR1 ("RefineDensity::apply()",
 	   "Unrecognized precision %d\n",
 	    precision);
-    adapt_result = adapt_unknown;
   }
-
-  // Don't refine if already at maximum level
-  adjust_for_level_( &adapt_result, block->level() );
-    
-  return adapt_result;
 }
 
-//----------------------------------------------------------------------s    
+//----------------------------------------------------------------------
+
 template <class T>
-int RefineDensity::apply_
+void RefineDensity::apply_
 ( const T * array,
   int mx, int my, int mz,
-  int gx, int gy, int gz ) const throw ()
+  const int lo[3], const int hi[3],
+  bool * any_refine, bool * all_coarsen) const throw ()
 {
-
-  bool any_refine  = false;
-  bool all_coarsen = true;
-  for (int iz=gz; iz<mz-gz; iz++) {
-    for (int iy=gy; iy<my-gy; iy++) {
-      for (int ix=gx; ix<mx-gx; ix++) {
-	int i = ix + mx*(iy + my*iz);
-	if (array[i] > min_refine_)  any_refine  = true;
-	if (array[i] < max_coarsen_) all_coarsen = false;
+  const double min_refine  = min_refine_;
+  const double max_coarsen = max_coarsen_;
+  bool coarsen = *all_coarsen;
+  for (int iz=lo[2]; iz<hi[2]; iz++) {
+    for (int iy=lo[1]; iy<hi[1]; iy++) {
+      const T * row = array + mx*(iy + my*iz);
+      bool row_refine = false;
+      bool row_keep   = false;
+      for (int ix=lo[0]; ix<hi[0]; ix++) {
+	row_refine |= (row[ix] > min_refine);
+	row_keep |= (row[ix] < max_coarsen);
+      }
+      coarsen = coarsen && ! row_keep;
+      if (row_refine) {
+	// refinement decided: remaining values cannot change the result
+	*any_refine  = true;
+	*all_coarsen = coarsen;
+	return;
       }
     }
   }
-  return 
-    any_refine ?  adapt_refine :
-    (all_coarsen ? adapt_coarsen : adapt_same) ;
-
+  *all_coarsen = coarsen;
 }
 
-
 //======================================================================
-
@@ -45,12 +45,19 @@ public: // interface
 
   virtual std::string name () const { return "density"; };
 
+  virtual bool is_tiled () const { return true; }
+
+  /// Evaluate the density criteria on the given tile
+  virtual void tile_apply (Block * block, int tile, int num_tiles,
+			   bool * any_refine, bool * all_coarsen) throw();
+
 private: // functions
 
   template <class T>
-  int apply_ (const T * array,
-	      int mx, int my, int mz,
-	      int gx, int gy, int gz) const throw ();
+  void apply_ (const T * array,
+	       int mx, int my, int mz,
+	       const int lo[3], const int hi[3],
+	       bool * any_refine, bool * all_coarsen) const throw ();
 
 };
 
@@ -48,6 +48,9 @@ public: // interface
 
   virtual std::string name () const { return "mask"; };
 
+  /// Mask values depend only on Block coordinates and time
+  virtual bool is_data_independent () const { return true; }
+
 private: // functions
 
 private: // attributes
@@ -35,11 +35,23 @@ RefineSlope::RefineSlope(double min_refine,
 
 int RefineSlope::apply ( Block * block ) throw ()
 {
+  return apply_tiles_(block);
+}
 
-  Field field = block->data()->field();
+//----------------------------------------------------------------------
 
-  bool all_coarsen = true;
-  bool any_refine = false;
+void RefineSlope::tile_begin ( Block * block ) throw ()
+{
+  initialize_output_(block->data()->field_data());
+}
+
+//----------------------------------------------------------------------
+
+void RefineSlope::tile_apply
+( Block * block, int tile, int num_tiles,
+  bool * any_refine, bool * all_coarsen ) throw ()
+{
+  Field field = block->data()->field();
 
   int rank = cello::rank();
 
@@ -52,10 +64,13 @@ int RefineSlope::apply ( Block * block ) throw ()
   field.cell_width(xm[1],xp[1],&h3[1]);
   field.cell_width(xm[2],xp[2],&h3[2]);
 
-  void * output = initialize_output_(field.field_data());
+  void * output = output_values_(field.field_data());
 
   for (size_t k=0; k<field_id_list_.size(); k++) {
 
+    // refinement is already decided and output is not needed
+    if (*any_refine && ! output) return;
+
     int id_field = field_id_list_[k];
 
     int gx,gy,gz;
@@ -70,6 +85,10 @@ int RefineSlope::apply ( Block * block ) throw ()
     int mx,my,mz;
     field.dimensions(id_field,&mx,&my,&mz);
 
+    int lo[3] = {gx,gy,gz};
+    int hi[3] = {mx-gx,my-gy,mz-gz};
+    tile_limits_(tile,num_tiles,rank,lo,hi);
+
     precision_type precision = field.precision(id_field);
 
     void * array = field.values(id_field);
@@ -79,20 +98,20 @@ int RefineSlope::apply ( Block * block ) throw ()
     case precision_single:
       evaluate_block_((float*) array,
 		      (float*) output, 
-		      mx,my,mz,gx,gy,gz,
-		      &any_refine,&all_coarsen, rank,h3);
+		      mx,my,mz,lo,hi,
+		      any_refine,all_coarsen, rank,h3);
       break;
     case precision_double:
       evaluate_block_((double*) array,
 		      (double*) output,
-		      mx,my,mz,gx,gy,gz,
-		      &any_refine,&all_coarsen, rank,h3);
+		      mx,my,mz,lo,hi,
+		      any_refine,all_coarsen, rank,h3);
       break;
     case precision_quadruple:
       evaluate_block_((long double*) array,
 		      (long double*) output,
-		      mx,my,mz,gx,gy,gz,
-		      &any_refine,&all_coarsen, rank,h3);
+		      mx,my,mz,lo,hi,
+		      any_refine,all_coarsen, rank,h3);
       break;
     default:
       ERROR2("RefineSlope::apply",
@@ -101,15 +120,6 @@ int RefineSlope::apply ( Block * block ) throw ()
       break;
     }
   }
-
-  int adapt_result =
-    any_refine ? adapt_refine : (all_coarsen ? adapt_coarsen : adapt_same);
-
-  // Don't refine if already at maximum level
-  adjust_for_level_ (&adapt_result,block->level());
-
-  return adapt_result;
-
 }
 
 //----------------------------------------------------------------------
@@ -117,35 +127,49 @@ int RefineSlope::apply ( Block * block ) throw ()
 template <class T>
 void RefineSlope::evaluate_block_(T * array, T * output ,
 				  int mx, int my, int mz,
-				  int gx, int gy, int gz,
+				  const int lo[3], const int hi[3],
 				  bool *any_refine,
 				  bool * all_coarsen, 
 				  int rank, 
 				  double * h3 )
 {
-  T slope;
   const int d3[3] = {1,mx,mx*my};
-  T tiny = 1e-10;
-  int count=0;
+  const T tiny = 1e-10;
+  const double min_refine  = min_refine_;
+  const double max_coarsen = max_coarsen_;
+  bool refine  = *any_refine;
+  bool coarsen = *all_coarsen;
   for (int axis=0; axis<rank; axis++) {
-    int id = d3[axis];
-    for (int iz=gz; iz<mz-gz; iz++) {
-      for (int iy=gy; iy<my-gy; iy++) {
-	for (int ix=gx; ix<mx-gx; ix++) {
-	  int i = ix + mx*(iy + my*iz);
-	  T a = std::max(T(2.0*h3[axis]*fabs(array[i])),tiny);
-	  slope = fabs( (array[i+id] - array[i-id]) / a);
-	  count++;
-	  if (slope > min_refine_)  *any_refine  = true;
-	  if (slope > max_coarsen_) *all_coarsen = false;
+    const int id = d3[axis];
+    const T h2 = 2.0*h3[axis];
+    for (int iz=lo[2]; iz<hi[2]; iz++) {
+      for (int iy=lo[1]; iy<hi[1]; iy++) {
+	// early exit: refinement decided and no output field to fill
+	if (refine && ! output) {
+	  *any_refine  = refine;
+	  *all_coarsen = coarsen;
+	  return;
+	}
+	const int i0 = mx*(iy + my*iz);
+	bool row_refine = false;
+	bool row_keep   = false;
+	for (int ix=lo[0]; ix<hi[0]; ix++) {
+	  const int i = ix + i0;
+	  const T a = std::max(T(h2*fabs(array[i])),tiny);
+	  const T slope = fabs( (array[i+id] - array[i-id]) / a);
+	  row_refine |= (slope > min_refine);
+	  row_keep |= (slope > max_coarsen);
 	  if (output) {
-	    if (slope > max_coarsen_) output[i] =  0;
-	    if (slope > min_refine_)  output[i] = +1;
+	    if (slope > max_coarsen) output[i] =  0;
+	    if (slope > min_refine)  output[i] = +1;
 	  }
 	}
+	refine  = refine  || row_refine;
+	coarsen = coarsen && ! row_keep;
       }
     }
   }
+  *any_refine  = refine;
+  *all_coarsen = coarsen;
 }
 //======================================================================
-
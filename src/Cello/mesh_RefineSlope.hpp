@@ -46,12 +46,21 @@ public: // interface
 
   virtual std::string name () const { return "slope"; };
 
+  virtual bool is_tiled () const { return true; }
+
+  /// Initialize the output field if any
+  virtual void tile_begin (Block * block) throw();
+
+  /// Evaluate the slope criteria on the given tile of all fields
+  virtual void tile_apply (Block * block, int tile, int num_tiles,
+			   bool * any_refine, bool * all_coarsen) throw();
+
 private: // functions
 
   template <class T>
   void evaluate_block_(T * array,  T * output,
 		       int ndx, int ndy, int ndz,
-		       int gx, int gy, int gz,
+		       const int lo[3], const int hi[3],
 		       bool * any_refine,
 		       bool * all_coarsen, 
 		       int rank, 
@@ -70,6 +70,7 @@ void Config::pup (PUP::er &p)
   PUParray(p,field_ghost_depth,3);
   p | field_padding;
   p | field_history;
+  p | field_history_mode;
   p | field_precision;
   p | field_prolong;
   p | field_restrict;
@@ -93,6 +94,7 @@ void Config::pup (PUP::er &p)
   p | memory_active;
   p | memory_warning_mb;
   p | memory_limit_gb;
+  p | memory_lazy_non_leaf;
 
   // Mesh
 
@@ -118,6 +120,7 @@ void Config::pup (PUP::er &p)
   p | method_flux_correct_min_digits;
   p | method_timestep;
   p | method_trace_name;
+  p | method_trace_order;
   p | method_null_dt;
 
   // Monitor
@@ -146,6 +149,12 @@ void Config::pup (PUP::er &p)
   p | output_image_face_rank;
   p | output_image_min;
   p | output_image_max;
+  p | output_image_format;
+  p | output_image_num_threads;
+  p | output_image_product_field;
+  p | output_image_product_axis;
+  p | output_image_product_reduce;
+  p | output_image_product_colormap;
   p | output_min_level;
   p | output_max_level;
   p | output_leaf_only;
@@ -179,6 +188,7 @@ void Config::pup (PUP::er &p)
   PUParray (p,particle_attribute_position,3);
   PUParray (p,particle_attribute_velocity,3);
   p | particle_batch_size;
+  p | particle_slab;
   p | particle_group_list;
 
   // Performance
@@ -188,6 +198,9 @@ void Config::pup (PUP::er &p)
   p | performance_warnings;
   p | performance_on_schedule_index;
   p | performance_off_schedule_index;
+  p | performance_timeline_schedule_index;
+  p | performance_timeline_size;
+  p | performance_timeline_file;
 
   // Physics
   
@@ -581,6 +594,24 @@ void Config::read_field_ (Parameters * p) throw()
 
   field_history = p->value_integer("Field:history",0);
 
+  // How history is saved for each field (Field : <field_name> : history)
+
+  field_history_mode.resize(num_fields);
+
+  for (int index_field=0; index_field<num_fields; index_field++) {
+
+    param = std::string("Field:") + field_list[index_field] + ":history";
+
+    std::string history = p->value_string(param,"copy");
+
+    ASSERT2 ("Config::read_field_()",
+	     "Parameter %s = \"%s\" must be \"none\", \"copy\", or \"swap\"",
+	     param.c_str(),history.c_str(),
+	     (history == "none" || history == "copy" || history == "swap"));
+
+    field_history_mode[index_field] = history;
+  }
+
   // Field precision
 
   std::string precision_str = p->value_string("Field:precision","default");
@@ -642,6 +673,7 @@ void Config::read_memory_ (Parameters * p) throw()
   memory_active = p->value_logical("Memory:active",true);
   memory_warning_mb =  p->value_float("Memory:warning_mb",0.0);
   memory_limit_gb =    p->value_float("Memory:limit_gb",0.0);
+  memory_lazy_non_leaf = p->value_logical("Memory:lazy_non_leaf",false);
 }
 
 //----------------------------------------------------------------------
@@ -716,6 +748,7 @@ void Config::read_method_ (Parameters * p) throw()
   method_close_files_seconds_delay.resize(num_method);
   method_close_files_group_size.resize(num_method);
   method_trace_name.resize(num_method);
+  method_trace_order.resize(num_method);
   
   method_courant_global = p->value_float ("Method:courant",1.0);
   
@@ -768,6 +801,14 @@ void Config::read_method_ (Parameters * p) throw()
 
     method_trace_name[index_method] = p->value_string
       (full_name + ":name", "trace");
+    method_trace_order[index_method] = p->value_integer
+      (full_name + ":order", 1);
+
+    ASSERT2 ("Config::read_method_()",
+	     "Method %s:order = %d must be 1 or 2",
+	     full_name.c_str(),method_trace_order[index_method],
+	     (method_trace_order[index_method] == 1 ||
+	      method_trace_order[index_method] == 2));
   }
   method_null_dt = p->value_float
     ("Method:null:dt",std::numeric_limits<double>::max());
@@ -820,6 +861,12 @@ void Config::read_output_ (Parameters * p) throw()
   output_image_face_rank.resize(num_output);
   output_image_min.resize(num_output);
   output_image_max.resize(num_output);
+  output_image_format.resize(num_output);
+  output_image_num_threads.resize(num_output);
+  output_image_product_field.resize(num_output);
+  output_image_product_axis.resize(num_output);
+  output_image_product_reduce.resize(num_output);
+  output_image_product_colormap.resize(num_output);
   output_min_level.resize(num_output);
   output_max_level.resize(num_output);
   output_leaf_only.resize(num_output);
@@ -965,6 +1012,23 @@ void Config::read_output_ (Parameters * p) throw()
       output_image_max[index_output] =
 	p->value_float("image_max",-std::numeric_limits<double>::max());
 
+      // Image file format "png", "raw_uint8", or "raw_float", and
+      // number of node PEs used to colormap and compress the image
+
+      output_image_format[index_output] =
+	p->value_string("image_format","png");
+      ASSERT2("Config::read()",
+	      "Output %s image_format %s must be \"png\", \"raw_uint8\", "
+	      "or \"raw_float\"",
+	      output_list[index_output].c_str(),
+	      output_image_format[index_output].c_str(),
+	      (output_image_format[index_output] == "png" ||
+	       output_image_format[index_output] == "raw_uint8" ||
+	       output_image_format[index_output] == "raw_float"));
+
+      output_image_num_threads[index_output] =
+	p->value_integer("image_num_threads",1);
+
       output_min_level[index_output] = p->value_integer("min_level",0);
       output_max_level[index_output] =
 	p->value_integer("max_level",std::numeric_limits<int>::max());
@@ -979,6 +1043,71 @@ void Config::read_output_ (Parameters * p) throw()
 	}
       }
 
+      // Image products "field[:axis[:reduce[:colormap]]]", rendered
+      // together in a single output pass; colormap names a list
+      // parameter "colormap_<colormap>" in the same Output group
+
+      if (p->type("image_products") == parameter_list) {
+	const int num_products = p->list_length("image_products");
+	output_image_product_field   [index_output].resize(num_products);
+	output_image_product_axis    [index_output].resize(num_products);
+	output_image_product_reduce  [index_output].resize(num_products);
+	output_image_product_colormap[index_output].resize(num_products);
+	for (int k=0; k<num_products; k++) {
+	  std::string product = p->list_value_string(k,"image_products","");
+	  std::vector<std::string> items;
+	  size_t i0 = 0, i1;
+	  while ((i1 = product.find(':',i0)) != std::string::npos) {
+	    items.push_back(product.substr(i0,i1-i0));
+	    i0 = i1 + 1;
+	  }
+	  items.push_back(product.substr(i0));
+
+	  std::string field  = items[0];
+	  std::string axis   = (items.size() > 1 && items[1] != "") ?
+	    items[1] : output_axis[index_output];
+	  std::string reduce = (items.size() > 2 && items[2] != "") ?
+	    items[2] : output_image_reduce_type[index_output];
+	  std::string colormap = (items.size() > 3) ? items[3] : "";
+
+	  ASSERT2("Config::read()",
+		  "Output %s image product \"%s\" is missing the field",
+		  output_list[index_output].c_str(), product.c_str(),
+		  field != "");
+	  ASSERT2("Config::read()",
+		  "Output %s image product axis %s must be \"x\", \"y\", or \"z\"",
+		  output_list[index_output].c_str(), axis.c_str(),
+		  axis=="x" || axis=="y" || axis=="z");
+
+	  output_image_product_field [index_output][k] = field;
+	  output_image_product_axis  [index_output][k] = axis;
+	  output_image_product_reduce[index_output][k] = reduce;
+
+	  if (colormap != "") {
+	    std::string param = "colormap_" + colormap;
+	    ASSERT2("Config::read()",
+		    "Output %s image product colormap parameter %s is not a list",
+		    output_list[index_output].c_str(), param.c_str(),
+		    p->type(param) == parameter_list);
+	    int size = p->list_length(param);
+	    output_image_product_colormap[index_output][k].resize(size);
+	    for (int i=0; i<size; i++) {
+	      output_image_product_colormap[index_output][k][i] =
+		p->list_value_float(i,param,0.0);
+	    }
+	  }
+
+	  // Add product fields to field_list so derived fields are computed
+
+	  std::vector<std::string> & field_list =
+	    output_field_list[index_output];
+	  if (std::find(field_list.begin(),field_list.end(),field) ==
+	      field_list.end()) {
+	    field_list.push_back(field);
+	  }
+	}
+      }
+
       output_image_lower[index_output].resize(3);
       output_image_upper[index_output].resize(3);
       for (int axis=0; axis<3; axis++) {
@@ -1002,6 +1131,7 @@ void Config::read_particle_ (Parameters * p) throw()
   //--------------------------------------------------
 
   particle_batch_size = p->value_integer("Particle:batch_size",1024);
+  particle_slab       = p->value_logical("Particle:slab",false);
 
   num_particles = p->list_length("Particle:list"); 
 
@@ -1210,6 +1340,20 @@ void Config::read_performance_ (Parameters * p) throw()
 
   performance_warnings = p->value_logical("Performance:warnings",false);
 
+  // Timeline tracing of Block phases is enabled by defining its schedule
+
+  if (p->type("Performance:timeline:schedule:var") != parameter_unknown) {
+    p->group_set(0,"Performance");
+    p->group_push("timeline");
+    p->group_push("schedule");
+    performance_timeline_schedule_index = read_schedule_(p,"timeline");
+    p->group_clear();
+  }
+  performance_timeline_size = p->value_integer
+    ("Performance:timeline:size",100000);
+  performance_timeline_file = p->value_string
+    ("Performance:timeline:file","timeline");
+
 #ifdef CONFIG_USE_PROJECTIONS
   
   int i_on = -1;
@@ -52,6 +52,7 @@ public: // interface
     field_alignment(0),
     field_padding(0),
     field_history(0),
+    field_history_mode(),
     field_precision(0),
     field_prolong(""),
     field_restrict(""),
@@ -69,6 +70,7 @@ public: // interface
     memory_active(false),
     memory_warning_mb(0.0),
     memory_limit_gb(0.0),
+    memory_lazy_non_leaf(false),
     mesh_root_rank(0),
     mesh_min_level(0),
     mesh_max_level(0),
@@ -86,6 +88,7 @@ public: // interface
     method_flux_correct_min_digits(),
     method_timestep(),
     method_trace_name(),
+    method_trace_order(),
   // MethodNull
     method_null_dt(0.0),
     monitor_debug(false),
@@ -109,6 +112,12 @@ public: // interface
     output_image_face_rank(),
     output_image_min(),
     output_image_max(),
+    output_image_format(),
+    output_image_num_threads(),
+    output_image_product_field(),
+    output_image_product_axis(),
+    output_image_product_reduce(),
+    output_image_product_colormap(),
     output_schedule_index(),
     output_max_level(),
     output_min_level(),
@@ -136,12 +145,16 @@ public: // interface
     particle_attribute_name(),
     particle_attribute_type(),
     particle_batch_size(0),
+    particle_slab(false),
     particle_group_list(),
     performance_papi_counters(),
     performance_projections_on_at_start(true),
     performance_warnings(false),
     performance_on_schedule_index(-1),
     performance_off_schedule_index(-1),
+    performance_timeline_schedule_index(-1),
+    performance_timeline_size(0),
+    performance_timeline_file(""),
     num_physics(0),
     physics_list(),
     restart_file(""),
@@ -209,6 +222,7 @@ public: // interface
       field_alignment(0),
       field_padding(0),
       field_history(0),
+      field_history_mode(),
       field_precision(0),
       field_prolong(""),
       field_restrict(""),
@@ -226,6 +240,7 @@ public: // interface
       memory_active(false),
       memory_warning_mb(0.0),
       memory_limit_gb(0.0),
+      memory_lazy_non_leaf(false),
       mesh_root_rank(0),
       mesh_min_level(0),
       mesh_max_level(0),
@@ -243,6 +258,7 @@ public: // interface
       method_flux_correct_min_digits(),
       method_timestep(),
       method_trace_name(),
+      method_trace_order(),
       method_null_dt(0.0),
       monitor_debug(false),
       monitor_verbose(false),
@@ -265,6 +281,12 @@ public: // interface
       output_image_face_rank(),
       output_image_min(),
       output_image_max(),
+      output_image_format(),
+      output_image_num_threads(),
+      output_image_product_field(),
+      output_image_product_axis(),
+      output_image_product_reduce(),
+      output_image_product_colormap(),
       output_schedule_index(),
       output_max_level(),
       output_min_level(),
@@ -292,12 +314,16 @@ public: // interface
       particle_attribute_name(),
       particle_attribute_type(),
       particle_batch_size(0),
+      particle_slab(false),
       particle_group_list(),
       performance_papi_counters(),
       performance_projections_on_at_start(true),
       performance_warnings(false),
       performance_on_schedule_index(-1),
       performance_off_schedule_index(-1),
+      performance_timeline_schedule_index(-1),
+      performance_timeline_size(0),
+      performance_timeline_file(""),
       num_physics(0),
       physics_list(),
       restart_file(""),
@@ -397,6 +423,7 @@ public: // attributes
   int                        field_ghost_depth[3];
   int                        field_padding;
   int                        field_history;
+  std::vector<std::string>   field_history_mode;
   int                        field_precision;
   std::string                field_prolong;
   std::string                field_restrict;
@@ -421,6 +448,7 @@ public: // attributes
   bool                       memory_active;
   double                     memory_warning_mb;
   double                     memory_limit_gb;
+  bool                       memory_lazy_non_leaf;
 
   // Mesh
 
@@ -446,6 +474,7 @@ public: // attributes
   std::vector<double>        method_flux_correct_min_digits;
   std::vector<double>        method_timestep;
   std::vector<std::string>   method_trace_name;
+  std::vector<int>           method_trace_order;
   double                     method_null_dt;
 
 
@@ -475,6 +504,13 @@ public: // attributes
   std::vector < int >         output_image_face_rank;
   std::vector < double>       output_image_min;
   std::vector < double>       output_image_max;
+  std::vector < std::string>  output_image_format;
+  std::vector < int >         output_image_num_threads;
+  std::vector < std::vector <std::string> > output_image_product_field;
+  std::vector < std::vector <std::string> > output_image_product_axis;
+  std::vector < std::vector <std::string> > output_image_product_reduce;
+  std::vector < std::vector < std::vector <double> > >
+                              output_image_product_colormap;
   std::vector < int >         output_schedule_index;
   std::vector < int >         output_max_level;
   std::vector < int >         output_min_level;
@@ -511,6 +547,7 @@ public: // attributes
   std::vector <int>          particle_attribute_velocity[3];
 
   int                        particle_batch_size;
+  bool                       particle_slab;
   std::vector< std::vector<std::string> >  particle_group_list;
 
   // Performance
@@ -520,6 +557,9 @@ public: // attributes
   bool                       performance_warnings;
   int                        performance_on_schedule_index;
   int                        performance_off_schedule_index;
+  int                        performance_timeline_schedule_index;
+  int                        performance_timeline_size;
+  std::string                performance_timeline_file;
 
   // Physics
   
@@ -308,6 +308,28 @@ std::string Param::value_to_string (int type)
  
 //----------------------------------------------------------------------
 
+bool Param::uses_variable (char variable) const
+{
+  if (type_ == parameter_float_expr || type_ == parameter_logical_expr) {
+    return uses_variable_(value_expr_,variable);
+  } else {
+    return false;
+  }
+}
+
+//----------------------------------------------------------------------
+
+bool Param::uses_variable_ (const struct node_expr * node, char variable)
+{
+  if (node == NULL) return false;
+  if (node->type == enum_node_variable && node->var_value == variable)
+    return true;
+  return (uses_variable_(node->left,variable) ||
+	  uses_variable_(node->right,variable));
+}
+
+//----------------------------------------------------------------------
+
 void Param::evaluate_float
 (int                n, 
  double *           result, 
@@ -99,6 +99,10 @@ public: // interface
     double             t,
     struct node_expr * node = 0);
 
+  /// Return whether an expression refers to the given variable,
+  /// e.g. 't' for time-dependent expressions
+  bool uses_variable (char variable) const;
+
   /// Set the parameter type and value
   void set(struct param_struct * param);
 
@@ -143,6 +147,9 @@ private: // functions
   /// PUP a logical or floating-point expression (recursive)
   void pup_expr_ (PUP::er &p, struct node_expr ** node);
 
+  /// Return whether the expression tree refers to the variable (recursive)
+  static bool uses_variable_ (const struct node_expr * node, char variable);
+
   /// Set an integer parameter
   void set_integer_ (int value)
   { 
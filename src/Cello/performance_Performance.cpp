@@ -29,6 +29,8 @@ Performance::Performance (Config * config)
   region_started_(),
   region_index_(),
   region_in_charm_(),
+  region_parent_(),
+  group_region_(num_perf_group),
 #ifdef CONFIG_USE_PAPI  
   papi_counters_(0),
 #endif
@@ -47,6 +49,7 @@ Performance::Performance (Config * config)
   new_counter(counter_type_abs,"bytes-high");
   new_counter(counter_type_abs,"bytes-highest");
   new_counter(counter_type_abs,"bytes-available");
+  new_counter(counter_type_abs,"bytes-saved");
 
 #ifdef CONFIG_USE_PAPI  
   papi_.init();
@@ -105,6 +108,11 @@ Performance::new_counter ( int type, std::string  counter_name )
   counter_values_.push_back(0);
   counter_values_reduced_.push_back(0);
 
+  // extend counters for any regions already created
+  for (size_t ir=0; ir<region_counters_.size(); ir++) {
+    region_counters_[ir].resize(counter_name_.size());
+  }
+
 #ifdef CONFIG_USE_PAPI  
   if (type == counter_type_papi) {
     papi_.add_event(counter_name);
@@ -140,6 +148,7 @@ Performance::refresh_counters_() throw()
   counter_values_[perf_index_bytes_high]    = memory->bytes_high();
   counter_values_[perf_index_bytes_highest] = memory->bytes_highest();
   counter_values_[perf_index_bytes_available] = memory->bytes_available();
+  counter_values_[perf_index_bytes_saved]   = memory->bytes_saved();
 
 }
 
@@ -205,25 +214,62 @@ Performance::new_region (int         region_index,
   if ((size_t)region_index >= region_name_.size()) {
     region_name_.resize(region_index+1);
     region_in_charm_.resize(region_index+1);
+    region_parent_.resize(region_index+1,-1);
+    region_counters_.resize(region_index+1);
+    region_started_.resize(region_index+1,false);
   }
 
   region_name_[region_index]    = region_name;
   region_index_[region_name]    = region_index;
   region_in_charm_[region_index] = in_charm;
+  region_parent_[region_index]  = -1;
+
+  region_counters_[region_index].resize(num_counters());
+  region_started_[region_index] = false;
+}
+
+//----------------------------------------------------------------------
+
+int
+Performance::new_group_region (int         group,
+			       int         index,
+			       int         index_parent,
+			       std::string region_name) throw()
+{
+  ASSERT2 ("Performance::new_group_region()",
+	   "group %d out of range [0,%d)",
+	   group, num_perf_group,
+	   (0 <= group && group < num_perf_group));
+
+  // qualify name with parent name, e.g. "compute:method-ppm"
+  if (index_parent >= 0) {
+    region_name = region_name_[index_parent] + ":" + region_name;
+  }
+
+  // reuse region if it already exists, e.g. the same Refresh name
+  // is shared between multiple objects
+  int index_region = region_index(region_name);
+  if (index_region < 0) {
+    index_region = num_regions();
+    new_region (index_region, region_name);
+    region_parent_[index_region] = index_parent;
+  }
+
+  std::vector<int> & regions = group_region_[group];
+  if (index >= int(regions.size())) regions.resize(index+1,-1);
+  regions[index] = index_region;
 
-  std::vector <long long> counters;
-  region_counters_.push_back(counters);
-  region_started_.push_back(false);
+  return index_region;
 }
 
 //----------------------------------------------------------------------
 
 void
-Performance::start_region(int id_region, std::string file, int line) throw()
+Performance::start_region(int id_region, const char * file, int line) throw()
 {
 #ifdef TRACE_PERFORMANCE
   CkPrintf ("%d TRACE_PERFORMANCE Performance::start_region (%d,%s) %s:%d\n",CkMyPe(),
-	    id_region,region_name_[id_region].c_str(),file.c_str(),line);
+	    id_region,region_name_[id_region].c_str(),file,line);
 #endif
 
   if (region_in_charm_[index_region_current_]) {
@@ -239,7 +285,7 @@ Performance::start_region(int id_region, std::string file, int line) throw()
     region_started_[index_region] = true;
 
   } else if (warnings_) {
-    if (file == "") {
+    if (file == NULL || file[0] == '\0') {
       WARNING1 ("Performance::start_region",
 		"Region %s already started",
 		region_name_[id_region].c_str());
@@ -247,7 +293,7 @@ Performance::start_region(int id_region, std::string file, int line) throw()
       WARNING3 ("Performance::start_region",
     		"Region %s already started %s %d",
     		region_name_[id_region].c_str(),
-    		file.c_str(),line);
+    		file,line);
     }
     return;
   }
@@ -267,12 +313,12 @@ Performance::start_region(int id_region, std::string file, int line) throw()
 //----------------------------------------------------------------------
 
 void
-Performance::stop_region(int id_region, std::string file, int line) throw()
+Performance::stop_region(int id_region, const char * file, int line) throw()
 {
 
 #ifdef TRACE_PERFORMANCE
   CkPrintf ("%d TRACE_PERFORMANCE Performance::stop_region (%d,%s) %s:%d\n",CkMyPe(),
-	    id_region,region_name_[id_region].c_str(),file.c_str(),line);
+	    id_region,region_name_[id_region].c_str(),file,line);
 #endif
 
   int index_region = id_region;
@@ -282,7 +328,7 @@ Performance::stop_region(int id_region, std::string file, int line) throw()
     region_started_[index_region] = false;
 
   } else if (warnings_) {
-    if (file == "") {
+    if (file == NULL || file[0] == '\0') {
       WARNING1 ("Performance::stop_region",
 		"Region %s already stopped",
 		region_name_[id_region].c_str());
@@ -290,7 +336,7 @@ Performance::stop_region(int id_region, std::string file, int line) throw()
       WARNING3 ("Performance::stop_region",
 		"Region %s already stopped %s %d",
 		region_name_[id_region].c_str(),
-		file.c_str(),line);
+		file,line);
     }
     return;
   }
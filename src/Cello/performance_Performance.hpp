@@ -27,6 +27,7 @@ enum index_enum {
   perf_index_bytes_high,
   perf_index_bytes_highest,
   perf_index_bytes_available,
+  perf_index_bytes_saved,
   perf_index_last,
   num_perf_index = perf_index_last
 };
@@ -64,6 +65,17 @@ enum perf_region {
   num_perf_region
 };
 
+/// @enum    perf_group
+/// @brief   groups of sub-regions created automatically for each
+/// Method, Solver, Refine, and Refresh object in the Problem
+enum perf_group {
+  perf_group_method,
+  perf_group_solver,
+  perf_group_refine,
+  perf_group_refresh,
+  num_perf_group
+};
+
 class Performance {
 
   /// @class    Performance
@@ -87,6 +99,8 @@ public: // interface
      region_started_(),
      region_index_(),
      region_in_charm_(),
+     region_parent_(),
+     group_region_(num_perf_group),
 #ifdef CONFIG_USE_PAPI     
      papi_counters_(0),
 #endif
@@ -118,6 +132,8 @@ public: // interface
     p | region_started_;
     p | region_index_;
     p | region_in_charm_;
+    p | region_parent_;
+    p | group_region_;
 #ifdef CONFIG_USE_PAPI  
     WARNING("Performance::pup",
 	    "skipping Performance:papi_counters_");
@@ -174,14 +190,31 @@ public: // interface
   /// Add a new region, returning the id
   void new_region(int index_region, std::string region, bool in_charm=false) throw();
 
+  /// Add a new region nested inside the given parent region for the
+  /// ith object of the given perf_group, returning the region index
+  int new_group_region(int group, int index, int index_parent,
+                       std::string region) throw();
+
+  /// Return the region index for the ith object in the given
+  /// perf_group, or -1 if none has been created
+  int group_region (int group, int index) const throw()
+  {
+    const std::vector<int> & regions = group_region_[group];
+    return (0 <= index && index < int(regions.size())) ? regions[index] : -1;
+  }
+
+  /// Return the parent of the given region, or -1 if it is a root region
+  int region_parent (int index_region) const throw()
+  { return region_parent_[index_region]; }
+
   /// Return whether performance monitoring is started for the region 
   bool is_region_active(int index_region) throw();
 
   /// Start counters for a code region
-  void start_region(int index_region, std::string file="", int line=0) throw();
+  void start_region(int index_region, const char * file="", int line=0) throw();
 
   /// Stop counters for a code region
-  void stop_region(int index_region,  std::string file="", int line=0) throw();
+  void stop_region(int index_region,  const char * file="", int line=0) throw();
 
   /// Clear the counters for a code region
   void clear_region(int index_region) throw();
@@ -203,13 +236,12 @@ private: // functions
   /// Refresh the array of current counter values
   void refresh_counters_() throw();
 
-  /// Return the current time in usec
+  /// Return the current time in usec from the monotonic clock
   long long time_real_ () const
   {
-    struct timeval tv;
-    struct timezone tz;
-    gettimeofday (&tv,&tz);
-    return (long long )(1000000) * tv.tv_sec + tv.tv_usec;
+    struct timespec ts;
+    clock_gettime (CLOCK_MONOTONIC,&ts);
+    return (long long )(1000000) * ts.tv_sec + ts.tv_nsec / 1000;
   }
 
   //==================================================
@@ -248,6 +280,12 @@ private: // attributes
   /// which regions are outside scope of Cello
   std::vector<char> region_in_charm_;
 
+  /// parent region of each region, or -1 for root regions
+  std::vector<int> region_parent_;
+
+  /// region indices for Method, Solver, Refine, and Refresh objects
+  std::vector< std::vector<int> > group_region_;
+
 #ifdef CONFIG_USE_PAPI  
   /// Array for storing PAPI counter values
   long long * papi_counters_;
@@ -0,0 +1,65 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     performance_Timeline.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    Implementation of the Timeline class
+
+#include "cello.hpp"
+
+#include "performance.hpp"
+
+// #define TRACE_TIMELINE
+
+//----------------------------------------------------------------------
+
+void Timeline::write (int cycle) throw()
+{
+  if (! is_active() || cycle == cycle_write_) return;
+
+  cycle_write_ = cycle;
+
+  char file_name[256];
+  snprintf (file_name,sizeof(file_name),"%s-%06d-%05d.json",
+	    file_name_.c_str(),cycle,CkMyPe());
+
+#ifdef TRACE_TIMELINE
+  CkPrintf ("%d TRACE_TIMELINE Timeline::write(%d) %s %d events\n",
+	    CkMyPe(),cycle,file_name,num_events());
+#endif
+
+  FILE * fp = fopen (file_name,"w");
+
+  if (fp == NULL) {
+    WARNING1 ("Timeline::write()",
+	      "Cannot open timeline file %s for writing",
+	      file_name);
+    clear();
+    return;
+  }
+
+  const int n = num_events();
+  const int size = events_.size();
+  // index of oldest event in ring buffer
+  const int i0 = (count_ > size) ? (count_ % size) : 0;
+
+  fprintf (fp,"{\"traceEvents\":[\n");
+  for (int k=0; k<n; k++) {
+    const TimelineEvent & event = events_[(i0 + k) % size];
+    fprintf (fp,
+	     "{\"name\":\"%s\",\"cat\":\"block\",\"ph\":\"%s\","
+	     "\"ts\":%lld,\"pid\":%d,\"tid\":%d,"
+	     "\"id\":\"%08X-%08X-%08X\"}%s\n",
+	     event.name,
+	     (event.phase == timeline_begin) ? "b" : "e",
+	     event.time, CkMyNode(), CkMyPe(),
+	     event.v3[0],event.v3[1],event.v3[2],
+	     (k < n-1) ? "," : "");
+  }
+  fprintf (fp,"],\n\"otherData\":{\"cycle\":%d,\"events_lost\":%lld}}\n",
+	   cycle,num_events_lost());
+
+  fclose (fp);
+
+  clear();
+}
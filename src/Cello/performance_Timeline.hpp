@@ -0,0 +1,128 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     performance_Timeline.hpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    [\ref Performance] Declaration of the Timeline class
+
+#ifndef PERFORMANCE_TIMELINE_HPP
+#define PERFORMANCE_TIMELINE_HPP
+
+/// @enum     timeline_phase_enum
+/// @brief    Type of a Timeline event
+enum timeline_phase_enum {
+  timeline_begin,
+  timeline_end
+};
+
+class Timeline {
+
+  /// @class    Timeline
+  /// @ingroup  Performance
+  /// @brief    [\ref Performance] Per-process ring buffer of begin /
+  /// end events for Block phases, written as Chrome trace JSON
+  ///
+  /// @details Events are recorded with a static name string, the
+  /// monotonic clock time, and the Block index values identifying the
+  /// Block.  When the buffer is full the oldest events are
+  /// overwritten.  Files can be loaded into chrome://tracing or
+  /// https://ui.perfetto.dev, with one file written per process.
+
+public: // interface
+
+  /// Create a Timeline object
+  Timeline(bool active = false, int capacity = 0,
+	   std::string file_name = "timeline") throw()
+    : active_(active),
+      events_(active ? capacity : 0),
+      count_(0),
+      file_name_(file_name),
+      cycle_write_(-1)
+  { }
+
+  /// CHARM++ Pack / Unpack function
+  inline void pup (PUP::er &p)
+  {
+    TRACEPUP;
+    // NOTE: change this function whenever attributes change
+    // NOTE: recorded events are not packed
+    p | active_;
+    int capacity = events_.size();
+    p | capacity;
+    if (p.isUnpacking()) events_.resize(capacity);
+    p | file_name_;
+    p | cycle_write_;
+  }
+
+  /// Return whether events are being recorded
+  bool is_active() const throw()
+  { return active_ && events_.size() > 0; }
+
+  /// Record an event for the given Block index values
+  void record (const char * name, int phase, const int v3[3]) throw()
+  {
+    if (! is_active()) return;
+    TimelineEvent & event = events_[count_ % events_.size()];
+    event.name  = name;
+    event.phase = phase;
+    event.time  = time_usec_();
+    event.v3[0] = v3[0];
+    event.v3[1] = v3[1];
+    event.v3[2] = v3[2];
+    ++count_;
+  }
+
+  /// Write recorded events for the given cycle to a JSON file, then
+  /// clear the buffer.  Only writes once per cycle.
+  void write (int cycle) throw();
+
+  /// Return the number of events currently stored
+  int num_events() const throw()
+  { return std::min(count_,(long long)(events_.size())); }
+
+  /// Return the number of events discarded since the last write
+  long long num_events_lost() const throw()
+  { return count_ - num_events(); }
+
+  /// Clear all recorded events
+  void clear() throw()
+  { count_ = 0; }
+
+private: // functions
+
+  /// Return the current monotonic clock time in microseconds
+  static long long time_usec_ () throw()
+  {
+    struct timespec ts;
+    clock_gettime (CLOCK_MONOTONIC,&ts);
+    return (long long)(1000000) * ts.tv_sec + ts.tv_nsec / 1000;
+  }
+
+private: // attributes
+
+  /// Single recorded event
+  struct TimelineEvent {
+    const char * name;
+    int phase;
+    long long time;
+    int v3[3];
+  };
+
+  /// Whether events are recorded
+  bool active_;
+
+  /// Ring buffer of events
+  std::vector<TimelineEvent> events_;
+
+  /// Total number of events recorded since last clear()
+  long long count_;
+
+  /// File name prefix for output files
+  std::string file_name_;
+
+  /// Last cycle written, to write at most once per cycle
+  int cycle_write_;
+
+};
+
+#endif /* PERFORMANCE_TIMELINE_HPP */
@@ -9,7 +9,7 @@
 #ifndef PERFORMANCE_TIMER_HPP
 #define PERFORMANCE_TIMER_HPP
 
-#include <sys/time.h>
+#include <time.h>
 
 class Timer {
 
@@ -23,7 +23,7 @@ public: // interface
   Timer() throw()
   : time_(0),
     is_running_(false),
-    t1_(),t2_(),tz_()
+    t1_(),t2_()
   {
   }
 
@@ -39,25 +39,24 @@ public: // interface
     p | is_running_;
     
     p | t1_.tv_sec;
-    p | t1_.tv_usec;
+    p | t1_.tv_nsec;
     p | t2_.tv_sec;
-    p | t2_.tv_usec;
-    // tz_ only there for gettimeofday() calls: value is never used
+    p | t2_.tv_nsec;
   }
 
   /// Start the timer
   void start() throw()
   { 
     is_running_ = true;
-    gettimeofday(&t1_, &tz_);
+    clock_gettime(CLOCK_MONOTONIC, &t1_);
   }
 
   /// Stop the timer
   float stop() throw()
   { 
     if (is_running_) {
-      gettimeofday(&t2_, &tz_);
-      time_ += (t2_.tv_sec-t1_.tv_sec) + 1e-6*(t2_.tv_usec-t1_.tv_usec);
+      clock_gettime(CLOCK_MONOTONIC, &t2_);
+      time_ += elapsed_(t1_,t2_);
       is_running_ = false;
     }
     return time_;
@@ -67,7 +66,7 @@ public: // interface
   void clear() throw()
   { 
     stop();
-    gettimeofday(&t1_, &tz_);
+    clock_gettime(CLOCK_MONOTONIC, &t1_);
     time_ = 0.0;
   }
 
@@ -76,10 +75,9 @@ public: // interface
   float value() const throw()
   {
     if (is_running_) {
-      gettimeofday((struct timeval *) &t2_, 
-		   (struct timezone *)&tz_);
-      return time_ + 
-	(t2_.tv_sec-t1_.tv_sec) + 1e-6*(t2_.tv_usec-t1_.tv_usec);
+      struct timespec t2;
+      clock_gettime(CLOCK_MONOTONIC, &t2);
+      return time_ + elapsed_(t1_,t2);
     } else {
       return time_;
     }
@@ -89,15 +87,21 @@ public: // interface
   // /// Display the timer information
   // void print () const throw();
 
+private: // functions
+
+  /// Return the elapsed time in seconds between two clock values
+  static float elapsed_
+  (const struct timespec & t1, const struct timespec & t2) throw()
+  { return (t2.tv_sec-t1.tv_sec) + 1e-9*(t2.tv_nsec-t1.tv_nsec); }
+
 private: // attributes
 
   /// The accumulated time
   float time_;
   /// Whether the timer is currently running
   bool is_running_;
-  /// Struct values for gettimeofday()
-  struct timeval t1_, t2_;
-  struct timezone tz_;
+  /// Struct values for clock_gettime() using CLOCK_MONOTONIC
+  struct timespec t1_, t2_;
 
 };
 
@@ -18,6 +18,11 @@ class Boundary : public PUP::able
 
 public: // interface
 
+  /// Cached Boundary values keyed by Boundary object and combined
+  /// face, axis, and field id
+  typedef std::map< std::pair<const Boundary *,int>, std::vector<char> >
+  Cache;
+
   /// Create a new Boundary
   Boundary() throw() 
   : axis_(axis_all), face_(face_all), mask_(nullptr)
@@ -5,25 +5,41 @@
 /// @date     2014-04-02
 /// @brief    Implementation of the default BoundaryValue boundary value class
 
+#include <cstring>
+
 #include "problem.hpp"
 
+/// Maximum bytes of cached boundary values per Block
+#define BOUNDARY_CACHE_MAX_BYTES (16*1024*1024)
+
 //----------------------------------------------------------------------
 
 void BoundaryValue::enforce 
 (Block * block, face_enum face, axis_enum axis) const throw()
+{
+  // Values are cached in the Block so they are freed with it
+
+  enforce_data (block->data(), block->time(), &block->boundary_cache(),
+		face, axis);
+}
+
+//----------------------------------------------------------------------
+
+void BoundaryValue::enforce_data
+(Data * data, double t, Boundary::Cache * cache,
+ face_enum face, axis_enum axis) const throw()
 {
   if ( ! applies_(axis,face)) return;
 
   if (face == face_all) {
-    enforce(block,face_lower,axis);
-    enforce(block,face_upper,axis);
+    enforce_data(data,t,cache,face_lower,axis);
+    enforce_data(data,t,cache,face_upper,axis);
   } else if (axis == axis_all) {
-    enforce(block,face,axis_x);
-    enforce(block,face,axis_y);
-    enforce(block,face,axis_z);
+    enforce_data(data,t,cache,face,axis_x);
+    enforce_data(data,t,cache,face,axis_y);
+    enforce_data(data,t,cache,face,axis_z);
   } else {
 
-    Data * data = block->data();
     Field field = data->field();
 
     if ( ! field.ghosts_allocated() ) {
@@ -31,12 +47,11 @@ void BoundaryValue::enforce
 	    "Function called with ghosts not allocated");
     }
 
-    double xm,ym,zm;
-    double xp,yp,zp;
-    data -> lower(&xm,&ym,&zm);
-    data -> upper(&xp,&yp,&zp);
+    // Expressions independent of time are evaluated once per Block
+    // face and field, and reused on subsequent calls
 
-    double t = block->time();
+    const bool use_cache = (cache != nullptr) && (mask_ == nullptr) &&
+      value_->has_default() && ! value_->is_time_dependent();
 
     for (size_t index = 0; index < field_list_.size(); index++) {
 
@@ -54,15 +69,7 @@ void BoundaryValue::enforce
       int ndy=ny+2*gy+cy;
       int ndz=nz+2*gz+cz;
 
-      double * x = new double [ndx];
-      double * y = new double [ndy];
-      double * z = new double [ndz];
-
-      data->field_cell_faces(x,y,z,gx,gy,gz,cx,cy,cz);
-
-      void * array = field.values(index_field);
-
-      precision_type precision = field.precision(index_field);
+      // ghost zone slab on the face being enforced
 
       int ix0=0 ,iy0=0,iz0=0;
 
@@ -80,77 +87,135 @@ void BoundaryValue::enforce
 	if (axis == axis_z) iz0 = ndz - gz;
       }
 
-      int i0=ix0 + ndx*(iy0 + ndy*iz0);
+      const int key = face + 2*(axis + 3*index_field);
 
-      bool * mask = 0;
+      void * array = field.values(index_field);
 
-      if (mask_ != nullptr) mask = new bool [nx*ny*nz];
+      precision_type precision = field.precision(index_field);
 
       switch (precision) {
       case precision_single:
-	{
-	  float * temp = 0;
-	  if (mask_ != nullptr) {
-	    temp = (float *)array;
-	    array = new float [ndx*ndy*ndz];
-	  }
-	  
-	  value_->evaluate((float *)array+i0, t, 
-			   ndx,nx,x+ix0, 
-			   ndy,ny,y+iy0,
-			   ndz,nz,z+iz0);
-	  if (mask_ != nullptr) {
-	    for (int i=0; i<ndx*ndy*ndz; i++) ((float *)temp)[i]=((float *)array)[i];
-	    delete [] ((float*)array);
-	    array = temp;
-	  }
-	}
+	enforce_slab_ ((float *)array, data, t, cache, key, use_cache,
+		       ndx,ndy,ndz, nx,ny,nz, ix0,iy0,iz0,
+		       gx,gy,gz, cx,cy,cz);
        	break;
       case precision_double:
-	{
-	  double * temp = 0;
-	  if (mask_ != nullptr) {
-	    temp = (double *)array;
-	    array = new double [ndx*ndy*ndz];
-	  }
-	  value_->evaluate((double *)array+i0, t, 
-			   ndx,nx,x+ix0, 
-			   ndy,ny,y+iy0,
-			   ndz,nz,z+iz0);
-	  if (mask_ != nullptr) {
-	    for (int i=0; i<ndx*ndy*ndz; i++) ((double *)temp)[i]=((double *)array)[i];
-	    delete [] ((double *)array);
-	    array = temp;
-	  }
-	}
+	enforce_slab_ ((double *)array, data, t, cache, key, use_cache,
+		       ndx,ndy,ndz, nx,ny,nz, ix0,iy0,iz0,
+		       gx,gy,gz, cx,cy,cz);
        	break;
       case precision_extended80:
       case precision_extended96:
       case precision_quadruple:
-	{
-	  long double * temp = 0;
-	  if (mask_ != nullptr) {
-	    temp = (long double *)array;
-	    array = new long double [ndx*ndy*ndz];
-	  }
-	  value_->evaluate((long double *)array+i0, t, 
-			   ndx,nx,x+ix0, 
-			   ndy,ny,y+iy0,
-			   ndz,nz,z+iz0);
-	  if (mask_ != nullptr) {
-	    for (int i=0; i<ndx*ndy*ndz; i++) 
-	      ((long double *)temp)[i]=((long double *)array)[i];
-	    delete [] ((long double *)array);
-	    array = temp;
-	  }
-	}
+	enforce_slab_ ((long double *)array, data, t, cache, key, use_cache,
+		       ndx,ndy,ndz, nx,ny,nz, ix0,iy0,iz0,
+		       gx,gy,gz, cx,cy,cz);
        	break;
+      default:
+	break;
       }
 
-      delete [] x;
-      delete [] y;
-      delete [] z;
-      delete [] mask;
+      // Ghost values may have changed, so derived fields computed
+      // from this field are no longer current
+
+      field.field_data()->set_modified(index_field);
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void BoundaryValue::enforce_slab_
+(T * array, Data * data, double t, Boundary::Cache * cache,
+ int key, bool use_cache,
+ int ndx, int ndy, int ndz,
+ int nx,  int ny,  int nz,
+ int ix0, int iy0, int iz0,
+ int gx,  int gy,  int gz,
+ int cx,  int cy,  int cz) const throw()
+{
+  const int n = nx*ny*nz;
+
+  // Return cached values if available
+
+  if (use_cache) {
+    auto it = cache->find(std::make_pair(this,key));
+    if (it != cache->end() && it->second.size() == size_t(n)*sizeof(T)) {
+      copy_ (array, (const T *)it->second.data(), nullptr,
+	     ndx,ndy,ndz, nx,ny,nz, ix0,iy0,iz0);
+      return;
+    }
+  }
+
+  std::vector<double> x(ndx), y(ndy), z(ndz);
+
+  data->field_cell_faces(x.data(),y.data(),z.data(),
+			 gx,gy,gz,cx,cy,cz);
+
+  // Evaluate only the slab, starting from current values, which are
+  // kept where no masked expression applies
+
+  // Nothing to do if the boundary mask is false on the whole slab
+
+  const mask_region_type region = (mask_ != nullptr) ?
+    mask_->region(t, nx,x.data()+ix0, ny,y.data()+iy0, nz,z.data()+iz0) :
+    mask_region_inside;
+
+  if (region == mask_region_outside) return;
+
+  std::vector<T> values(n);
+  for (int iz=0; iz<nz; iz++) {
+    for (int iy=0; iy<ny; iy++) {
+      for (int ix=0; ix<nx; ix++) {
+	values[ix + nx*(iy + ny*iz)] =
+	  array[(ix+ix0) + ndx*((iy+iy0) + ndy*(iz+iz0))];
+      }
+    }
+  }
+
+  value_->evaluate(values.data(), t,
+		   nx,nx,x.data()+ix0,
+		   ny,ny,y.data()+iy0,
+		   nz,nz,z.data()+iz0);
+
+  bool * mask = nullptr;
+  if (region == mask_region_mixed) {
+    mask = new bool [n];
+    mask_->evaluate(mask, t,
+		    nx,nx,x.data()+ix0,
+		    ny,ny,y.data()+iy0,
+		    nz,nz,z.data()+iz0);
+  }
+
+  copy_ (array, values.data(), mask,
+	 ndx,ndy,ndz, nx,ny,nz, ix0,iy0,iz0);
+
+  delete [] mask;
+
+  if (use_cache) {
+
+    // Skip caching if the Block's cache would exceed its limit
+
+    size_t bytes = n*sizeof(T);
+    for (auto it = cache->begin(); it != cache->end(); ++it) {
+      bytes += it->second.size();
+    }
+
+    if (bytes <= BOUNDARY_CACHE_MAX_BYTES) {
+
+      Memory * memory = Memory::instance();
+      std::string group = memory ? memory->group() : "";
+      if (memory) {
+	if (memory->index_group("Boundary") == 0) memory->new_group("Boundary");
+	memory->set_group("Boundary");
+      }
+
+      std::vector<char> & cached = (*cache)[std::make_pair(this,key)];
+      cached.resize(n*sizeof(T));
+      memcpy (cached.data(),values.data(),n*sizeof(T));
+
+      if (memory) memory->set_group(group);
     }
   }
 }
@@ -158,17 +223,17 @@ void BoundaryValue::enforce
 //----------------------------------------------------------------------
 
 template <class T>
-void BoundaryValue::copy_(T * field, double * value,
+void BoundaryValue::copy_(T * field, const T * value, const bool * mask,
 			  int ndx, int ndy, int ndz,
 			  int nx,  int ny,  int nz,
 			  int ix0, int iy0, int iz0) const throw()
 {
-  for (int ix=ix0; ix<ix0+nx; ix++) {
+  for (int iz=iz0; iz<iz0+nz; iz++) {
     for (int iy=iy0; iy<iy0+ny; iy++) {
-      for (int iz=iz0; iz<iz0+nz; iz++) {
+      for (int ix=ix0; ix<ix0+nx; ix++) {
 	int iv = (ix-ix0) + nx*((iy-iy0) + ny*(iz-iz0));
 	int ib = ix + ndx*(iy + ndy*(iz));
-	field[ib] = (T) value[iv];
+	if (mask == nullptr || mask[iv]) field[ib] = value[iv];
       }
     }
   }
@@ -8,6 +8,8 @@
 #ifndef PROBLEM_BOUNDARY_VALUE_HPP
 #define PROBLEM_BOUNDARY_VALUE_HPP
 
+class Data;
+
 class BoundaryValue : public Boundary
 {
 
@@ -19,7 +21,7 @@ public: // interface
 
   /// Create a new BoundaryValue
   BoundaryValue() throw() 
-  : Boundary (), value_(0) 
+  : Boundary (), value_(0), field_list_()
   {  }
 
   /// Create a new BoundaryValue
@@ -59,10 +61,30 @@ public: // virtual functions
 			face_enum face = face_all,
 			axis_enum axis = axis_all) const throw();
 
+public: // interface
+
+  /// Enforce BoundaryValue conditions on the given Data at time t,
+  /// caching time-independent values in cache if it is not NULL.
+  /// Fields enforced are marked as modified
+  void enforce_data (Data * data, double t, Boundary::Cache * cache,
+		     face_enum face = face_all,
+		     axis_enum axis = axis_all) const throw();
+
 protected: // functions
 
+  /// Enforce the boundary on the ghost zone slab of a single face
+  template <class T>
+  void enforce_slab_ (T * array, Data * data, double t,
+		      Boundary::Cache * cache, int key, bool use_cache,
+		      int ndx, int ndy, int ndz,
+		      int nx,  int ny,  int nz,
+		      int ix0, int iy0, int iz0,
+		      int gx,  int gy,  int gz,
+		      int cx,  int cy,  int cz) const throw();
+
+  /// Copy slab values into the field array where mask is true
   template <class T>
-  void copy_(T * field, double * value,
+  void copy_(T * field, const T * value, const bool * mask,
 	     int ndx, int ndy, int ndz,
 	     int nx,  int ny,  int nz,
 	     int ix0, int iy0, int iz0) const throw ();
@@ -58,6 +58,13 @@ public: // virtual functions
     const Hierarchy  * hierarchy
     ) throw();
 
+  /// Called on each root-level Block once all Blocks have been
+  /// initialized, e.g. to start collective reads that send data to
+  /// Blocks.  Blocks expecting such data call Block::initial_expect()
+  /// in enforce_block()
+  virtual void enforce_block_exit ( Block * block ) throw()
+  { }
+
   /// Return whether enforce() expects block != NULL
   virtual bool expects_blocks_allocated() const throw()
   { return true; }
@@ -99,28 +99,37 @@ void InitialTrace::uniform_placement_
   int ip=0;  // particle counter 
 
   int64_t * id = 0;
-  float * xa = 0;
-  float * ya = 0;
-  float * za = 0;
+
+  // positions may be single or double precision: ASSUMES precision
+  // same for all axes
+
+  const bool is_double = (particle.attribute_type(it,ia_x) == type_double);
+
+  union { float * xa4; double * xa8; };
+  union { float * ya4; double * ya8; };
+  union { float * za4; double * za8; };
+
+  // NOTE: union so ?a4 also initialized
+  xa8 = ya8 = za8 = 0;
   const int in = cello::index_static();
 
   const int dp  = particle.stride(it,ia_x);
   const int did = have_id ? particle.stride(it,ia_id) : 0;
 
   for (int iz=0; iz<nz; iz+=dz_) {
-    float z = (mz>1) ? zm + (iz + 0.5)*hz : 0.0;
+    double z = (mz>1) ? zm + (iz + 0.5)*hz : 0.0;
     for (int iy=0; iy<ny; iy+=dy_) {
-      float y = (my>1) ? ym + (iy + 0.5)*hy : 0.0;
+      double y = (my>1) ? ym + (iy + 0.5)*hy : 0.0;
 
       for (int ix=0; ix<nx; ix+=dx_) {
-	float x = (mx>1) ? xm + (ix + 0.5)*hx : 0.0;
+	double x = (mx>1) ? xm + (ix + 0.5)*hx : 0.0;
 
 	// ... if new batch then update position arrays
 	if (ip % np == 0) {
 	  if (have_id) id = (int64_t *) particle.attribute_array (it,ia_id,ib);
-	  xa = (float *)   particle.attribute_array (it,ia_x,ib);
-	  ya = (float *)   particle.attribute_array (it,ia_y,ib);
-	  za = (float *)   particle.attribute_array (it,ia_z,ib);
+	  xa8 = (double *) particle.attribute_array (it,ia_x,ib);
+	  ya8 = (double *) particle.attribute_array (it,ia_y,ib);
+	  za8 = (double *) particle.attribute_array (it,ia_z,ib);
 	}
 
 	
@@ -129,9 +138,15 @@ void InitialTrace::uniform_placement_
 	  id0_[in] += CkNumPes();
 	}
 	
-	xa[ip*dp] = x;
-	ya[ip*dp] = y;
-	za[ip*dp] = z;
+	if (is_double) {
+	  xa8[ip*dp] = x;
+	  ya8[ip*dp] = y;
+	  za8[ip*dp] = z;
+	} else {
+	  xa4[ip*dp] = x;
+	  ya4[ip*dp] = y;
+	  za4[ip*dp] = z;
+	}
 
 	ip++;
 
@@ -240,9 +255,18 @@ void InitialTrace::density_placement_
   int ipb=0;  // particle / batch counter 
 
   int64_t * id = 0;
-  float * xa = 0;
-  float * ya = 0;
-  float * za = 0;
+
+  // positions may be single or double precision: ASSUMES precision
+  // same for all axes
+
+  const bool is_double = (particle.attribute_type(it,ia_x) == type_double);
+
+  union { float * xa4; double * xa8; };
+  union { float * ya4; double * ya8; };
+  union { float * za4; double * za8; };
+
+  // NOTE: union so ?a4 also initialized
+  xa8 = ya8 = za8 = 0;
 
   const int in = cello::index_static();
 
@@ -291,9 +315,9 @@ void InitialTrace::density_placement_
     // ... if new batch then update position arrays
     if (ipb % npb == 0) {
       if (have_id) id = (int64_t *) particle.attribute_array (it,ia_id,ib);
-      xa = (float *)   particle.attribute_array (it,ia_x,ib);
-      ya = (float *)   particle.attribute_array (it,ia_y,ib);
-      za = (float *)   particle.attribute_array (it,ia_z,ib);
+      xa8 = (double *) particle.attribute_array (it,ia_x,ib);
+      ya8 = (double *) particle.attribute_array (it,ia_y,ib);
+      za8 = (double *) particle.attribute_array (it,ia_z,ib);
     }
 
     if (have_id) {
@@ -301,9 +325,15 @@ void InitialTrace::density_placement_
       id0_[in] += CkNumPes();
     }
     
-    xa[ipb*ps] = x;
-    ya[ipb*ps] = y;
-    za[ipb*ps] = z;
+    if (is_double) {
+      xa8[ipb*ps] = x;
+      ya8[ipb*ps] = y;
+      za8[ipb*ps] = z;
+    } else {
+      xa4[ipb*ps] = x;
+      ya4[ipb*ps] = y;
+      za4[ipb*ps] = z;
+    }
 
     ipb++;
 
@@ -12,6 +12,14 @@
 class Param;
 class Parameters;
 
+/// @enum     mask_region_type
+/// @brief    Mask values over a region: all false, all true, or both
+enum mask_region_type {
+  mask_region_outside,  // mask is false everywhere in the region
+  mask_region_inside,   // mask is true everywhere in the region
+  mask_region_mixed     // mask is true and false, or not known
+};
+
 class Mask : public PUP::able {
 
   /// @class    Mask
@@ -62,7 +70,21 @@ public: // interface
 			 int ndy, int ny, double * y,
 			 int ndz, int nz, double * z) const = 0;
 
-  
+  /// Classify mask values at the points (x[ix],y[iy],z[iz]) as all
+  /// inside, all outside, or mixed, so that callers can skip
+  /// per-point evaluation for whole Blocks.  y or z may be NULL for
+  /// lower-dimensional problems.  The default is mixed, meaning
+  /// evaluate() must be called.
+  virtual mask_region_type region (double t,
+				   int nx, const double * x,
+				   int ny, const double * y,
+				   int nz, const double * z) const
+  { return mask_region_mixed; }
+
+  /// Return whether the mask may depend on time t
+  virtual bool is_time_dependent() const
+  { return true; }
+
 private: // functions
 
 
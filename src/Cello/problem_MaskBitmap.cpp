@@ -0,0 +1,132 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     problem_MaskBitmap.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-19
+/// @brief    Implementation of the MaskBitmap class
+
+#include "problem.hpp"
+
+//----------------------------------------------------------------------
+
+MaskBitmap::MaskBitmap(int nx, int ny) throw()
+  : nx_(nx), ny_(ny), any_(), all_()
+{
+  int num_levels = 1;
+  while (size_(nx_,num_levels-1) > 1 || size_(ny_,num_levels-1) > 1) {
+    ++num_levels;
+  }
+
+  any_.resize(num_levels);
+  all_.resize(num_levels);
+  for (int level=0; level<num_levels; level++) {
+    const int n = words_(level)*size_(ny_,level);
+    any_[level].assign(n,0);
+    if (level > 0) all_[level].assign(n,0);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void MaskBitmap::build() throw()
+{
+  for (int level=1; level<num_levels(); level++) {
+
+    const int nxf = size_(nx_,level-1);
+    const int nyf = size_(ny_,level-1);
+    const int nxc = size_(nx_,level);
+    const int nyc = size_(ny_,level);
+
+    // finest level has identical "any" and "all" bits
+    const std::vector<uint64_t> & any_fine = any_[level-1];
+    const std::vector<uint64_t> & all_fine =
+      (level == 1) ? any_[0] : all_[level-1];
+
+    std::vector<uint64_t> & any_coarse = any_[level];
+    std::vector<uint64_t> & all_coarse = all_[level];
+
+    for (int cy=0; cy<nyc; cy++) {
+      for (int cx=0; cx<nxc; cx++) {
+	bool any = false;
+	bool all = true;
+	for (int iy=2*cy; iy<std::min(2*cy+2,nyf); iy++) {
+	  for (int ix=2*cx; ix<std::min(2*cx+2,nxf); ix++) {
+	    any = any || bit_(any_fine,level-1,ix,iy);
+	    all = all && bit_(all_fine,level-1,ix,iy);
+	  }
+	}
+	const int i = word_(level,cx,cy);
+	const uint64_t bit = uint64_t(1) << (cx % 64);
+	if (any) any_coarse[i] |= bit; else any_coarse[i] &= ~bit;
+	if (all) all_coarse[i] |= bit; else all_coarse[i] &= ~bit;
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+mask_region_type MaskBitmap::region
+(int ix0, int ix1, int iy0, int iy1) const throw()
+{
+  if (ix1 < ix0) std::swap(ix0,ix1);
+  if (iy1 < iy0) std::swap(iy0,iy1);
+
+  // pixels outside the mask are false
+
+  bool some_set   = false;
+  bool some_clear = (ix0 < 0 || ix1 >= nx_ || iy0 < 0 || iy1 >= ny_);
+
+  ix0 = std::max(ix0,0);
+  iy0 = std::max(iy0,0);
+  ix1 = std::min(ix1,nx_-1);
+  iy1 = std::min(iy1,ny_-1);
+
+  if (ix0 <= ix1 && iy0 <= iy1) {
+    region_(num_levels()-1,0,0,ix0,ix1,iy0,iy1,&some_set,&some_clear);
+  }
+
+  return (some_set && some_clear) ? mask_region_mixed :
+    (some_set ? mask_region_inside : mask_region_outside);
+}
+
+//----------------------------------------------------------------------
+
+void MaskBitmap::region_
+(int level, int cx, int cy,
+ int ix0, int ix1, int iy0, int iy1,
+ bool * some_set, bool * some_clear) const throw()
+{
+  if (*some_set && *some_clear) return;
+
+  // skip if the coarse pixel does not intersect the rectangle
+
+  const int px0 = cx << level;
+  const int py0 = cy << level;
+  const int px1 = std::min(px0 + (1 << level), nx_) - 1;
+  const int py1 = std::min(py0 + (1 << level), ny_) - 1;
+
+  if (px1 < ix0 || ix1 < px0 || py1 < iy0 || iy1 < py0) return;
+
+  const bool any = bit_(any_[level],level,cx,cy);
+  const bool all = (level == 0) ? any : bit_(all_[level],level,cx,cy);
+
+  if (all)  { *some_set   = true; return; }
+  if (!any) { *some_clear = true; return; }
+
+  // mixed coarse pixel: contained means the rectangle is mixed
+
+  if (ix0 <= px0 && px1 <= ix1 && iy0 <= py0 && py1 <= iy1) {
+    *some_set   = true;
+    *some_clear = true;
+    return;
+  }
+
+  const int nxf = size_(nx_,level-1);
+  const int nyf = size_(ny_,level-1);
+  for (int iy=2*cy; iy<std::min(2*cy+2,nyf); iy++) {
+    for (int ix=2*cx; ix<std::min(2*cx+2,nxf); ix++) {
+      region_(level-1,ix,iy,ix0,ix1,iy0,iy1,some_set,some_clear);
+    }
+  }
+}
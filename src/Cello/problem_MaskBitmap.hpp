@@ -0,0 +1,121 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     problem_MaskBitmap.hpp
+/// @author   agent (agent@local)
+/// @date     2026-10-19
+/// @brief    [\ref Problem] Declaration of the MaskBitmap class
+///
+
+#ifndef PROBLEM_MASK_BITMAP_HPP
+#define PROBLEM_MASK_BITMAP_HPP
+
+class MaskBitmap {
+
+  /// @class    MaskBitmap
+  /// @ingroup  Problem
+  /// @brief    [\ref Problem] Hierarchical bit-packed 2D mask
+  ///
+  /// @details MaskBitmap stores a 2D mask one bit per pixel, together
+  /// with a pyramid of coarser levels.  Each pixel of level l covers
+  /// 2^l by 2^l mask pixels, and records whether any and whether all
+  /// of them are set.  region() uses the pyramid to classify a
+  /// rectangle of pixels as all set, none set, or mixed, descending
+  /// only into coarse pixels that are mixed and straddle the edges
+  /// of the rectangle.
+
+public: // interface
+
+  /// Constructor
+  MaskBitmap() throw()
+    : nx_(0), ny_(0), any_(), all_()
+  { }
+
+  /// Create a cleared nx by ny mask
+  MaskBitmap(int nx, int ny) throw();
+
+  /// CHARM++ Pack / Unpack function
+  inline void pup (PUP::er &p)
+  {
+    TRACEPUP;
+    p | nx_;
+    p | ny_;
+    p | any_;
+    p | all_;
+    // NOTE: change this function whenever attributes change
+  }
+
+  /// Return the mask width
+  int nx() const throw() { return nx_; }
+
+  /// Return the mask height
+  int ny() const throw() { return ny_; }
+
+  /// Return the number of levels, including the finest
+  int num_levels() const throw() { return any_.size(); }
+
+  /// Set the mask value of pixel (ix,iy); call build() after setting
+  /// all pixels
+  void set (int ix, int iy, bool value) throw()
+  {
+    uint64_t & word = any_[0][word_(0,ix,iy)];
+    const uint64_t bit = uint64_t(1) << (ix % 64);
+    if (value) word |= bit;
+    else       word &= ~bit;
+  }
+
+  /// Compute the coarse levels from the finest level
+  void build() throw();
+
+  /// Return the mask value of pixel (ix,iy), or false if outside the mask
+  bool value (int ix, int iy) const throw()
+  {
+    return (0 <= ix && ix < nx_ && 0 <= iy && iy < ny_) &&
+      bit_(any_[0],0,ix,iy);
+  }
+
+  /// Classify the pixels in [ix0,ix1] x [iy0,iy1]; pixels outside
+  /// the mask are false
+  mask_region_type region (int ix0, int ix1, int iy0, int iy1) const throw();
+
+private: // functions
+
+  /// Size of level l along an axis of size n
+  static int size_ (int n, int level)
+  { return (n + (1 << level) - 1) >> level; }
+
+  /// Number of 64-bit words per row of level l
+  int words_ (int level) const
+  { return (size_(nx_,level) + 63) / 64; }
+
+  /// Index of the word containing pixel (ix,iy) of level l
+  int word_ (int level, int ix, int iy) const
+  { return ix/64 + words_(level)*iy; }
+
+  /// Return the bit of pixel (ix,iy) of level l
+  bool bit_ (const std::vector<uint64_t> & bits,
+	     int level, int ix, int iy) const
+  { return (bits[word_(level,ix,iy)] >> (ix % 64)) & 1; }
+
+  /// Accumulate whether the pixel (cx,cy) of level l contains set or
+  /// cleared mask pixels inside [ix0,ix1] x [iy0,iy1]
+  void region_ (int level, int cx, int cy,
+		int ix0, int ix1, int iy0, int iy1,
+		bool * some_set, bool * some_clear) const throw();
+
+private: // attributes
+
+  // NOTE: change pup() function whenever attributes change
+
+  /// Size of the finest level
+  int nx_;
+  int ny_;
+
+  /// Bits for each level: whether any (any_) or all (all_) covered
+  /// mask pixels are set; all_[0] is unused since the finest level
+  /// is stored in any_[0]
+  std::vector< std::vector<uint64_t> > any_;
+  std::vector< std::vector<uint64_t> > all_;
+
+};
+
+#endif /* PROBLEM_MASK_BITMAP_HPP */
@@ -7,11 +7,15 @@
 
 #include "problem.hpp"
 
+/// Maximum number of cached point sets before the cache is cleared,
+/// e.g. after Blocks have refined or coarsened
+#define MASK_EXPR_CACHE_SIZE 4096
+
 //----------------------------------------------------------------------
 
 MaskExpr::MaskExpr
 (Param * param) throw()
-  : Mask(), param_(param)
+  : Mask(), param_(param), cache_()
 {
 }
 
@@ -20,6 +24,7 @@ MaskExpr::MaskExpr
 void MaskExpr::copy_(const MaskExpr & mask) throw()
 {
   param_ = mask.param_;
+  cache_ = mask.cache_;
 }
 
 //----------------------------------------------------------------------
@@ -44,10 +49,83 @@ void MaskExpr::evaluate (bool * mask, double t,
 	  ndx,ndy,ndz,nx,ny,nz,
 	  (ndx >= nx) && (ndy >= ny) && (ndz >= nz));
 
-  bool * mask_temp = new bool [nx*ny*nz];
+  const double * y = uses_axis_(1) ? yv : NULL;
+  const double * z = uses_axis_(2) ? zv : NULL;
+
+  if (! is_time_dependent()) {
+
+    // Unpack cached values
+
+    const CacheEntry & entry = cache_entry_(nx,xv,ny,y,nz,z);
+    for (int iz=0; iz<nz; iz++) {
+      for (int iy=0; iy<ny; iy++) {
+	for (int ix=0; ix<nx; ix++) {
+	  int i=ix + nx*(iy + ny*iz);
+	  int id=ix + ndx*(iy + ndy*iz);
+	  mask[id] = (entry.bits[i/64] >> (i%64)) & 1;
+	}
+      }
+    }
+
+  } else {
+
+    bool * mask_temp = new bool [nx*ny*nz];
+
+    evaluate_points_(mask_temp,t,nx,xv,ny,y,nz,z);
+
+    for (int iz=0; iz<nz; iz++) {
+      for (int iy=0; iy<ny; iy++) {
+	for (int ix=0; ix<nx; ix++) {
+	  int i=ix + nx*(iy + ny*iz);
+	  int id=ix + ndx*(iy + ndy*iz);
+	  mask[id] = mask_temp[i];
+	}
+      }
+    }
+
+    delete [] mask_temp;
+  }
+}
+
+//----------------------------------------------------------------------
+
+mask_region_type MaskExpr::region
+(double t,
+ int nx, const double * x,
+ int ny, const double * y,
+ int nz, const double * z) const
+{
+  if (is_time_dependent() || x == NULL) return mask_region_mixed;
+
+  // Same y and z convention as evaluate() so cache entries are shared
+
+  return cache_entry_(nx,x,
+		      ny,uses_axis_(1) ? y : NULL,
+		      nz,uses_axis_(2) ? z : NULL).region;
+}
+
+//----------------------------------------------------------------------
+
+bool MaskExpr::uses_axis_ (int axis)
+{
+  // Depends on the problem rank and not on the number of points,
+  // since e.g. boundary ghost zone slabs may be one cell thick.  All
+  // axes are used outside a Simulation, e.g. in unit tests
+
+  return (cello::simulation() == NULL) || (axis < cello::rank());
+}
+
+//----------------------------------------------------------------------
+
+void MaskExpr::evaluate_points_
+(bool * mask, double t,
+ int nx, const double * xv,
+ int ny, const double * yv,
+ int nz, const double * zv) const
+{
   double * x = new double [nx*ny*nz];
-  double * y = (ndy > 1) ? new double [nx*ny*nz] : NULL;
-  double * z = (ndz > 1) ? new double [nx*ny*nz] : NULL;
+  double * y = (yv != NULL) ? new double [nx*ny*nz] : NULL;
+  double * z = (zv != NULL) ? new double [nx*ny*nz] : NULL;
 
   for (int iz=0; iz<nz; iz++) {
     for (int iy=0; iy<ny; iy++) {
@@ -56,28 +134,63 @@ void MaskExpr::evaluate (bool * mask, double t,
 	x[i] = xv[ix];
 	if (y) y[i] = yv[iy];
 	if (z) z[i] = zv[iz];
-	mask_temp[i] = false;
+	mask[i] = false;
       }
     }
   }
 
   int n=nx*ny*nz;
 
-  param_->evaluate_logical(n,mask_temp,x,y,z,t);
-
-  for (int iz=0; iz<nz; iz++) {
-    for (int iy=0; iy<ny; iy++) {
-      for (int ix=0; ix<nx; ix++) {
-	int i=ix + nx*(iy + ny*iz);
-	int id=ix + ndx*(iy + ndy*iz);
-	mask[id] = mask_temp[i];
-      }
-    }
-  }
+  param_->evaluate_logical(n,mask,x,y,z,t);
 
   delete [] z;
   delete [] y;
   delete [] x;
-  delete [] mask_temp;
+}
+
+//----------------------------------------------------------------------
+
+const MaskExpr::CacheEntry & MaskExpr::cache_entry_
+(int nx, const double * x,
+ int ny, const double * y,
+ int nz, const double * z) const
+{
+  // Key: sizes and coordinates, with size -1 for unused axes
+
+  std::vector<double> key;
+  key.reserve(3 + nx + ny + nz);
+  key.push_back(nx);
+  key.insert(key.end(),x,x+nx);
+  key.push_back(y ? ny : -1);
+  if (y) key.insert(key.end(),y,y+ny);
+  key.push_back(z ? nz : -1);
+  if (z) key.insert(key.end(),z,z+nz);
+
+  auto it = cache_.find(key);
+  if (it != cache_.end()) return it->second;
+
+  if (cache_.size() >= MASK_EXPR_CACHE_SIZE) cache_.clear();
+
+  const int n = nx*ny*nz;
+  bool * mask = new bool [n];
+  evaluate_points_(mask,0.0,nx,x,ny,y,nz,z);
+
+  CacheEntry & entry = cache_[key];
+  entry.bits.assign((n + 63)/64,0);
+  bool some_set   = false;
+  bool some_clear = false;
+  for (int i=0; i<n; i++) {
+    if (mask[i]) {
+      entry.bits[i/64] |= uint64_t(1) << (i%64);
+      some_set = true;
+    } else {
+      some_clear = true;
+    }
+  }
+  entry.region = (some_set && some_clear) ? mask_region_mixed :
+    (some_set ? mask_region_inside : mask_region_outside);
+
+  delete [] mask;
 
+  return entry;
 }
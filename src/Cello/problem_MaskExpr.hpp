@@ -13,13 +13,17 @@ class MaskExpr : public Mask {
 
   /// @class    MaskExpr
   /// @ingroup  Problem
-  /// @brief    [\ref Problem] 
+  /// @brief    [\ref Problem] Mask defined by a logical expression
+  ///
+  /// @details Masks that do not depend on time are evaluated once for
+  /// each set of Block cell coordinates, and the bit-packed result and
+  /// its region classification are cached for later calls.
 
 public: // interface
 
   /// Constructor
   MaskExpr() throw() 
-  : Mask(), param_(NULL)
+  : Mask(), param_(NULL), cache_()
   { };
 
   /// Destructor
@@ -44,7 +48,7 @@ public: // interface
   PUPable_decl(MaskExpr);
 
   MaskExpr(CkMigrateMessage *m)
-    : Mask (m), param_(NULL)
+    : Mask (m), param_(NULL), cache_()
   {}
 
   /// CHARM++ Pack / Unpack function
@@ -65,17 +69,55 @@ public: // interface
 			 int ndx, int nx, double * x,
 			 int ndy, int ny, double * y,
 			 int ndz, int nz, double * z) const;
-  
+
+  /// Classify the mask at the points, using the cached values if
+  /// the expression is independent of time
+  virtual mask_region_type region (double t,
+				   int nx, const double * x,
+				   int ny, const double * y,
+				   int nz, const double * z) const;
+
+  /// Return whether the mask expression depends on time t
+  virtual bool is_time_dependent() const
+  { return param_ && param_->uses_variable('t'); }
+
 private: // functions
 
   void copy_(const MaskExpr & mask) throw();
 
+  /// Return whether coordinates along the given axis are passed to
+  /// the expression
+  static bool uses_axis_ (int axis);
+
+  /// Evaluate the expression at the nx*ny*nz points into mask; y or z
+  /// are NULL if not used
+  void evaluate_points_ (bool * mask, double t,
+			 int nx, const double * x,
+			 int ny, const double * y,
+			 int nz, const double * z) const;
+
+  /// Cached mask values at the given points
+  struct CacheEntry {
+    std::vector<uint64_t> bits;
+    mask_region_type region;
+  };
+
+  /// Return the cached entry for the given points, evaluating the
+  /// expression if needed
+  const CacheEntry & cache_entry_ (int nx, const double * x,
+				   int ny, const double * y,
+				   int nz, const double * z) const;
+
 private: // attributes
 
   // NOTE: change pup() function whenever attributes change
 
   Param * param_;
 
+  /// Bit-packed mask values for time-independent expressions, keyed
+  /// by the point coordinates (not packed)
+  mutable std::map<std::vector<double>, CacheEntry> cache_;
+
 
 };
 
@@ -15,7 +15,7 @@ MaskPng::MaskPng
 (std::string file_name, 
  double xm, double xp,
  double ym, double yp) throw()
-  : Mask(), mask_(NULL), nx_(0),ny_(0),
+  : Mask(), bitmap_(), nx_(0),ny_(0),
     xm_(xm),xp_(xp),
     ym_(ym),yp_(yp)
 {
@@ -30,36 +30,32 @@ MaskPng::MaskPng
   nx_ = png.getwidth();
   ny_ = png.getheight();
 
-  // Allocate and clear the mask
+  // Allocate the mask and its coarse levels
 
-  int n = nx_*ny_;
-  mask_ = new bool [n];
-  for (int i=0; i<n; i++) mask_[i] = false;
+  bitmap_ = MaskBitmap(nx_,ny_);
 
   for (int iy=0; iy<ny_; iy++) {
     for (int ix=0; ix<nx_; ix++) {
 
-      int i = ix + nx_*iy;
-
       int r = png.read(ix+1,iy+1,1);
       int g = png.read(ix+1,iy+1,2);
       int b = png.read(ix+1,iy+1,3);
 
-      mask_[i] = (r+g+b > 0);
+      bitmap_.set(ix,iy,(r+g+b > 0));
     }
   }
   png.close();
+
+  bitmap_.build();
 }
 
 //----------------------------------------------------------------------
 
 void MaskPng::copy_(const MaskPng & mask) throw()
 {
+  bitmap_ = mask.bitmap_;
   nx_ = mask.nx_;
   ny_ = mask.ny_;
-  const int n = nx_*ny_;
-  mask_ = new bool [n];
-  for (int i=0; i<n; i++) mask_[i] = mask.mask_[i];
   xm_ = mask.xm_;
   xp_ = mask.xp_;
   ym_ = mask.ym_;
@@ -70,10 +66,7 @@ void MaskPng::copy_(const MaskPng & mask) throw()
 
 bool MaskPng::evaluate (double t, double x, double y, double z) const
 {
-  int imx = floor(1.0*( x - xm_) / (xp_-xm_) * nx_);
-  int imy = floor(1.0*( y - ym_) / (yp_-ym_) * ny_);
-  bool valid = ((0 <= imx && imx < nx_ && 0 <= imy && imy < ny_));
-  return valid ? mask_[imx + nx_*imy] : false;
+  return bitmap_.value(ix_png_(x),iy_png_(y));
 }
 
 //----------------------------------------------------------------------
@@ -84,16 +77,31 @@ void MaskPng::evaluate (bool * mask, double t,
 			 int ndz, int nz, double * zv) const
 {
   for (int ix=0; ix<nx; ix++) {
-    double x = xv[ix];
-    int ix_png= floor(1.0*( x - xm_) / (xp_-xm_) * nx_);
+    int ix_png = ix_png_(xv[ix]);
     for (int iy=0; iy<ny; iy++) {
-      double y = yv[iy];
-      int iy_png= floor(1.0*( y - ym_) / (yp_-ym_) * ny_);
-      int i_png = ix_png + nx_*(iy_png);
+      int iy_png = iy_png_(yv[iy]);
+      const bool value = bitmap_.value(ix_png,iy_png);
       for (int iz=0; iz<nz; iz++) {
 	int i_mask = ix + ndx*(iy + ndy*iz);
-	mask[i_mask] = mask_[i_png];
+	mask[i_mask] = value;
       }
     }
   }
 }
+
+//----------------------------------------------------------------------
+
+mask_region_type MaskPng::region
+(double t,
+ int nx, const double * x,
+ int ny, const double * y,
+ int nz, const double * z) const
+{
+  if (x == NULL || y == NULL || nx <= 0 || ny <= 0) return mask_region_mixed;
+
+  // Pixels spanned by the points; conservative if points are coarser
+  // than pixels, since mixed falls back to evaluate()
+
+  return bitmap_.region(ix_png_(x[0]),ix_png_(x[nx-1]),
+			iy_png_(y[0]),iy_png_(y[ny-1]));
+}
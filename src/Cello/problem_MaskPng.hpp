@@ -13,20 +13,19 @@ class MaskPng : public Mask {
 
   /// @class    MaskPng
   /// @ingroup  Problem
-  /// @brief    [\ref Problem] 
+  /// @brief    [\ref Problem] Mask defined by the non-black pixels
+  /// of a PNG image, stored as a MaskBitmap
 
 public: // interface
 
   /// Constructor
   MaskPng() throw() 
-  : Mask(),mask_(NULL), nx_(0),ny_(0), xm_(0),xp_(0),ym_(0),yp_(0)
+  : Mask(),bitmap_(), nx_(0),ny_(0), xm_(0),xp_(0),ym_(0),yp_(0)
   { };
 
   /// Destructor
   virtual ~MaskPng() throw() 
-  {
-    delete [] mask_;
-  };
+  { };
 
   /// Copy constructor
   MaskPng(const MaskPng & mask) throw() 
@@ -49,7 +48,7 @@ public: // interface
 
   MaskPng(CkMigrateMessage *m)
     : Mask (m),
-      mask_(NULL), nx_(0),ny_(0), xm_(0),xp_(0),ym_(0),yp_(0)
+      bitmap_(), nx_(0),ny_(0), xm_(0),xp_(0),ym_(0),yp_(0)
   {}
 
 
@@ -58,14 +57,13 @@ public: // interface
   {
     TRACEPUP;
     Mask::pup(p);
+    p | bitmap_;
     p | nx_;
     p | ny_;
-    PUParray(p,mask_,nx_*ny_);
     p | xm_;
     p | xp_;
     p | ym_;
     p | yp_;
-    WARNING("MaskPng::pup()","UNFINISHED");
     // NOTE: change this function whenever attributes change
   }
 
@@ -77,14 +75,32 @@ public: // interface
 			 int ndx, int nx, double * x,
 			 int ndy, int ny, double * y,
 			 int ndz, int nz, double * z) const;
-  
+
+  /// Classify the image pixels covering the points
+  virtual mask_region_type region (double t,
+				   int nx, const double * x,
+				   int ny, const double * y,
+				   int nz, const double * z) const;
+
+  /// Image masks are constant in time
+  virtual bool is_time_dependent() const
+  { return false; }
+
 private: // functions
 
   void copy_(const MaskPng & mask) throw();
 
+  /// Image pixel containing the given coordinates
+  int ix_png_ (double x) const
+  { return floor(1.0*( x - xm_) / (xp_-xm_) * nx_); }
+  int iy_png_ (double y) const
+  { return floor(1.0*( y - ym_) / (yp_-ym_) * ny_); }
+
 private: // attributes
 
-  bool * mask_;
+  /// Image pixels that are not black
+  MaskBitmap bitmap_;
+
   /// Size of the image
   int nx_;
   int ny_;
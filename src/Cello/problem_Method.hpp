@@ -46,6 +46,23 @@ public: // virtual functions
 
   virtual void compute ( Block * block) throw() = 0; 
 
+  /// Whether the Method is split into compute_interior(), called
+  /// after the Method's ghost zone refresh has been started but
+  /// before it completes, and compute_boundary(), called after ghost
+  /// zones are refreshed
+  virtual bool overlap_refresh () const throw()
+  { return false; }
+
+  /// Perform the part of the computation that does not depend on
+  /// ghost zone values.  Must not modify Fields being refreshed.
+  virtual void compute_interior ( Block * block) throw()
+  { }
+
+  /// Complete the computation after ghost zones are refreshed.  Must
+  /// call block->compute_done() when finished
+  virtual void compute_boundary ( Block * block) throw()
+  { compute(block); }
+
   /// Return the name of this Method
   virtual std::string name () throw () = 0;
 
@@ -14,11 +14,13 @@ MethodTrace::MethodTrace
 (
  double courant,
  double timestep,
- std::string name
+ std::string name,
+ int order
  ) throw() 
   : Method (courant),
     timestep_(timestep),
-    name_(name)
+    name_(name),
+    order_(order)
 {
   cello::simulation()->new_refresh_set_name(ir_post_,name);
   
@@ -35,231 +37,277 @@ void MethodTrace::compute ( Block * block) throw()
     Particle particle (block->data()->particle());
     Field    field    (block->data()->field());
 
-    // initialize trace particle type and position attributes
-
     const int it = particle.type_index(name_);
 
-    const int ia_x = particle.attribute_index(it,"x");
-    const int ia_y = particle.attribute_index(it,"y");
-    const int ia_z = particle.attribute_index(it,"z");
-
-    const int dp =  particle.stride(it,ia_x);
-
     const int rank = cello::rank();
 
     // get velocity field arrays
 
-    union { float * vxa4; double * vxa8; };
-    union { float * vya4; double * vya8; };
-    union { float * vza4; double * vza8; };
+    void * vxa = (rank >= 1) ? field.values("velocity_x") : NULL;
+    void * vya = (rank >= 2) ? field.values("velocity_y") : NULL;
+    void * vza = (rank >= 3) ? field.values("velocity_z") : NULL;
+
+    // Get velocity precision: ASSUMES precision same for all axes and
+    // is single or double
+
+    const bool is_single =
+      (field.precision (field.field_id("velocity_x")) == precision_single);
+
+    // Get position precision: ASSUMES precision same for all axes
+
+    const bool is_double_position =
+      (particle.attribute_type (it,particle.attribute_index(it,"x"))
+       == type_double);
+
+    if (is_single) {
+      if (is_double_position) {
+	advance_<float,double>
+	  (block,particle,it,(float*)vxa,(float*)vya,(float*)vza);
+      } else {
+	advance_<float,float>
+	  (block,particle,it,(float*)vxa,(float*)vya,(float*)vza);
+      }
+    } else {
+      if (is_double_position) {
+	advance_<double,double>
+	  (block,particle,it,(double*)vxa,(double*)vya,(double*)vza);
+      } else {
+	advance_<double,float>
+	  (block,particle,it,(double*)vxa,(double*)vya,(double*)vza);
+      }
+    }
+  }
   
-    // NOTE: union so v?a4 also initialized
+  block->compute_done();
+  
+}
 
-    vxa8 = (rank >= 1) ? (double *) field.values("velocity_x") : NULL;
-    vya8 = (rank >= 2) ? (double *) field.values("velocity_y") : NULL;
-    vza8 = (rank >= 3) ? (double *) field.values("velocity_z") : NULL;
+//----------------------------------------------------------------------
 
-    int mx,my,mz;
-    field.dimensions(0,&mx,&my,&mz);
-    int nx,ny,nz;
-    field.size(&nx,&ny,&nz);
-    int gx,gy,gz;
-    field.ghost_depth(0,&gx,&gy,&gz);
+/// Number of particles whose positions are gathered and advanced together
+#define TRACE_CHUNK_SIZE 64
+
+/// Block geometry used to interpolate cell-centered velocities
+struct trace_grid_type {
+  int mx,my,mz;
+  int gx,gy,gz;
+  double xm,ym,zm;
+  double hx,hy,hz;
+};
+
+/// Return the lower field index along an axis for linear interpolation
+/// of cell-centered values at position x, and the weight w of the
+/// upper index
+static inline int trace_index_
+(double x, double xm, double hx, int gx, int mx, double * w)
+{
+  const double s = (x - xm)/hx - 0.5;
+  int i0 = gx + int(floor(s));
+  // keep both points inside the field array, and use the nearest
+  // value rather than extrapolating outside it
+  i0 = std::max(0,std::min(i0,mx-2));
+  (*w) = std::max(0.0,std::min(s - (i0-gx),1.0));
+  return i0;
+}
 
-    double xm,ym,zm;
-    double xp,yp,zp;
-    block->lower(&xm,&ym,&zm);
-    block->upper(&xp,&yp,&zp);
+//----------------------------------------------------------------------
 
-    const double hx = (xp-xm)/nx;
-    const double hy = (yp-ym)/ny;
-    const double hz = (zp-zm)/nz;
+/// Interpolate the velocity to n positions (px,py,pz)
+template <class T, int RANK>
+static void trace_velocity_
+(const trace_grid_type & g,
+ const T * vxa, const T * vya, const T * vza,
+ int n,
+ const double * px, const double * py, const double * pz,
+ double * vx, double * vy, double * vz)
+{
+  const int dy = g.mx;
+  const int dz = g.mx*g.my;
+
+  for (int i=0; i<n; i++) {
+
+    double wx=0.0, wy=0.0, wz=0.0;
+    int ix0=0, iy0=0, iz0=0;
+
+    ix0 = trace_index_(px[i],g.xm,g.hx,g.gx,g.mx,&wx);
+    if (RANK >= 2) iy0 = trace_index_(py[i],g.ym,g.hy,g.gy,g.my,&wy);
+    if (RANK >= 3) iz0 = trace_index_(pz[i],g.zm,g.hz,g.gz,g.mz,&wz);
+
+    const int i0 = ix0 + g.mx*(iy0 + g.my*iz0);
+
+    if (RANK == 1) {
+
+      vx[i] = (1.0-wx)*vxa[i0] + wx*vxa[i0+1];
+
+    } else if (RANK == 2) {
+
+      const double w00 = (1.0-wx)*(1.0-wy);
+      const double w10 = (    wx)*(1.0-wy);
+      const double w01 = (1.0-wx)*(    wy);
+      const double w11 = (    wx)*(    wy);
+
+      vx[i] = w00*vxa[i0]    + w10*vxa[i0+1]
+	+     w01*vxa[i0+dy] + w11*vxa[i0+dy+1];
+      vy[i] = w00*vya[i0]    + w10*vya[i0+1]
+	+     w01*vya[i0+dy] + w11*vya[i0+dy+1];
+
+    } else if (RANK == 3) {
+
+      const double w000 = (1.0-wx)*(1.0-wy)*(1.0-wz);
+      const double w100 = (    wx)*(1.0-wy)*(1.0-wz);
+      const double w010 = (1.0-wx)*(    wy)*(1.0-wz);
+      const double w110 = (    wx)*(    wy)*(1.0-wz);
+      const double w001 = (1.0-wx)*(1.0-wy)*(    wz);
+      const double w101 = (    wx)*(1.0-wy)*(    wz);
+      const double w011 = (1.0-wx)*(    wy)*(    wz);
+      const double w111 = (    wx)*(    wy)*(    wz);
+
+      const int i000 = i0;
+      const int i100 = i0 + 1;
+      const int i010 = i0 + dy;
+      const int i110 = i0 + dy + 1;
+      const int i001 = i0 + dz;
+      const int i101 = i0 + dz + 1;
+      const int i011 = i0 + dz + dy;
+      const int i111 = i0 + dz + dy + 1;
+
+      vx[i] = w000*vxa[i000] + w100*vxa[i100] + w010*vxa[i010] + w110*vxa[i110]
+	+     w001*vxa[i001] + w101*vxa[i101] + w011*vxa[i011] + w111*vxa[i111];
+      vy[i] = w000*vya[i000] + w100*vya[i100] + w010*vya[i010] + w110*vya[i110]
+	+     w001*vya[i001] + w101*vya[i101] + w011*vya[i011] + w111*vya[i111];
+      vz[i] = w000*vza[i000] + w100*vza[i100] + w010*vza[i010] + w110*vza[i110]
+	+     w001*vza[i001] + w101*vza[i101] + w011*vza[i011] + w111*vza[i111];
+    }
+  }
+}
 
-    double dt = block -> dt();
+//----------------------------------------------------------------------
 
-    // Get velocity precision: ASSUMES precision same for all axes and
-    // is single or double
-    
-    const bool is_single =
-      (field.precision (field.field_id("velocity_x")) == precision_single);
+/// Advance np positions of type P with stride dp by dt, in chunks of
+/// TRACE_CHUNK_SIZE particles; order 2 uses the midpoint Runge-Kutta
+/// method, reusing the same velocity interpolation for both stages
+template <class T, class P, int RANK>
+static void trace_advance_
+(const trace_grid_type & g,
+ const T * vxa, const T * vya, const T * vza,
+ int order, double dt,
+ P * xa, P * ya, P * za, int dp, int np)
+{
+  double px[TRACE_CHUNK_SIZE], py[TRACE_CHUNK_SIZE], pz[TRACE_CHUNK_SIZE];
+  double qx[TRACE_CHUNK_SIZE], qy[TRACE_CHUNK_SIZE], qz[TRACE_CHUNK_SIZE];
+  double vx[TRACE_CHUNK_SIZE], vy[TRACE_CHUNK_SIZE], vz[TRACE_CHUNK_SIZE];
 
-    // declare particle position arrays
+  for (int ip0=0; ip0<np; ip0+=TRACE_CHUNK_SIZE) {
 
-    float * xa = 0;
-    float * ya = 0;
-    float * za = 0;
+    const int n = std::min(TRACE_CHUNK_SIZE,np-ip0);
 
-    for (int ib=0; ib<particle.num_batches(it); ib++) {
+    // gather positions
 
-      xa = (float *) particle.attribute_array (it,ia_x,ib);
-      ya = (float *) particle.attribute_array (it,ia_y,ib);
-      za = (float *) particle.attribute_array (it,ia_z,ib);
+    for (int i=0; i<n; i++) px[i] = xa[(ip0+i)*dp];
+    if (RANK >= 2) for (int i=0; i<n; i++) py[i] = ya[(ip0+i)*dp];
+    if (RANK >= 3) for (int i=0; i<n; i++) pz[i] = za[(ip0+i)*dp];
 
-      const int np = particle.num_particles(it,ib);
+    trace_velocity_<T,RANK> (g,vxa,vya,vza,n,px,py,pz,vx,vy,vz);
 
-      if (rank == 1) {
+    if (order == 2) {
 
-	for (int ip=0; ip<np; ip++) {
+      // velocity at the midpoint
 
-	  double x = xa[ip*dp];
+      const double dt2 = 0.5*dt;
+      for (int i=0; i<n; i++) qx[i] = px[i] + dt2*vx[i];
+      if (RANK >= 2) for (int i=0; i<n; i++) qy[i] = py[i] + dt2*vy[i];
+      if (RANK >= 3) for (int i=0; i<n; i++) qz[i] = pz[i] + dt2*vz[i];
 
-	  int ix0 = gx + floor((nx-1)*(x - xm) / (xp - xm));
-	  int ix1 = ix0 + 1;
-	  double x0 = xm + (ix0-gx+0.5)*hx;
-	  double x1 = 1 - x0;
-	  double v0 = is_single ? vxa4[ix0] : vxa8[ix0];
-	  double v1 = is_single ? vxa4[ix1] : vxa8[ix1];
-	  double vx = v0*x1 + v1*x0;
+      trace_velocity_<T,RANK> (g,vxa,vya,vza,n,qx,qy,qz,vx,vy,vz);
+    }
 
-	  xa[ip*dp] += vx*dt;
+    // update positions
 
-	}
+    for (int i=0; i<n; i++) xa[(ip0+i)*dp] = px[i] + dt*vx[i];
+    if (RANK >= 2) for (int i=0; i<n; i++) ya[(ip0+i)*dp] = py[i] + dt*vy[i];
+    if (RANK >= 3) for (int i=0; i<n; i++) za[(ip0+i)*dp] = pz[i] + dt*vz[i];
+  }
+}
 
-      } else if (rank == 2) {
+//----------------------------------------------------------------------
 
-	for (int ip=0; ip<np; ip++) {
+template <class T, class P>
+void MethodTrace::advance_positions
+(int rank, int order, double dt,
+ const int m3[3], const int g3[3], const double xm3[3], const double h3[3],
+ const T * vxa, const T * vya, const T * vza,
+ P * xa, P * ya, P * za, int dp, int np) throw()
+{
+  trace_grid_type g;
+
+  g.mx = m3[0];  g.my = m3[1];  g.mz = m3[2];
+  g.gx = g3[0];  g.gy = g3[1];  g.gz = g3[2];
+  g.xm = xm3[0]; g.ym = xm3[1]; g.zm = xm3[2];
+  g.hx = h3[0];  g.hy = h3[1];  g.hz = h3[2];
+
+  if (rank == 1) {
+    trace_advance_<T,P,1> (g,vxa,vya,vza,order,dt,xa,ya,za,dp,np);
+  } else if (rank == 2) {
+    trace_advance_<T,P,2> (g,vxa,vya,vza,order,dt,xa,ya,za,dp,np);
+  } else if (rank == 3) {
+    trace_advance_<T,P,3> (g,vxa,vya,vza,order,dt,xa,ya,za,dp,np);
+  }
+}
 
-	  double x = xa[ip*dp];
-	  double y = ya[ip*dp];
+#define TRACE_ADVANCE_POSITIONS(T,P)					\
+  template void MethodTrace::advance_positions<T,P>			\
+  (int rank, int order, double dt,					\
+   const int m3[3], const int g3[3], const double xm3[3], const double h3[3], \
+   const T * vxa, const T * vya, const T * vza,				\
+   P * xa, P * ya, P * za, int dp, int np) throw();
 
-	  int ix0 = gx + floor((nx-1)*(x - xm) / (xp - xm));
-	  int iy0 = gy + floor((ny-1)*(y - ym) / (yp - ym));
+TRACE_ADVANCE_POSITIONS(float,float)
+TRACE_ADVANCE_POSITIONS(float,double)
+TRACE_ADVANCE_POSITIONS(double,float)
+TRACE_ADVANCE_POSITIONS(double,double)
+
+//----------------------------------------------------------------------
+
+template <class T, class P>
+void MethodTrace::advance_
+(Block * block, Particle & particle, int it,
+ const T * vxa, const T * vya, const T * vza) throw()
+{
+  Field field (block->data()->field());
 
-	  int ix1 = ix0 + 1;
-	  int iy1 = iy0 + 1;
+  const int rank = cello::rank();
 
-	  double x0 = xm + (ix0-gx+0.5)*hx;
-	  double y0 = ym + (iy0-gy+0.5)*hy;
+  const int ia_x = particle.attribute_index(it,"x");
+  const int ia_y = particle.attribute_index(it,"y");
+  const int ia_z = particle.attribute_index(it,"z");
 
-	  double x1 = 1.0 - x0;
-	  double y1 = 1.0 - y0;
+  const int dp = particle.stride(it,ia_x);
 
-	  const int i00 = ix0+mx*iy0;
-	  const int i10 = ix1+mx*iy0;
-	  const int i01 = ix0+mx*iy1;
-	  const int i11 = ix1+mx*iy1;
+  int m3[3],g3[3],n3[3];
+  field.dimensions(0,m3,m3+1,m3+2);
+  field.ghost_depth(0,g3,g3+1,g3+2);
+  field.size(n3,n3+1,n3+2);
 
-	  double vx00 = is_single ? vxa4[i00] : vxa8[i00];
-	  double vx10 = is_single ? vxa4[i10] : vxa8[i10];
-	  double vx01 = is_single ? vxa4[i01] : vxa8[i01];
-	  double vx11 = is_single ? vxa4[i11] : vxa8[i11];
+  double xm3[3],xp3[3],h3[3];
+  block->lower(xm3,xm3+1,xm3+2);
+  block->upper(xp3,xp3+1,xp3+2);
+  for (int axis=0; axis<3; axis++) {
+    h3[axis] = (xp3[axis]-xm3[axis])/n3[axis];
+  }
 
-	  double vx = vx00*x1*y1 
-	    +         vx10*x0*y1
-	    +         vx01*x1*y0
-	    +         vx11*x0*y0;
+  const double dt = block->dt();
 
-	  double vy00 = is_single ? vya4[i00] : vya8[i00];
-	  double vy10 = is_single ? vya4[i10] : vya8[i10];
-	  double vy01 = is_single ? vya4[i01] : vya8[i01];
-	  double vy11 = is_single ? vya4[i11] : vya8[i11];
+  for (int ib=0; ib<particle.num_batches(it); ib++) {
 
-	  double vy = vy00*x1*y1 
-	    +         vy10*x0*y1
-	    +         vy01*x1*y0
-	    +         vy11*x0*y0;
+    P * xa = (rank >= 1) ? (P *) particle.attribute_array (it,ia_x,ib) : NULL;
+    P * ya = (rank >= 2) ? (P *) particle.attribute_array (it,ia_y,ib) : NULL;
+    P * za = (rank >= 3) ? (P *) particle.attribute_array (it,ia_z,ib) : NULL;
 
-	  xa[ip*dp] += vx*dt;
-	  ya[ip*dp] += vy*dt;
+    const int np = particle.num_particles(it,ib);
 
-	}
-      } else if (rank == 3) {
-	for (int ip=0; ip<np; ip++) {
-
-	  double x = xa[ip*dp];
-	  double y = ya[ip*dp];
-	  double z = za[ip*dp];
-
-	  int ix0 = gx + floor((nx-1)*(x - xm) / (xp - xm));
-	  int iy0 = gy + floor((ny-1)*(y - ym) / (yp - ym));
-	  int iz0 = gz + floor((nz-1)*(z - zm) / (zp - zm));
-
-	  int ix1 = ix0 + 1;
-	  int iy1 = iy0 + 1;
-	  int iz1 = iz0 + 1;
-
-	  double x0 = xm + (ix0-gx+0.5)*hx;
-	  double y0 = ym + (iy0-gy+0.5)*hy;
-	  double z0 = zm + (iz0-gz+0.5)*hz;
-
-	  double x1 = 1.0 - x0;
-	  double y1 = 1.0 - y0;
-	  double z1 = 1.0 - z0;
-
-	  const int i000 = ix0+mx*(iy0 + my*iz0);
-	  const int i001 = ix0+mx*(iy0 + my*iz1);
-	  const int i010 = ix0+mx*(iy1 + my*iz0);
-	  const int i011 = ix0+mx*(iy1 + my*iz1);
-	  const int i100 = ix1+mx*(iy0 + my*iz0);
-	  const int i101 = ix1+mx*(iy0 + my*iz1);
-	  const int i110 = ix1+mx*(iy1 + my*iz0);
-	  const int i111 = ix1+mx*(iy1 + my*iz1);
-
-	  double vx000 = is_single ? vxa4[i000] : vxa8[i000];
-	  double vx010 = is_single ? vxa4[i010] : vxa8[i010];
-	  double vx001 = is_single ? vxa4[i001] : vxa8[i001];
-	  double vx011 = is_single ? vxa4[i011] : vxa8[i011];
-	  double vx100 = is_single ? vxa4[i100] : vxa8[i100];
-	  double vx110 = is_single ? vxa4[i110] : vxa8[i110];
-	  double vx101 = is_single ? vxa4[i101] : vxa8[i101];
-	  double vx111 = is_single ? vxa4[i111] : vxa8[i111];
-
-	  double vx = vx000*x1*y1*z1
-	    +         vx100*x0*y1*z1
-	    +         vx010*x1*y0*z1
-	    +         vx110*x0*y0*z1
-	    +         vx001*x1*y1*z0
-	    +         vx101*x0*y1*z0
-	    +         vx011*x1*y0*z0
-	    +         vx111*x0*y0*z0;
-
-	  double vy000 = is_single ? vya4[i000] : vya8[i000];
-	  double vy010 = is_single ? vya4[i010] : vya8[i010];
-	  double vy001 = is_single ? vya4[i001] : vya8[i001];
-	  double vy011 = is_single ? vya4[i011] : vya8[i011];
-	  double vy100 = is_single ? vya4[i100] : vya8[i100];
-	  double vy110 = is_single ? vya4[i110] : vya8[i110];
-	  double vy101 = is_single ? vya4[i101] : vya8[i101];
-	  double vy111 = is_single ? vya4[i111] : vya8[i111];
-
-	  double vy = vy000*x1*y1*z1
-	    +         vy100*x0*y1*z1
-	    +         vy010*x1*y0*z1
-	    +         vy110*x0*y0*z1
-	    +         vy001*x1*y1*z0
-	    +         vy101*x0*y1*z0
-	    +         vy011*x1*y0*z0
-	    +         vy111*x0*y0*z0;
-
-	  double vz000 = is_single ? vza4[i000] : vza8[i000];
-	  double vz010 = is_single ? vza4[i010] : vza8[i010];
-	  double vz001 = is_single ? vza4[i001] : vza8[i001];
-	  double vz011 = is_single ? vza4[i011] : vza8[i011];
-	  double vz100 = is_single ? vza4[i100] : vza8[i100];
-	  double vz110 = is_single ? vza4[i110] : vza8[i110];
-	  double vz101 = is_single ? vza4[i101] : vza8[i101];
-	  double vz111 = is_single ? vza4[i111] : vza8[i111];
-
-	  double vz = vz000*x1*y1*z1
-	    +         vz100*x0*y1*z1
-	    +         vz010*x1*y0*z1
-	    +         vz110*x0*y0*z1
-	    +         vz001*x1*y1*z0
-	    +         vz101*x0*y1*z0
-	    +         vz011*x1*y0*z0
-	    +         vz111*x0*y0*z0;
-
-
-	  xa[ip*dp] += vx*dt;
-	  ya[ip*dp] += vy*dt;
-	  za[ip*dp] += vz*dt;
-	}
-      }
-    }
+    advance_positions<T,P>
+      (rank,order_,dt,m3,g3,xm3,h3,vxa,vya,vza,xa,ya,za,dp,np);
   }
-  
-  block->compute_done();
-  
 }
 
 //----------------------------------------------------------------------
@@ -22,7 +22,8 @@ public: // interface
   /// Create a new MethodTrace
   MethodTrace (double courant,
 	       double timestep,
-	       std::string name) throw() ;
+	       std::string name,
+	       int order = 1) throw() ;
 
   /// Destructor
   virtual ~MethodTrace() throw()
@@ -35,7 +36,8 @@ public: // interface
   MethodTrace (CkMigrateMessage *m)
     : Method(m),
       timestep_(0.0),
-      name_()
+      name_(),
+      order_(1)
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -45,6 +47,7 @@ public: // interface
     Method::pup(p);
     p | timestep_;
     p | name_;
+    p | order_;
   };
 
 public: // virtual functions
@@ -60,8 +63,28 @@ public: // virtual functions
   virtual std::string name () throw ()
   { return "trace"; }
 
+public: // static functions
+
+  /// Advance np positions of type P with stride dp by dt, using
+  /// linear interpolation of the cell-centered velocity fields of type
+  /// T with dimensions m3 including ghost depths g3, lower extent
+  /// xm3 (excluding ghosts), and cell widths h3.  Positions outside
+  /// the fields use the nearest values
+  template <class T, class P>
+  static void advance_positions
+  (int rank, int order, double dt,
+   const int m3[3], const int g3[3], const double xm3[3], const double h3[3],
+   const T * vxa, const T * vya, const T * vza,
+   P * xa, P * ya, P * za, int dp, int np) throw();
+
 protected: // functions
 
+  /// Advance particle positions of type P using velocity fields of
+  /// type T
+  template <class T, class P>
+  void advance_ (Block * block, Particle & particle, int it,
+		 const T * vxa, const T * vya, const T * vza) throw();
+
 
 protected: // attributes
 
@@ -70,6 +93,9 @@ protected: // attributes
   /// Name of the particle type to update
   std::string name_;
 
+  /// Order of time integration: 1 (Euler) or 2 (midpoint Runge-Kutta)
+  int order_;
+
 };
 
 #endif /* PROBLEM_METHOD_TRACE_HPP */
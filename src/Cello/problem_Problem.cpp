@@ -24,7 +24,8 @@ Problem::Problem() throw()
     units_(NULL),
     index_refine_(0),
     index_output_(0),
-    index_boundary_(0)
+    index_boundary_(0),
+    compute_map_()
 {
   
 }
@@ -426,6 +427,55 @@ void Problem::initialize_output
 
         }
 
+        // FORMAT
+
+        output_image->set_format
+          (config->output_image_format[index],
+           config->output_image_num_threads[index]);
+
+        // IMAGE PRODUCTS
+
+        const int num_products =
+          config->output_image_product_field[index].size();
+
+        if (num_products > 0) {
+
+          output_image->clear_products();
+
+          for (int k=0; k<num_products; k++) {
+
+            std::string field_name =
+              config->output_image_product_field[index][k];
+            std::string axis =
+              config->output_image_product_axis[index][k];
+            std::string reduce =
+              config->output_image_product_reduce[index][k];
+            const std::vector<double> & colormap =
+              config->output_image_product_colormap[index][k];
+
+            const int index_field = field_descr->field_id(field_name);
+
+            ASSERT2("Problem::initialize_output",
+                    "Output %s image product field %s is not defined",
+                    config->output_list[index].c_str(),field_name.c_str(),
+                    index_field >= 0);
+
+            const int nc = colormap.size() / 3;
+            std::vector<double> r(nc),g(nc),b(nc);
+            for (int i=0; i<nc; i++) {
+              r[i] = colormap[3*i+0];
+              g[i] = colormap[3*i+1];
+              b[i] = colormap[3*i+2];
+            }
+
+            std::string name = field_name + "-" + axis + "-" + reduce;
+
+            output_image->add_product
+              (name,index_field,axis[0]-'x',reduce,
+               nc,r.data(),g.data(),b.data());
+          }
+        }
+
       }
 
     }
@@ -540,6 +590,10 @@ void Problem::deallocate_() throw()
   for (size_t i=0; i<method_list_.size(); i++) {
     delete method_list_[i];    method_list_[i] = 0;
   }
+  for (auto it=compute_map_.begin(); it!=compute_map_.end(); ++it) {
+    delete it->second;
+  }
+  compute_map_.clear();
 }
 
 //----------------------------------------------------------------------
@@ -810,6 +864,20 @@ Compute * Problem::create_compute
 
 //----------------------------------------------------------------------
 
+Compute * Problem::compute
+  ( std::string name,
+    Config * config ) throw ()
+{
+  auto it = compute_map_.find(name);
+  if (it != compute_map_.end()) return it->second;
+
+  Compute * compute = create_compute(name,config);
+  compute_map_[name] = compute;
+  return compute;
+}
+
+//----------------------------------------------------------------------
+
 Method * Problem::create_method_ 
 ( std::string  name,
   Config * config,
@@ -823,7 +891,8 @@ Method * Problem::create_method_
   if (name == "trace") {
     method = new MethodTrace(config->method_courant[index_method],
 			     config->method_timestep[index_method],
-			     config->method_trace_name[index_method]);
+			     config->method_trace_name[index_method],
+			     config->method_trace_order[index_method]);
   } else if (name == "null") {
 
     method = new MethodNull
@@ -78,7 +78,8 @@ public: // interface
       units_(NULL),
       index_refine_(0),
       index_output_(0),
-      index_boundary_(0)
+      index_boundary_(0),
+      compute_map_()
   {}
 
   /// CHARM++ Pack / Unpack function
@@ -165,8 +166,10 @@ public: // interface
   void output_wait(Simulation * simulation) throw();
   
   /// Receive data from non-writing process, write to disk, close, and
-  /// proceed with next output
-  void output_write (Simulation * simulation, int n, char * buffer) throw();
+  /// proceed with next output.  If part >= 0 the data are for the
+  /// given part of a multi-part Output
+  void output_write (Simulation * simulation, int n, char * buffer,
+		     int part = -1) throw();
 
   /// Return the stopping object
   Stopping * stopping() const throw() { return stopping_; }
@@ -217,6 +220,10 @@ public: // interface
   (std::string type,
    Config * config) throw();
 
+  /// Return the named compute object, creating it on first use.  The
+  /// returned object is owned by the Problem and must not be deleted
+  Compute * compute (std::string type, Config * config) throw();
+
 protected: // functions
 
   /// Deallocate components
@@ -330,6 +337,9 @@ protected: // attributes
   /// Index of currently active Boundary object
   int index_boundary_;
 
+  /// Compute objects created by compute() (not packed)
+  std::map<std::string,Compute *> compute_map_;
+
 };
 
 #endif /* PROBLEM_PROBLEM_HPP */
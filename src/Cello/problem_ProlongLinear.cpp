@@ -69,10 +69,6 @@ int ProlongLinear::apply_
 	const T * values_c, int mc3[3], int oc3[3], int nc3[3],
 	bool accumulate)
 {
-  const int dcx = 1;
-  const int dcy = mc3[0];
-  const int dcz = mc3[0]*mc3[1];
-
   int rank = (mf3[1] == 1) ? 1 : ( (mf3[2] == 1) ? 2 : 3 );
 
   for (int i=0; i<rank; i++) {
@@ -81,376 +77,165 @@ int ProlongLinear::apply_
              "fine array %c-axis %d must be 2 times coarse axis %d",
              xyz[i],nf3[i],nc3[i],
              nf3[i]==2*nc3[i] || nf3[i]==2*(nc3[i]-2));
-
-    // ASSERT2 ("ProlongLinear::apply_",
-    //          "fine grid %c-axis %d must be divisible by 2",
-    //          xyz[i],nf3[i],nf3[i] % 2 == 0);
-    // ASSERT2 ("ProlongLinear::apply_",
-    //          "fine grid %c-axis %d must be at least 4",
-    //          xyz[i],nf3[i],nf3[i] >= 4);
   }
 
-  // adjustment if coarse ghost cells available
-  // NOTE:1 if ghosts not available , 0 if ghosts available
-  
-  int gcx = (nf3[0]==2*nc3[0]) ? 1 : 0;
-  int gcy = (nf3[1]==2*nc3[1]) ? 1 : 0;
-  int gcz = (nf3[2]==2*nc3[2]) ? 1 : 0;
-
-  if (nf3[1]==1) {
-
-    const int ofx = of3[0];
-    const int ocx = oc3[0];
-    const int nfx = nf3[0];
-
-    if (! accumulate) {
-      for (int ifx = 0; ifx<nfx; ifx++) {
-
-	int icx = ((ifx+1) >> 1) - gcx;
-
-	// Default weighting factor
-	int wx[2] = { 1, 3 };
-
-	// Update weights if no ghosts and on edges
-	if (ifx==0)     { icx += gcx; }
-	if (ifx==nfx-1) { icx -= gcx; }
-	if (ifx==0 || ifx==nfx-1) {
-	  wx[0] += 4*gcx;
-	  wx[1] -= 4*gcx;
-	}
-
-	T wx0 = 0.25*wx[ ifx&1];
-	T wx1 = 0.25*wx[~ifx&1];
-
-	int i_c = (ocx+icx) ;
-	int i_f = (ofx+ifx) ;
-
-	values_f[i_f] = wx0*values_c[i_c]
-	  +             wx1*values_c[i_c + dcx ];
-      }
-    } else { // accumulate
-      for (int ifx = 0; ifx<nfx; ifx++) {
-
-	int icx = ((ifx+1) >> 1) - gcx;
-
-	// Default weighting factor
-	int wx[2] = { 1, 3 };
-
-	// Update weights if no ghosts and on edges
-	if (ifx==0)     { icx += gcx; }
-	if (ifx==nfx-1) { icx -= gcx; }
-	if (ifx==0 || ifx==nfx-1) {
-	  wx[0] += 4*gcx;
-	  wx[1] -= 4*gcx;
-	}
-
-	T wx0 = 0.25*wx[ ifx&1];
-	T wx1 = 0.25*wx[~ifx&1];
-
-	int i_c = (ocx+icx) ;
-	int i_f = (ofx+ifx) ;
-
-	values_f[i_f] += wx0*values_c[i_c]
-	  +              wx1*values_c[i_c + dcx ];
-      }
-    }
+  if (rank == 1) {
+    if (accumulate) apply_kernel_<T,1,true>  (values_f,mf3,of3,nf3,
+					      values_c,mc3,oc3,nc3);
+    else            apply_kernel_<T,1,false> (values_f,mf3,of3,nf3,
+					      values_c,mc3,oc3,nc3);
     return (sizeof(T) * nc3[0]);
+  } else if (rank == 2) {
+    if (accumulate) apply_kernel_<T,2,true>  (values_f,mf3,of3,nf3,
+					      values_c,mc3,oc3,nc3);
+    else            apply_kernel_<T,2,false> (values_f,mf3,of3,nf3,
+					      values_c,mc3,oc3,nc3);
+    return (sizeof(T) * nc3[0]*nc3[1]);
+  } else {
+    if (accumulate) apply_kernel_<T,3,true>  (values_f,mf3,of3,nf3,
+					      values_c,mc3,oc3,nc3);
+    else            apply_kernel_<T,3,false> (values_f,mf3,of3,nf3,
+					      values_c,mc3,oc3,nc3);
+    return (sizeof(T) * nc3[0]*nc3[1]*nc3[2]);
+  }
+}
 
+//----------------------------------------------------------------------
 
-  } else if (nf3[2] == 1) {
-
-    const int ofy = of3[1];
-    const int ocy = oc3[1];
-    const int nfy = nf3[1];
-    
-    if (! accumulate) {
-      for (int ify = 0; ify<nfy; ify++) {
-
-	int icy = ((ify+1) >> 1) - gcy;
-
-	// Default weighting factor
-	int wy[2] = { 1, 3 };
-
-	// Update weights if no ghosts and on edges
-	if (ify==0)     { icy += gcy; }
-	if (ify==nfy-1) { icy -= gcy; }
-	if (ify==0 || ify==nfy-1) {
-	  wy[0] += 4*gcy;
-	  wy[1] -= 4*gcy;
-	}
-
-	T wy0 = 0.25*wy[ ify&1];
-	T wy1 = 0.25*wy[~ify&1];
-
-	const int ofx = of3[0];
-	const int ocx = oc3[0];
-	const int nfx = nf3[0];
-
-	const int mcx = mc3[0];
-	const int mfx = mf3[0];
-
-	for (int ifx = 0; ifx<nfx; ifx++) {
-
-	  int icx = ((ifx+1) >> 1) - gcx;
-
-	  // Default weighting factor
-	  int wx[2] = { 1, 3 };
-
-	  // Update weights if no ghosts and on edges
-	  if (ifx==0)     { icx += gcx; }
-	  if (ifx==nfx-1) { icx -= gcx; }
-	  if (ifx==0 || ifx==nfx-1) {
-	    wx[0] += 4*gcx;
-	    wx[1] -= 4*gcx;
-	  }
-
-	  T wx0 = 0.25*wx[ ifx&1];
-	  T wx1 = 0.25*wx[~ifx&1];
-
-	  int i_c = (ocx+icx) + mcx * ( (ocy+icy) );
-	  int i_f = (ofx+ifx) + mfx * ( (ofy+ify) );
-
-	  values_f[i_f] = wx0*wy0*values_c[i_c]
-	    +             wx1*wy0*values_c[i_c + dcx ]
-	    +             wx0*wy1*values_c[i_c       + dcy ]
-	    +             wx1*wy1*values_c[i_c + dcx + dcy ];
-	}
-      }
-    } else { // accumulate
-
-      for (int ify = 0; ify<nfy; ify++) {
-
-	int icy = ((ify+1) >> 1) - gcy;
+void ProlongLinear::weights_
+(int i_f, int n_f, int g_c, int * i_c, double * w0, double * w1) throw()
+{
+  // adjustment if coarse ghost cells available
+  // NOTE: g_c is 1 if ghosts not available, 0 if ghosts available
 
-	// Default weighting factor
-	int wy[2] = { 1, 3 };
+  *i_c = ((i_f+1) >> 1) - g_c;
 
-	// Update weights if no ghosts and on edges
-	if (ify==0)     { icy += gcy; }
-	if (ify==nfy-1) { icy -= gcy; }
-	if (ify==0 || ify==nfy-1) {
-	  wy[0] += 4*gcy;
-	  wy[1] -= 4*gcy;
-	}
+  // Default weighting factor
+  int w[2] = { 1, 3 };
 
-	T wy0 = 0.25*wy[ ify&1];
-	T wy1 = 0.25*wy[~ify&1];
+  // Update weights if no ghosts and on edges
+  if (i_f==0)     { *i_c += g_c; }
+  if (i_f==n_f-1) { *i_c -= g_c; }
+  if (i_f==0 || i_f==n_f-1) {
+    w[0] += 4*g_c;
+    w[1] -= 4*g_c;
+  }
 
-	const int ofx = of3[0];
-	const int ocx = oc3[0];
-	const int nfx = nf3[0];
+  *w0 = 0.25*w[ i_f&1];
+  *w1 = 0.25*w[~i_f&1];
+}
 
-	const int mcx = mc3[0];
-	const int mfx = mf3[0];
+//----------------------------------------------------------------------
 
-	for (int ifx = 0; ifx<nfx; ifx++) {
+template <class T, int RANK, bool ACCUMULATE>
+void ProlongLinear::apply_kernel_
+(       T * values_f, int mf3[3], int of3[3], int nf3[3],
+	const T * values_c, int mc3[3], int oc3[3], int nc3[3])
+{
+  // Linear interpolation is separable: for each fine row, first blend
+  // the (up to four) contributing coarse rows along y and z into a
+  // contiguous temporary row, then interpolate along x.  The x loop
+  // is split into the two edge values, whose weights depend on
+  // whether coarse ghost values are available, and interior pairs
+  // with constant weights 3/4 and 1/4, which vectorize.
 
-	  int icx = ((ifx+1) >> 1) - gcx;
+  const int gcx = (nf3[0]==2*nc3[0]) ? 1 : 0;
+  const int gcy = (nf3[1]==2*nc3[1]) ? 1 : 0;
+  const int gcz = (nf3[2]==2*nc3[2]) ? 1 : 0;
 
-	  // Default weighting factor
-	  int wx[2] = { 1, 3 };
+  const int nfx = nf3[0];
+  const int nfy = (RANK >= 2) ? nf3[1] : 1;
+  const int nfz = (RANK >= 3) ? nf3[2] : 1;
 
-	  // Update weights if no ghosts and on edges
-	  if (ifx==0)     { icx += gcx; }
-	  if (ifx==nfx-1) { icx -= gcx; }
-	  if (ifx==0 || ifx==nfx-1) {
-	    wx[0] += 4*gcx;
-	    wx[1] -= 4*gcx;
-	  }
+  const int ncx = nc3[0];
 
-	  T wx0 = 0.25*wx[ ifx&1];
-	  T wx1 = 0.25*wx[~ifx&1];
+  const int dcy = mc3[0];
+  const int dcz = mc3[0]*mc3[1];
 
-	  int i_c = (ocx+icx) + mcx * ( (ocy+icy) );
-	  int i_f = (ofx+ifx) + mfx * ( (ofy+ify) );
+  std::vector<T> row ((RANK >= 2) ? ncx : 0);
 
-	  values_f[i_f] += wx0*wy0*values_c[i_c]
-	    +              wx1*wy0*values_c[i_c + dcx ]
-	    +              wx0*wy1*values_c[i_c       + dcy ]
-	    +              wx1*wy1*values_c[i_c + dcx + dcy ];
-	}
-      }
-    }
+  for (int ifz = 0; ifz<nfz; ifz++) {
 
-    return (sizeof(T) * nc3[0]*nc3[1]);
+    int icz = 0;
+    double wz0 = 1.0, wz1 = 0.0;
+    if (RANK >= 3) weights_(ifz,nfz,gcz,&icz,&wz0,&wz1);
 
-  } else {
+    for (int ify = 0; ify<nfy; ify++) {
 
-    const int ofz = of3[2];
-    const int ocz = oc3[2];
-    const int nfz = nf3[2];
+      int icy = 0;
+      double wy0 = 1.0, wy1 = 0.0;
+      if (RANK >= 2) weights_(ify,nfy,gcy,&icy,&wy0,&wy1);
 
-    if (! accumulate) {
-      for (int ifz = 0; ifz<nfz; ifz++) {
+      // coarse row(s) contributing to this fine row
 
-	int icz = ((ifz+1) >> 1) - gcz;
+      const T * c00 = values_c + oc3[0];
+      if (RANK >= 2) c00 += dcy*(oc3[1]+icy);
+      if (RANK >= 3) c00 += dcz*(oc3[2]+icz);
 
-	// Default weighting factor
-	int wz[2] = { 1, 3 };
+      const T * r;
 
-	// Update weights if no ghosts and on edges
-	if (ifz==0)     { icz += gcz; }
-	if (ifz==nfz-1) { icz -= gcz; }
-	if (ifz==0 || ifz==nfz-1) {
-	  wz[0] += 4*gcz;
-	  wz[1] -= 4*gcz;
+      if (RANK == 1) {
+	r = c00;
+      } else if (RANK == 2) {
+	const T w0 = wy0;
+	const T w1 = wy1;
+	const T * c10 = c00 + dcy;
+	for (int ic=0; ic<ncx; ic++) {
+	  row[ic] = w0*c00[ic] + w1*c10[ic];
 	}
-
-	T wz0 = 0.25*wz[ ifz&1];
-	T wz1 = 0.25*wz[~ifz&1];
-
-	const int ofy = of3[1];
-	const int ocy = oc3[1];
-	const int nfy = nf3[1];
-
-	for (int ify = 0; ify<nfy; ify++) {
-
-	  int icy = ((ify+1) >> 1) - gcy;
-
-	  // Default weighting factor
-	  int wy[2] = { 1, 3 };
-
-	  // Update weights if no ghosts and on edges
-	  if (ify==0)     { icy += gcy; }
-	  if (ify==nfy-1) { icy -= gcy; }
-	  if (ify==0 || ify==nfy-1) {
-	    wy[0] += 4*gcy;
-	    wy[1] -= 4*gcy;
-	  }
-
-	  T wy0 = 0.25*wy[ ify&1];
-	  T wy1 = 0.25*wy[~ify&1];
-
-	  const int ofx = of3[0];
-	  const int ocx = oc3[0];
-	  const int nfx = nf3[0];
-
-	  const int mcx = mc3[0];
-	  const int mfx = mf3[0];
-	  const int mcy = mc3[1];
-	  const int myf = mf3[1];
-    
-	  for (int ifx = 0; ifx<nfx; ifx++) {
-
-	    int icx = ((ifx+1) >> 1) - gcx;
-
-	    // Default weighting factor
-	    int wx[2] = { 1, 3 };
-
-	    // Update weights if no ghosts and on edges
-	    if (ifx==0)     { icx += gcx; }
-	    if (ifx==nfx-1) { icx -= gcx; }
-	    if (ifx==0 || ifx==nfx-1) {
-	      wx[0] += 4*gcx;
-	      wx[1] -= 4*gcx;
-	    }
-
-	    T wx0 = 0.25*wx[ ifx&1];
-	    T wx1 = 0.25*wx[~ifx&1];
-
-	    int i_c = (ocx+icx) + mcx*( (ocy+icy) + mcy*(ocz+icz) );
-	    int i_f = (ofx+ifx) + mfx*( (ofy+ify) + myf*(ofz+ifz) );
-	  
-	    values_f[i_f] = wx0*wy0*wz0*values_c[i_c]
-	      +             wx1*wy0*wz0*values_c[i_c + dcx ]
-	      +             wx0*wy1*wz0*values_c[i_c       + dcy ]
-	      +             wx1*wy1*wz0*values_c[i_c + dcx + dcy ]
-	      +             wx0*wy0*wz1*values_c[i_c             + dcz ]
-	      +             wx1*wy0*wz1*values_c[i_c + dcx       + dcz ]
-	      +             wx0*wy1*wz1*values_c[i_c       + dcy + dcz ]
-	      +             wx1*wy1*wz1*values_c[i_c + dcx + dcy + dcz ];
-	  }
+	r = &row[0];
+      } else {
+	const T w00 = wy0*wz0;
+	const T w10 = wy1*wz0;
+	const T w01 = wy0*wz1;
+	const T w11 = wy1*wz1;
+	const T * c10 = c00 + dcy;
+	const T * c01 = c00 + dcz;
+	const T * c11 = c00 + dcy + dcz;
+	for (int ic=0; ic<ncx; ic++) {
+	  row[ic] = w00*c00[ic] + w10*c10[ic] + w01*c01[ic] + w11*c11[ic];
 	}
+	r = &row[0];
       }
-    } else { // accumulate
 
-      for (int ifz = 0; ifz<nfz; ifz++) {
-
-	int icz = ((ifz+1) >> 1) - gcz;
-
-	// Default weighting factor
-	int wz[2] = { 1, 3 };
-
-	// Update weights if no ghosts and on edges
-	if (ifz==0)     { icz += gcz; }
-	if (ifz==nfz-1) { icz -= gcz; }
-	if (ifz==0 || ifz==nfz-1) {
-	  wz[0] += 4*gcz;
-	  wz[1] -= 4*gcz;
+      // fine row
+
+      T * f = values_f + of3[0];
+      if (RANK >= 2) f += mf3[0]*(of3[1]+ify);
+      if (RANK >= 3) f += mf3[0]*mf3[1]*(of3[2]+ifz);
+
+      // interior fine pairs (2k-1, 2k) lie between coarse k-gcx and k-gcx+1
+
+      const T wa = 0.75;
+      const T wb = 0.25;
+      const int nk = nfx/2;
+      const T * rk = r - gcx;
+      for (int k=1; k<nk; k++) {
+	const T va = wa*rk[k] + wb*rk[k+1];
+	const T vb = wb*rk[k] + wa*rk[k+1];
+	if (ACCUMULATE) {
+	  f[2*k-1] += va;
+	  f[2*k]   += vb;
+	} else {
+	  f[2*k-1] = va;
+	  f[2*k]   = vb;
 	}
+      }
 
-	T wz0 = 0.25*wz[ ifz&1];
-	T wz1 = 0.25*wz[~ifz&1];
-
-	const int ofy = of3[1];
-	const int ocy = oc3[1];
-	const int nfy = nf3[1];
-
-	for (int ify = 0; ify<nfy; ify++) {
-
-	  int icy = ((ify+1) >> 1) - gcy;
-
-	  // Default weighting factor
-	  int wy[2] = { 1, 3 };
-
-	  // Update weights if no ghosts and on edges
-	  if (ify==0)     { icy += gcy; }
-	  if (ify==nfy-1) { icy -= gcy; }
-	  if (ify==0 || ify==nfy-1) {
-	    wy[0] += 4*gcy;
-	    wy[1] -= 4*gcy;
-	  }
-
-	  T wy0 = 0.25*wy[ ify&1];
-	  T wy1 = 0.25*wy[~ify&1];
-
-	  const int ofx = of3[0];
-	  const int ocx = oc3[0];
-	  const int nfx = nf3[0];
-
-	  const int mcx = mc3[0];
-	  const int mfx = mf3[0];
-	  const int mcy = mc3[1];
-	  const int myf = mf3[1];
-    
-	  for (int ifx = 0; ifx<nfx; ifx++) {
-
-	    int icx = ((ifx+1) >> 1) - gcx;
-
-	    // Default weighting factor
-	    int wx[2] = { 1, 3 };
-
-	    // Update weights if no ghosts and on edges
-	    if (ifx==0)     { icx += gcx; }
-	    if (ifx==nfx-1) { icx -= gcx; }
-	    if (ifx==0 || ifx==nfx-1) {
-	      wx[0] += 4*gcx;
-	      wx[1] -= 4*gcx;
-	    }
-
-	    T wx0 = 0.25*wx[ ifx&1];
-	    T wx1 = 0.25*wx[~ifx&1];
-
-	    int i_c = (ocx+icx) + mcx*( (ocy+icy) + mcy*(ocz+icz) );
-	    int i_f = (ofx+ifx) + mfx*( (ofy+ify) + myf*(ofz+ifz) );
-	  
-	    values_f[i_f] += wx0*wy0*wz0*values_c[i_c]
-	      +              wx1*wy0*wz0*values_c[i_c + dcx ]
-	      +              wx0*wy1*wz0*values_c[i_c       + dcy ]
-	      +              wx1*wy1*wz0*values_c[i_c + dcx + dcy ]
-	      +              wx0*wy0*wz1*values_c[i_c             + dcz ]
-	      +              wx1*wy0*wz1*values_c[i_c + dcx       + dcz ]
-	      +              wx0*wy1*wz1*values_c[i_c       + dcy + dcz ]
-	      +              wx1*wy1*wz1*values_c[i_c + dcx + dcy + dcz ];
-	  }
-	}
+      // edge fine values
+
+      const int ifx_edge[2] = {0, nfx-1};
+      for (int e=0; e<2; e++) {
+	const int ifx = ifx_edge[e];
+	int icx;
+	double wx0, wx1;
+	weights_(ifx,nfx,gcx,&icx,&wx0,&wx1);
+	const T value = T(wx0)*r[icx] + T(wx1)*r[icx+1];
+	if (ACCUMULATE) f[ifx] += value;
+	else            f[ifx]  = value;
       }
     }
-
-    return (sizeof(T) * nc3[0]*nc3[1]*nc3[2]);
-
   }
 }
 
 //======================================================================
-
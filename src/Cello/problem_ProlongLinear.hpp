@@ -50,6 +50,17 @@ private: // functions
     const T * values_c, int nd3_c[3], int im3_c[3], int n3_c[3],
     bool accumulate = false);
 
+  /// Rank- and accumulate-specialized interpolation kernel
+  template <class T, int RANK, bool ACCUMULATE>
+  void apply_kernel_
+  ( T *       values_f, int nd3_f[3], int im3_f[3], int n3_f[3],
+    const T * values_c, int nd3_c[3], int im3_c[3], int n3_c[3]);
+
+  /// Coarse index offset and weights of the two coarse values
+  /// contributing to fine index i_f along an axis of n_f fine values
+  static void weights_
+  (int i_f, int n_f, int g_c, int * i_c, double * w0, double * w1) throw();
+
 private: // attributes
 
   // NOTE: change pup() function whenever attributes change
@@ -62,137 +62,87 @@ int RestrictLinear::apply_
 
   const int rank = (nd3_f[1] == 1) ? 1 : ((nd3_f[2] == 1) ? 2 : 3);
 
-  const int dx = 1;
-  const int dy = nd3_f[0];
-  const int dz = nd3_f[0]*nd3_f[1];
-
   if (rank == 1) {
+    if (accumulate) apply_kernel_<T,1,true>  (values_c,nd3_c,im3_c,n3_c,
+					      values_f,nd3_f,im3_f);
+    else            apply_kernel_<T,1,false> (values_c,nd3_c,im3_c,n3_c,
+					      values_f,nd3_f,im3_f);
+  } else if (rank == 2) {
+    if (accumulate) apply_kernel_<T,2,true>  (values_c,nd3_c,im3_c,n3_c,
+					      values_f,nd3_f,im3_f);
+    else            apply_kernel_<T,2,false> (values_c,nd3_c,im3_c,n3_c,
+					      values_f,nd3_f,im3_f);
+  } else if (rank == 3) {
+    if (accumulate) apply_kernel_<T,3,true>  (values_c,nd3_c,im3_c,n3_c,
+					      values_f,nd3_f,im3_f);
+    else            apply_kernel_<T,3,false> (values_c,nd3_c,im3_c,n3_c,
+					      values_f,nd3_f,im3_f);
+  }
+  return (sizeof(T) * n3_c[0]*n3_c[1]*n3_c[2]);
+}
 
-    if (! accumulate) {
-      for (int ix_c=0; ix_c<n3_c[0]; ix_c++) {
-	int ix_f = ix_c*2;
+//----------------------------------------------------------------------
 
-	int i_c = (im3_c[0]+ix_c);
-	int i_f = (im3_f[0]+ix_f);
+template<class T, int RANK, bool ACCUMULATE>
+void RestrictLinear::apply_kernel_
+( T *       values_c, int nd3_c[3], int im3_c[3],  int n3_c[3],
+  const T * values_f, int nd3_f[3], int im3_f[3])
+{
+  // Loops are ordered with x innermost so that coarse values are
+  // written contiguously and fine values read with unit stride pairs
 
-	values_c[i_c] = 0.5 *
-	  ( values_f[i_f     ] + 
-	    values_f[i_f + dx] );
-      }
-    } else { // accumulate
-      for (int ix_c=0; ix_c<n3_c[0]; ix_c++) {
-	int ix_f = ix_c*2;
+  const int dy = nd3_f[0];
+  const int dz = nd3_f[0]*nd3_f[1];
 
-	int i_c = (im3_c[0]+ix_c);
-	int i_f = (im3_f[0]+ix_f);
+  const int nx_c = n3_c[0];
+  const int ny_c = (RANK >= 2) ? n3_c[1] : 1;
+  const int nz_c = (RANK >= 3) ? n3_c[2] : 1;
 
-	values_c[i_c] += 0.5 *
-	  ( values_f[i_f     ] + 
-	    values_f[i_f + dx] );
-      }
-    }
+  const T scale = (RANK == 1) ? 0.5 : ((RANK == 2) ? 0.25 : 0.125);
 
-  } else if (rank == 2) {
+  for (int iz_c=0; iz_c<nz_c; iz_c++) {
+    for (int iy_c=0; iy_c<ny_c; iy_c++) {
 
-    if (! accumulate) {
-      for (int ix_c=0; ix_c<n3_c[0]; ix_c++) {
-	int ix_f = ix_c*2;
-	for (int iy_c=0; iy_c<n3_c[1]; iy_c++) {
-	  int iy_f = iy_c*2;
-
-	  int i_c = (im3_c[0]+ix_c) + nd3_c[0]*
-	    (       (im3_c[1]+iy_c));
-	  int i_f = (im3_f[0]+ix_f) + nd3_f[0]*
-	    (       (im3_f[1]+iy_f));
-
-	  values_c[i_c] = 0.25 *
-	    ( values_f[i_f          ] + 
-	      values_f[i_f + dx     ] +
-	      values_f[i_f +      dy] + 
-	      values_f[i_f + dx + dy] );
-	}
+      T * c = values_c + im3_c[0];
+      const T * f = values_f + im3_f[0];
+      if (RANK >= 2) {
+	c += nd3_c[0]*(im3_c[1]+iy_c);
+	f += nd3_f[0]*(im3_f[1]+2*iy_c);
       }
-    } else { // accumulate
-
-      for (int ix_c=0; ix_c<n3_c[0]; ix_c++) {
-	int ix_f = ix_c*2;
-	for (int iy_c=0; iy_c<n3_c[1]; iy_c++) {
-	  int iy_f = iy_c*2;
-
-	  int i_c = (im3_c[0]+ix_c) + nd3_c[0]*
-	    (       (im3_c[1]+iy_c));
-	  int i_f = (im3_f[0]+ix_f) + nd3_f[0]*
-	    (       (im3_f[1]+iy_f));
-
-	  values_c[i_c] += 0.25 *
-	    ( values_f[i_f          ] + 
-	      values_f[i_f + dx     ] +
-	      values_f[i_f +      dy] + 
-	      values_f[i_f + dx + dy] );
-	}
+      if (RANK >= 3) {
+	c += nd3_c[0]*nd3_c[1]*(im3_c[2]+iz_c);
+	f += nd3_f[0]*nd3_f[1]*(im3_f[2]+2*iz_c);
       }
-    }
-    
-  } else if (rank == 3) {
 
-    if (! accumulate) {
-      for (int ix_c=0; ix_c<n3_c[0]; ix_c++) {
-	int ix_f = ix_c*2;
-	for (int iy_c=0; iy_c<n3_c[1]; iy_c++) {
-	  int iy_f = iy_c*2;
-	  for (int iz_c=0; iz_c<n3_c[2]; iz_c++) {
-	    int iz_f = iz_c*2;
-	    
-	    int i_c = (im3_c[0]+ix_c) + nd3_c[0]*
-	      (       (im3_c[1]+iy_c) + nd3_c[1]*
-		      (im3_c[2]+iz_c));
-	    int i_f = (im3_f[0]+ix_f) + nd3_f[0]*
-	      (       (im3_f[1]+iy_f) + nd3_f[1]*
-		      (im3_f[2]+iz_f));
-
-	    values_c[i_c] = 0.125 * 
-	      ( values_f[i_f               ] + 
-		values_f[i_f + dx          ] +
-		values_f[i_f +      dy     ] + 
-		values_f[i_f + dx + dy     ] +
-		values_f[i_f           + dz] + 
-		values_f[i_f + dx      + dz] +
-		values_f[i_f +      dy + dz] + 
-		values_f[i_f + dx + dy + dz] );
-	  }
-	}
-      }
-    } else { // accumulate
-      for (int ix_c=0; ix_c<n3_c[0]; ix_c++) {
-	int ix_f = ix_c*2;
-	for (int iy_c=0; iy_c<n3_c[1]; iy_c++) {
-	  int iy_f = iy_c*2;
-	  for (int iz_c=0; iz_c<n3_c[2]; iz_c++) {
-	    int iz_f = iz_c*2;
-
-	    int i_c = (im3_c[0]+ix_c) + nd3_c[0]*
-	      (       (im3_c[1]+iy_c) + nd3_c[1]*
-		      (im3_c[2]+iz_c));
-	    int i_f = (im3_f[0]+ix_f) + nd3_f[0]*
-	      (       (im3_f[1]+iy_f) + nd3_f[1]*
-		      (im3_f[2]+iz_f));
-
-	    values_c[i_c] += 0.125 * 
-	      ( values_f[i_f               ] + 
-		values_f[i_f + dx          ] +
-		values_f[i_f +      dy     ] + 
-		values_f[i_f + dx + dy     ] +
-		values_f[i_f           + dz] + 
-		values_f[i_f + dx      + dz] +
-		values_f[i_f +      dy + dz] + 
-		values_f[i_f + dx + dy + dz] );
-	  }
+      for (int ix_c=0; ix_c<nx_c; ix_c++) {
+	const int i_f = 2*ix_c;
+	T value;
+	if (RANK == 1) {
+	  value = 
+	    ( f[i_f     ] + 
+	      f[i_f + 1 ] );
+	} else if (RANK == 2) {
+	  value = 
+	    ( f[i_f              ] + 
+	      f[i_f + 1          ] +
+	      f[i_f +     dy     ] + 
+	      f[i_f + 1 + dy     ] );
+	} else {
+	  value = 
+	    ( f[i_f               ] + 
+	      f[i_f + 1           ] +
+	      f[i_f +     dy      ] + 
+	      f[i_f + 1 + dy      ] +
+	      f[i_f           + dz] + 
+	      f[i_f + 1       + dz] +
+	      f[i_f +     dy  + dz] + 
+	      f[i_f + 1 + dy  + dz] );
 	}
+	if (ACCUMULATE) c[ix_c] += scale*value;
+	else            c[ix_c]  = scale*value;
       }
     }
   }
-  return (sizeof(T) * n3_c[0]*n3_c[1]*n3_c[2]);
 }
 
 //======================================================================
-
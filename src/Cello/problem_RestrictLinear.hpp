@@ -52,6 +52,12 @@ private: // functions
     const T * values_f, int nd3_f[3], int im3_f[3], int n3_f[3],
     bool accumulate = false);
 
+  /// Rank- and accumulate-specialized restriction kernel
+  template<class T, int RANK, bool ACCUMULATE>
+  void apply_kernel_
+  ( T *       values_c, int nd3_c[3], int im3_c[3], int n3_c[3],
+    const T * values_f, int nd3_f[3], int im3_f[3]);
+
 private: // attributes
 
   // NOTE: change pup() function whenever attributes change
@@ -70,6 +70,28 @@ void ScalarExpr::evaluate (T * value, double t,
 	  ndx,ndy,ndz,nx,ny,nz,
 	  (ndx >= nx) && (ndy >= ny) && (ndz >= nz));
 
+  // Skip per-point mask evaluation if the mask is uniform over the
+  // points, and skip the expression entirely if the mask is false
+
+  const mask_region_type region = mask ?
+    mask->region(t, nx,xv, ny,yv, nz,zv) : mask_region_inside;
+
+  if (region == mask_region_outside) {
+    if (deflt && value != deflt) {
+      for (int iz=0; iz<nz; iz++) {
+	for (int iy=0; iy<ny; iy++) {
+	  for (int ix=0; ix<nx; ix++) {
+	    int id=ix + ndx*(iy + ndy*iz);
+	    value[id] = deflt[id];
+	  }
+	}
+      }
+    }
+    return;
+  }
+
+  if (region == mask_region_inside) mask = nullptr;
+
   bool * mv = 0;
   if (mask) {
     mv = new bool [ nx*ny*nz ];
@@ -70,6 +70,10 @@ public: // interface
     evaluate(value,t,ndx,nx,x,ndy,ny,y,ndz,nz,z,0,0);
   }
 
+  /// Return whether the expression depends on time t
+  bool is_time_dependent() const
+  { return param_ && param_->uses_variable('t'); }
+
   
 private: // functions
 
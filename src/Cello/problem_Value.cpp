@@ -105,6 +105,18 @@ template void Value::evaluate
 
 //----------------------------------------------------------------------
 
+bool Value::is_time_dependent() const throw()
+{
+  for (size_t index = 0; index < scalar_expr_list_.size(); index++) {
+    if (scalar_expr_list_[index]->is_time_dependent()) return true;
+    if (mask_list_[index] && mask_list_[index]->is_time_dependent())
+      return true;
+  }
+  return false;
+}
+
+//----------------------------------------------------------------------
+
 void Value::copy_(const Value & value) throw()
 {
   mask_list_.resize(value.mask_list_.size());
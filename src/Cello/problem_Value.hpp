@@ -52,6 +52,14 @@ public: // interface
 
   double evaluate (double t, double x, double y, double z) throw ();
 
+  /// Return whether any expression or mask depends on time t
+  bool is_time_dependent() const throw();
+
+  /// Return whether every point is assigned a value, i.e. results do
+  /// not depend on the initial contents of the values array
+  bool has_default() const throw()
+  { return mask_list_.size() > 0 && mask_list_.back() == nullptr; }
+
 private: // functions
 
   void copy_(const Value & value) throw();
@@ -45,6 +45,8 @@ Simulation::Simulation
   projections_schedule_off_(NULL),
 #endif
   schedule_balance_(NULL),
+  timeline_(),
+  timeline_schedule_(NULL),
   monitor_(NULL),
   hierarchy_(NULL),
   scalar_descr_long_double_(NULL),
@@ -110,6 +112,8 @@ Simulation::Simulation()
   projections_schedule_off_(NULL),
 #endif
   schedule_balance_(NULL),
+  timeline_(),
+  timeline_schedule_(NULL),
   monitor_(NULL),
   hierarchy_(NULL),
   scalar_descr_long_double_(NULL),
@@ -163,6 +167,8 @@ Simulation::Simulation (CkMigrateMessage *m)
     projections_schedule_off_(NULL),
 #endif
     schedule_balance_(NULL),
+    timeline_(),
+    timeline_schedule_(NULL),
     monitor_(NULL),
     hierarchy_(NULL),
     scalar_descr_long_double_(NULL),
@@ -281,6 +287,9 @@ void Simulation::pup (PUP::er &p)
 
   p | schedule_balance_;
 
+  p | timeline_;
+  p | timeline_schedule_;
+
   p | new_refresh_list_;
   p | new_refresh_name_;
 
@@ -468,6 +477,19 @@ void Simulation::initialize_performance_() throw()
   }
 #endif
 
+  const int index_timeline = config_->performance_timeline_schedule_index;
+  if (index_timeline >= 0) {
+    timeline_ = Timeline (true, config_->performance_timeline_size,
+			  config_->performance_timeline_file);
+    timeline_schedule_ = Schedule::create
+      ( config_->schedule_var[index_timeline],
+	config_->schedule_type[index_timeline],
+	config_->schedule_start[index_timeline],
+	config_->schedule_stop[index_timeline],
+	config_->schedule_step[index_timeline],
+	config_->schedule_list[index_timeline]);
+  }
+
   p->begin();
 
   p->start_region(perf_simulation);
@@ -476,6 +498,48 @@ void Simulation::initialize_performance_() throw()
 
 //----------------------------------------------------------------------
 
+void Simulation::timeline_update (int cycle, double time)
+{
+  if (timeline_schedule_ &&
+      timeline_schedule_->write_this_cycle(cycle,time)) {
+    timeline_.write(cycle);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void Simulation::initialize_performance_groups_() throw()
+{
+  Performance * p = performance_;
+
+  Method * method;
+  for (int i=0; (method = problem_->method(i)); i++) {
+    p->new_group_region
+      (perf_group_method, i, perf_compute, "method-" + method->name());
+  }
+
+  for (int i=0; i<problem_->num_solvers(); i++) {
+    p->new_group_region
+      (perf_group_solver, i, perf_compute,
+       "solver-" + problem_->solver(i)->name());
+  }
+
+  Refine * refine;
+  for (int i=0; (refine = problem_->refine(i)); i++) {
+    p->new_group_region
+      (perf_group_refine, i, perf_adapt_apply, "refine-" + refine->name());
+  }
+
+  for (int i=0; i<new_refresh_count(); i++) {
+    const std::string name = new_refresh_name(i);
+    p->new_group_region
+      (perf_group_refresh, i, -1,
+       (name == "UNKNOWN") ? "refresh" : "refresh-" + name);
+  }
+}
+
+//----------------------------------------------------------------------
+
 void Simulation::initialize_config_() throw()
 {
   TRACE("BEGIN Simulation::initialize_config_");
@@ -545,6 +609,14 @@ void Simulation::initialize_data_descr_() throw()
 
   field_descr_->set_history (config_->field_history);
 
+  const int num_history_mode = config_->field_history_mode.size();
+  for (int i=0; i<num_history_mode; i++) {
+    const std::string history = config_->field_history_mode[i];
+    field_descr_->set_history_mode
+      (i, (history == "none") ? history_none :
+          (history == "swap") ? history_swap : history_copy);
+  }
+
   for (int i=0; i<field_descr_->field_count(); i++) {
 
     std::string field_name = field_descr_->field_name(i);
@@ -578,6 +650,7 @@ void Simulation::initialize_data_descr_() throw()
 
   // Set particle batch size
   particle_descr_->set_batch_size(config_->particle_batch_size);
+  particle_descr_->set_slab(config_->particle_slab);
 
   // Add particle types
 
@@ -901,20 +974,22 @@ void Simulation::monitor_performance()
   // 13+ max_node_blocks
   // 14+ max_node_particles
   // 15+ max_solver_iters
+  // 16+ max_region_time, max_region_time_neg (for min) per region
   
   const int num_solver = problem()->num_solvers();
 
-  int n = 14 + 2*num_solver + ( hierarchy_->max_level() - hierarchy_->min_level() + 1) + nr*nc;
+  int n = 14 + 2*num_solver + ( hierarchy_->max_level() - hierarchy_->min_level() + 1) + nr*nc + 2*nr;
 
   
   long long * counters_region = new long long [nc];
   long long * counters_reduce = new long long [n];
+  std::vector<long long> region_time (nr);
 
   const int in = cello::index_static();
 
   
   int m=0;
-  const int num_max = 4 + num_solver;
+  const int num_max = 4 + num_solver + 2*nr;
   counters_reduce[m++] = n - num_max - 2;
   counters_reduce[m++] = num_max;
   
@@ -946,6 +1021,7 @@ void Simulation::monitor_performance()
     for (int ic = 0; ic < nc; ic++) {
       counters_reduce[m++] = counters_region[ic];
     }
+    region_time[ir] = counters_region[perf_index_time];
   }
 
   // maximum metrics
@@ -957,6 +1033,11 @@ void Simulation::monitor_performance()
   for (int i=0; i<num_solver; i++) {
     counters_reduce[m++] = cello::simulation()->get_solver_max_iter(i); // 15 max_node_particles
   }
+  // region time maximum, and minimum as maximum of negative
+  for (int ir = 0; ir < nr; ir++) {
+    counters_reduce[m++] =   region_time[ir];  // 16
+    counters_reduce[m++] = - region_time[ir];  // 16
+  }
 
   ASSERT2("Simulation::monitor_performance()",
 	  "Actual array length %d != expected array length %d", m,n,
@@ -1051,7 +1132,9 @@ void Simulation::r_monitor_performance_reduce(CkReductionMsg * msg)
   const int num_regions  = performance_->num_regions();
   const int num_counters =  performance_->num_counters();
 
+  std::vector<long long> region_time (num_regions);
   for (int ir = 0; ir < num_regions; ir++) {
+    region_time[ir] = counters_reduce[m + perf_index_time];
     for (int ic = 0; ic < num_counters; ic++, m++) {
       bool do_print =
 	(ir != perf_unknown) && (
@@ -1080,6 +1163,21 @@ void Simulation::r_monitor_performance_reduce(CkReductionMsg * msg)
   }
   cello::simulation()->clear_solver_iter(); // clear it for the next solve
 
+  // per-region time balance across processes
+  for (int ir = 0; ir < num_regions; ir++) {
+    const long long time_max =   counters_reduce[m++]; // 16
+    const long long time_min = - counters_reduce[m++]; // 16
+    if (ir != perf_unknown && time_max > 0) {
+      const std::string region_name = performance_->region_name(ir);
+      monitor()->print("Performance","%s time-usec-min %lld",
+		       region_name.c_str(), time_min);
+      monitor()->print("Performance","%s time-usec-avg %lld",
+		       region_name.c_str(), region_time[ir] / CkNumPes());
+      monitor()->print("Performance","%s time-usec-max %lld",
+		       region_name.c_str(), time_max);
+    }
+  }
+
   
   monitor()->print
     ("Performance","simulation max-proc-blocks %lld",  max_proc_blocks);
@@ -175,6 +175,13 @@ public: // interface
   /// Write performance information to disk (all process data)
   void performance_write();
 
+  /// Return the Timeline object for recording Block phase events
+  Timeline * timeline() throw()
+  { return &timeline_; }
+
+  /// Write the Timeline events if scheduled for the given cycle
+  void timeline_update (int cycle, double time);
+
 #ifdef CONFIG_USE_PROJECTIONS  
   /// Set whether performance tracing with projections is enabled or not
   void set_projections_tracing (bool value)
@@ -280,6 +287,10 @@ public: // virtual functions
   /// proceed with next output
   void p_output_write (int n, char * buffer);
 
+  /// Receive data for one part of a multi-part Output, and write,
+  /// close, and proceed with next output when all parts are received
+  void p_output_write_part (int part, int n, char * buffer);
+
   //--------------------------------------------------
   // Compute
   //--------------------------------------------------
@@ -418,6 +429,10 @@ protected: // functions
   /// Initialize performance objects
   void initialize_performance_ () throw();
 
+  /// Initialize performance sub-regions for each Method, Solver,
+  /// Refine, and Refresh object (called after Problem is initialized)
+  void initialize_performance_groups_ () throw();
+
   /// Initialize output Monitor object
   void initialize_monitor_ () throw();
 
@@ -522,6 +537,12 @@ protected: // attributes
   /// Load balancing schedule
   Schedule * schedule_balance_;
 
+  /// Timeline of Block phase events
+  Timeline timeline_;
+
+  /// Schedule for writing Timeline events
+  Schedule * timeline_schedule_;
+
   /// Monitor object
   Monitor * monitor_;
 
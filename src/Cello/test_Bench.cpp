@@ -0,0 +1,103 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_Bench.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-19
+/// @brief    Implementation of the Bench class for microbenchmarks
+
+#include "test.hpp"
+
+//----------------------------------------------------------------------
+
+Bench Bench::instance_[CONFIG_NODE_SIZE];
+
+//----------------------------------------------------------------------
+
+Bench::Bench()
+  : program_(),
+    class_name_(),
+    min_time_(0.2),
+    num_trials_(5),
+    max_calls_(1 << 24),
+    results_()
+{
+}
+
+//----------------------------------------------------------------------
+
+void Bench::init (const char * program)
+{
+  program_ = program;
+  results_.clear();
+
+  const char * bench_time = getenv("CELLO_BENCH_TIME");
+  if (bench_time != NULL && atof(bench_time) > 0.0) {
+    min_time_ = atof(bench_time);
+  }
+
+  PARALLEL_PRINTF ("BENCH BEGIN %s\n",program_.c_str());
+  fflush(stdout);
+}
+
+//----------------------------------------------------------------------
+
+void Bench::finalize ()
+{
+  const char * bench_dir = getenv("CELLO_BENCH_DIR");
+  std::string file_name = std::string(bench_dir ? bench_dir : ".")
+    + "/" + program_ + ".json";
+
+  FILE * fp = fopen (file_name.c_str(),"w");
+
+  if (fp == NULL) {
+    WARNING1 ("Bench::finalize()",
+	      "Cannot open %s for writing",file_name.c_str());
+  } else {
+    fprintf (fp,"{\n");
+    fprintf (fp,"  \"program\": \"%s\",\n",program_.c_str());
+    fprintf (fp,"  \"results\": [\n");
+    for (size_t i=0; i<results_.size(); i++) {
+      const Result & r = results_[i];
+      const double ns_per_element =
+	(r.elements > 0) ? 1e9*r.seconds/r.elements : 0.0;
+      const double elements_per_second =
+	(r.seconds > 0.0) ? r.elements/r.seconds : 0.0;
+      const double bytes_per_second =
+	(r.seconds > 0.0) ? r.bytes/r.seconds : 0.0;
+      fprintf (fp,"    {\"name\": \"%s\", ",r.name.c_str());
+      fprintf (fp,"\"elements\": %lld, ",(long long)r.elements);
+      fprintf (fp,"\"bytes\": %lld, ",(long long)r.bytes);
+      fprintf (fp,"\"calls\": %d, ",r.calls);
+      fprintf (fp,"\"seconds\": %.6e, ",r.seconds);
+      fprintf (fp,"\"ns_per_element\": %.6e, ",ns_per_element);
+      fprintf (fp,"\"elements_per_second\": %.6e, ",elements_per_second);
+      fprintf (fp,"\"bytes_per_second\": %.6e}%s\n",bytes_per_second,
+	       (i+1 < results_.size()) ? "," : "");
+    }
+    fprintf (fp,"  ]\n");
+    fprintf (fp,"}\n");
+    fclose (fp);
+  }
+
+  PARALLEL_PRINTF ("BENCH END %s\n",program_.c_str());
+  fflush(stdout);
+}
+
+//----------------------------------------------------------------------
+
+void Bench::add_result_ (const char * name, int64_t num_elements,
+			 int64_t num_bytes, int num_calls, double seconds)
+{
+  Result result;
+  result.name = class_name_.empty() ? name : class_name_ + ":" + name;
+  result.elements = num_elements;
+  result.bytes    = num_bytes;
+  result.calls    = num_calls;
+  result.seconds  = seconds;
+  results_.push_back(result);
+
+  PARALLEL_PRINTF ("BENCH %-48s %12.4e s %10.3f ns/element\n",
+		   result.name.c_str(), seconds,
+		   (num_elements > 0) ? 1e9*seconds/num_elements : 0.0);
+  fflush(stdout);
+}
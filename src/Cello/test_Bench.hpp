@@ -0,0 +1,141 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_Bench.hpp
+/// @author   agent (agent@local)
+/// @date     2026-10-19
+/// @brief    [\ref Test] Declaration of the Bench class for microbenchmarks
+
+#ifndef TEST_BENCH_HPP
+#define TEST_BENCH_HPP
+
+/// @def   bench_init
+#define bench_init(PROGRAM)			\
+  Bench::instance()->init(PROGRAM)
+
+/// @def   bench_finalize
+#define bench_finalize()			\
+  Bench::instance()->finalize()
+
+/// @def   bench_class
+#define bench_class(CLASS_NAME)			\
+  Bench::instance()->set_class(CLASS_NAME)
+
+/// @def   bench_measure
+#define bench_measure(NAME,ELEMENTS,BYTES,FUNCTION)			\
+  Bench::instance()->measure(NAME,ELEMENTS,BYTES,FUNCTION)
+
+class Bench {
+
+  /// @class    Bench
+  /// @ingroup  Test
+  /// @brief    [\ref Test] Time kernels and write results as JSON
+  ///
+  /// @details Each measured kernel is called repeatedly until a
+  /// trial takes at least a fraction of the minimum time, and the
+  /// best time per call over several trials is kept.  Results are
+  /// written to "<program>.json" in the directory given by the
+  /// CELLO_BENCH_DIR environment variable (default "."); the minimum
+  /// time per kernel in seconds may be set using CELLO_BENCH_TIME.
+
+private:
+
+  /// Private constructor of the Bench object [singleton design pattern]
+  Bench();
+
+public:
+
+  /// Return an instance of a Bench object
+  static Bench * instance()
+  {
+    return & instance_[cello::index_static()];
+  };
+
+  /// Initialize benchmarking for the named program
+  void init (const char * program);
+
+  /// Write all results and finalize benchmarking
+  void finalize ();
+
+  /// Set the current class name, used as a prefix for kernel names
+  void set_class (const char * class_name)
+  { class_name_ = class_name; }
+
+  /// Time the kernel function, which processes the given number of
+  /// elements and bytes per call
+  template <class FUNCTION>
+  void measure (const char * name, int64_t num_elements,
+		int64_t num_bytes, FUNCTION function)
+  {
+    // warm up caches and allocations
+
+    function();
+
+    // double calls per trial until a trial is long enough
+
+    const double trial_time = min_time_ / num_trials_;
+
+    Timer timer;
+    int num_calls = 1;
+    while (true) {
+      timer.clear();
+      timer.start();
+      for (int k=0; k<num_calls; k++) function();
+      timer.stop();
+      if (timer.value() >= trial_time || num_calls >= max_calls_) break;
+      num_calls *= 2;
+    }
+
+    double seconds = timer.value() / num_calls;
+
+    for (int trial=1; trial<num_trials_; trial++) {
+      timer.clear();
+      timer.start();
+      for (int k=0; k<num_calls; k++) function();
+      timer.stop();
+      seconds = std::min(seconds, double(timer.value()) / num_calls);
+    }
+
+    add_result_(name,num_elements,num_bytes,num_calls,seconds);
+  }
+
+private: // functions
+
+  /// Save and print the result of a measurement
+  void add_result_ (const char * name, int64_t num_elements,
+		    int64_t num_bytes, int num_calls, double seconds);
+
+private: // attributes
+
+  /// Result of a single measured kernel
+  struct Result {
+    std::string name;
+    int64_t elements;
+    int64_t bytes;
+    int calls;
+    double seconds;
+  };
+
+  /// Singleton instance of the Bench object
+  static Bench instance_[CONFIG_NODE_SIZE];
+
+  /// Name of the benchmark program
+  std::string program_;
+
+  /// Name of the current class being measured
+  std::string class_name_;
+
+  /// Minimum total time per kernel in seconds
+  double min_time_;
+
+  /// Number of timed trials per kernel
+  int num_trials_;
+
+  /// Maximum number of calls per trial
+  int max_calls_;
+
+  /// Results of all measured kernels
+  std::vector<Result> results_;
+
+};
+
+#endif /* TEST_BENCH_HPP */
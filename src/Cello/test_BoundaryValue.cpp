@@ -0,0 +1,181 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_BoundaryValue.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-19
+/// @brief    Test program for the BoundaryValue class
+
+#include <fstream>
+
+#include "main.hpp"
+#include "test.hpp"
+
+#include "problem.hpp"
+
+//----------------------------------------------------------------------
+
+void generate_input()
+{
+  std::fstream fp;
+
+  fp.open ("test.in",std::fstream::out);
+
+  fp << "Group {\n";
+  fp << "  value = 2.0;\n";
+  fp << "  value_masked = [3.0, y > 0.5, 4.0];\n";
+  fp << "}\n";
+
+  fp.close();
+}
+
+//----------------------------------------------------------------------
+
+/// Enforce the boundary on all faces of the 2D Data, as
+/// Block::update_boundary_() does for a Block with no neighbors
+void enforce_faces (BoundaryValue & boundary, Data * data,
+		    Boundary::Cache * cache)
+{
+  boundary.enforce_data(data,0.0,cache,face_lower,axis_x);
+  boundary.enforce_data(data,0.0,cache,face_upper,axis_x);
+  boundary.enforce_data(data,0.0,cache,face_lower,axis_y);
+  boundary.enforce_data(data,0.0,cache,face_upper,axis_y);
+}
+
+//----------------------------------------------------------------------
+
+/// Return whether ghost values of the field are all vg and interior
+/// values are all vi
+bool check_values (Field field, int id, double vg, double vi)
+{
+  int mx,my,mz;
+  int gx,gy,gz;
+  field.dimensions (id,&mx,&my,&mz);
+  field.ghost_depth (id,&gx,&gy,&gz);
+  const double * values = (const double *) field.values(id);
+  bool ok = true;
+  for (int iy=0; iy<my; iy++) {
+    for (int ix=0; ix<mx; ix++) {
+      const bool is_ghost = (ix < gx || ix >= mx-gx || iy < gy || iy >= my-gy);
+      ok = ok && (values[ix + mx*iy] == (is_ghost ? vg : vi));
+    }
+  }
+  return ok;
+}
+
+//----------------------------------------------------------------------
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  Parameters parameters;
+
+  generate_input();
+  parameters.read("test.in");
+
+  unit_class("BoundaryValue");
+
+  //--------------------------------------------------
+
+  // 2D Data with one ghost zone
+
+  const int nx = 8;
+  const int ny = 6;
+
+  Data data(nx,ny,1, 1, 0.0,1.0, 0.0,1.0, 0.0,1.0);
+
+  Field field = data.field();
+  const int id_density  = field.insert_permanent("density");
+  const int id_pressure = field.insert_permanent("pressure");
+  field.set_precision(id_density, precision_double);
+  field.set_precision(id_pressure,precision_double);
+  field.set_ghost_depth(id_density, 1,1,0);
+  field.set_ghost_depth(id_pressure,1,1,0);
+  field.allocate_permanent(true);
+
+  int mx,my,mz;
+  field.dimensions (id_density,&mx,&my,&mz);
+  double * density = (double *) field.values(id_density);
+  for (int i=0; i<mx*my*mz; i++) density[i] = 1.0;
+
+  BoundaryValue boundary
+    (axis_all, face_all, new Value(&parameters,"Group:value"),
+     std::vector<std::string> (1,"density"));
+
+  //--------------------------------------------------
+
+  unit_func ("enforce_data()");
+
+  enforce_faces (boundary,&data,nullptr);
+
+  unit_assert (check_values(field,id_density,2.0,1.0));
+
+  //--------------------------------------------------
+
+  // Derived pressure computed before only ghost values of its input
+  // change is no longer current
+
+  unit_func ("enforce_data() derived");
+
+  FieldData * field_data = data.field_data();
+  const std::vector<int>    id_inputs (1,id_density);
+  const std::vector<double> params    (1,1.4);
+
+  field_data->set_derived_current (id_pressure,id_inputs,params);
+  unit_assert (field_data->derived_is_current(id_pressure,id_inputs,params));
+
+  for (int i=0; i<mx*my*mz; i++) density[i] = 1.0;
+  enforce_faces (boundary,&data,nullptr);
+
+  unit_assert (! field_data->derived_is_current(id_pressure,id_inputs,params));
+
+  // Also when ghost values are copied from the cache
+
+  Boundary::Cache cache;
+  enforce_faces (boundary,&data,&cache);
+  unit_assert (cache.size() == 4);
+
+  field_data->set_derived_current (id_pressure,id_inputs,params);
+  for (int i=0; i<mx*my*mz; i++) density[i] = 1.0;
+  enforce_faces (boundary,&data,&cache);
+
+  unit_assert (check_values(field,id_density,2.0,1.0));
+  unit_assert (! field_data->derived_is_current(id_pressure,id_inputs,params));
+
+  //--------------------------------------------------
+
+  // Masks depending on y are evaluated correctly on y face ghost
+  // zone slabs only one cell thick
+
+  unit_func ("enforce_data() mask");
+
+  BoundaryValue boundary_masked
+    (axis_all, face_all, new Value(&parameters,"Group:value_masked"),
+     std::vector<std::string> (1,"density"));
+
+  for (int i=0; i<mx*my*mz; i++) density[i] = 1.0;
+  enforce_faces (boundary_masked,&data,nullptr);
+
+  bool masked_ok = true;
+  for (int iy=0; iy<my; iy++) {
+    // cell center y coordinate, including ghost cells
+    const double y = (iy - 1 + 0.5) / ny;
+    for (int ix=0; ix<mx; ix++) {
+      const bool is_ghost = (ix == 0 || ix == mx-1 || iy == 0 || iy == my-1);
+      const double value = is_ghost ? ((y > 0.5) ? 3.0 : 4.0) : 1.0;
+      masked_ok = masked_ok && (density[ix + mx*iy] == value);
+    }
+  }
+  unit_assert (masked_ok);
+
+  //--------------------------------------------------
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
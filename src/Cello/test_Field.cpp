@@ -184,6 +184,32 @@ PARALLEL_MAIN_BEGIN
     unit_assert(field.permanent_allocated());
     unit_assert(field.permanent_size() == array_size_with_ghosts);
 
+    // Release
+
+    unit_func("release_permanent");
+
+    const std::vector<int> id_inputs = { i1 };
+    const std::vector<double> params = { 1.0 };
+    field_data->set_derived_current (i2,id_inputs,params);
+    unit_assert(field_data->derived_is_current (i2,id_inputs,params));
+    const int version_released = field_data->version(i1);
+
+    unit_assert(field.release_permanent() >= int64_t(array_size_with_ghosts));
+    unit_assert(field_data->version(i1) > version_released);
+    unit_assert( ! field_data->derived_is_current (i2,id_inputs,params));
+    unit_assert( ! field.permanent_allocated());
+    unit_assert(field.permanent_released());
+    unit_assert(field.release_permanent() == 0);
+
+    // Reallocated and cleared on access
+
+    unit_assert(field.values(i1) != 0);
+    unit_assert(field.permanent_allocated());
+    unit_assert( ! field.permanent_released());
+    unit_assert(field.permanent_size() == array_size_with_ghosts);
+    unit_assert(((float *)field.values(i1))[0] == 0.0);
+    unit_assert( ! field_data->derived_is_current (i2,id_inputs,params));
+
   
     //----------------------------------------------------------------------
     field.reallocate_permanent(false);
@@ -762,6 +788,62 @@ PARALLEL_MAIN_BEGIN
     unit_func ("history_time[3]");
     unit_assert (5.0-ih == field.history_time(ih));
     
+    //--------------------------------------------------
+    unit_func ("swap_history");
+
+    field.set_history_mode (i2,history_swap);
+    unit_assert (field.history_mode(i2) == history_swap);
+
+    // new values are written to the oldest history buffer
+
+    double * v2next = (double *) field.values_next(i2);
+    unit_assert (v2next == v2h3);
+    for (int i=0; i<M2; i++) {  v2next[i] = HIST_INIT(2,-1,i); }
+
+    field.swap_history(i2);
+
+    unit_assert ((double *) field.values(i2)   == v2next);
+    unit_assert ((double *) field.values(i2,1) == v2);
+    unit_assert ((double *) field.values(i2,2) == v2h1);
+    unit_assert ((double *) field.values(i2,3) == v2h2);
+    passed = true;
+    for (int i=0; i<M2; i++) {
+      passed &= (((double *)field.values(i2))  [i] == HIST_INIT(2,-1,i));
+      passed &= (((double *)field.values(i2,1))[i] == HIST_INIT(2,0,i));
+    }
+    unit_assert (passed);
+
+    // cycling through all buffers restores permanent storage
+
+    for (int k=0; k<3; k++) field.swap_history(i2);
+    unit_assert ((double *) field.values(i2) == v2);
+    unit_assert ((double *) field.values(i2,1) == v2h1);
+
+    field.set_history_mode (i2,history_copy);
+
+    //--------------------------------------------------
+    unit_func ("history_none");
+
+    field.set_history_mode (i3,history_none);
+    unit_assert (field.history_mode(i3) == history_none);
+
+    field.save_history(5.0);
+
+    // fields without history are not copied or cycled
+    unit_assert ((double *) field.values(i3,1) == v3h1);
+    passed = true;
+    for (int i=0; i<M3; i++) { passed &= (v3h1[i] == HIST_INIT(3,1,i));  }
+    unit_assert (passed);
+
+    // fields with history are
+    passed = true;
+    for (int i=0; i<M4; i++) {
+      passed &= (((double *)field.values(i4,1))[i] == HIST_INIT(4,0,i));
+    }
+    unit_assert (passed);
+
+    field.set_history_mode (i3,history_copy);
+
     //--------------------------------------------------
     unit_func ("units_scale_cgs");
 
@@ -0,0 +1,122 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_ImageEncoder.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-19
+/// @brief    Test program for the ImageEncoder class
+
+#include "main.hpp"
+#include "test.hpp"
+
+#include "io.hpp"
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class("ImageEncoder");
+
+  const int nx = 67;
+  const int ny = 45;
+
+  // Write the same image with one band and with several bands, and
+  // read both back using pngwriter
+
+  const int num_bands_list[2] = {1, 7};
+
+  for (int i_bands=0; i_bands<2; i_bands++) {
+
+    const int num_bands = num_bands_list[i_bands];
+
+    ImageEncoder encoder (nx,ny,16,num_bands);
+
+    unit_func("num_bands");
+    unit_assert (encoder.num_bands() == num_bands);
+
+    unit_func("band_rows");
+    int iy_last = 0;
+    bool rows_ok = true;
+    for (int band=0; band<num_bands; band++) {
+      int iy_begin, iy_end;
+      encoder.band_rows(band,&iy_begin,&iy_end);
+      if (iy_begin != iy_last || iy_end <= iy_begin) rows_ok = false;
+      iy_last = iy_end;
+    }
+    unit_assert (rows_ok && iy_last == ny);
+
+    for (int iy=0; iy<ny; iy++) {
+      for (int ix=0; ix<nx; ix++) {
+	encoder.set_pixel (ix,iy, 1.0*ix/(nx-1), 1.0*iy/(ny-1),
+			   ((ix+iy) % 2) ? 1.0 : 0.0);
+      }
+    }
+
+    // encode bands in reverse order: bands are independent
+
+    for (int band=num_bands-1; band>=0; band--) {
+      encoder.encode_band(band);
+    }
+
+    char file_name[80];
+    snprintf (file_name,80,"test_ImageEncoder-%d.png",num_bands);
+
+    unit_func("write_png");
+    encoder.write_png(file_name);
+
+    pngwriter png;
+    png.readfromfile(file_name);
+
+    unit_assert (png.getwidth()  == nx);
+    unit_assert (png.getheight() == ny);
+
+    // pngwriter rows are numbered from 1 at the bottom
+
+    bool pixels_ok = true;
+    for (int iy=0; iy<ny; iy++) {
+      for (int ix=0; ix<nx; ix++) {
+	const int r = png.read(ix+1,ny-iy,1);
+	const int g = png.read(ix+1,ny-iy,2);
+	const int b = png.read(ix+1,ny-iy,3);
+	if (r != int(65535*(1.0*ix/(nx-1))) ||
+	    g != int(65535*(1.0*iy/(ny-1))) ||
+	    b != (((ix+iy) % 2) ? 65535 : 0)) pixels_ok = false;
+      }
+    }
+    unit_assert (pixels_ok);
+  }
+
+  //--------------------------------------------------
+  // Raw image
+
+  unit_func("write_raw");
+
+  std::vector<float> values (nx*ny);
+  for (int i=0; i<nx*ny; i++) values[i] = 0.5*i;
+
+  ImageEncoder::write_raw ("test_ImageEncoder.raw",
+			   nx,ny,1,sizeof(float),true,values.data());
+
+  FILE * fp = fopen ("test_ImageEncoder.raw","rb");
+  char magic[8];
+  int32_t header[6];
+  std::vector<float> values_read (nx*ny);
+  size_t n_magic  = fread (magic,1,8,fp);
+  size_t n_header = fread (header,sizeof(int32_t),6,fp);
+  size_t n_values = fread (values_read.data(),sizeof(float),nx*ny,fp);
+  fclose (fp);
+
+  unit_assert (n_magic == 8 && strncmp(magic,"CELLORAW",8) == 0);
+  unit_assert (n_header == 6);
+  unit_assert (header[1] == nx && header[2] == ny && header[3] == 1);
+  unit_assert (header[4] == sizeof(float) && header[5] == 1);
+  unit_assert (n_values == size_t(nx*ny) && values_read == values);
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
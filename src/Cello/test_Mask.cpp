@@ -21,6 +21,9 @@ void generate_input()
   fp << "Group {\n";
   fp << "  value_png  = [1.0,\"input/Cello.png\"];\n";
   fp << "  value_x_lt_y = [2.0,x + 0.5*t < 2.0*y - z];\n";
+  fp << "  value_x_mixed = [3.0,x < 0.5*y];\n";
+  fp << "  value_x_inside = [3.0,x < 2.0];\n";
+  fp << "  value_x_outside = [3.0,x > 2.0];\n";
   fp << "}\n";
 
   fp.close();
@@ -96,6 +99,95 @@ PARALLEL_MAIN_BEGIN
     }
   }
 
+  //--------------------------------------------------
+
+  unit_func ("region()");
+
+  // time-dependent expressions are not classified
+
+  unit_assert (mask->region(t,nx,x,ny,y,nz,z) == mask_region_mixed);
+
+  std::shared_ptr<Mask> mask_mixed = std::make_shared<MaskExpr>
+    (parameters.param("Group:value_x_mixed",1));
+  std::shared_ptr<Mask> mask_inside = std::make_shared<MaskExpr>
+    (parameters.param("Group:value_x_inside",1));
+  std::shared_ptr<Mask> mask_outside = std::make_shared<MaskExpr>
+    (parameters.param("Group:value_x_outside",1));
+
+  unit_assert (mask_mixed->region(t,nx,x,ny,y,nz,z)  == mask_region_mixed);
+  unit_assert (mask_inside->region(t,nx,x,ny,y,nz,z) == mask_region_inside);
+  unit_assert (mask_outside->region(t,nx,x,ny,y,nz,z) == mask_region_outside);
+
+  // cached values agree with the expression
+
+  unit_func ("evaluate(mask,nx,ny,nz)");
+
+  mask_mixed->evaluate(bitmask,t,nx,nx,x,ny,ny,y,nz,nz,z);
+  bool cached_ok = true;
+  for (int iz=0; iz<nz; iz++) {
+    for (int iy=0; iy<ny; iy++) {
+      for (int ix=0; ix<nx; ix++) {
+	int i=ix+nx*(iy+ny*iz);
+	if (bitmask[i] != (x[ix] < 0.5*y[iy])) cached_ok = false;
+      }
+    }
+  }
+  unit_assert (cached_ok);
+
+  //--------------------------------------------------
+
+  unit_class("MaskBitmap");
+
+  // disk of radius 10 centered at (20,12) in a 37 x 29 bitmap
+
+  const int mx = 37;
+  const int my = 29;
+  MaskBitmap bitmap (mx,my);
+  for (int iy=0; iy<my; iy++) {
+    for (int ix=0; ix<mx; ix++) {
+      bitmap.set(ix,iy,(ix-20)*(ix-20) + (iy-12)*(iy-12) < 100);
+    }
+  }
+  bitmap.build();
+
+  unit_func ("num_levels()");
+  unit_assert (bitmap.num_levels() == 7);
+
+  unit_func ("value()");
+  unit_assert (bitmap.value(20,12));
+  unit_assert (! bitmap.value(0,0));
+  unit_assert (! bitmap.value(-1,12));
+
+  unit_func ("region()");
+
+  // compare against direct evaluation over all rectangles with
+  // corners on a coarse grid, including some outside the bitmap
+
+  bool region_ok = true;
+  for (int ix0=-3; ix0<mx+3; ix0+=5) {
+    for (int ix1=ix0; ix1<mx+3; ix1+=4) {
+      for (int iy0=-3; iy0<my+3; iy0+=5) {
+	for (int iy1=iy0; iy1<my+3; iy1+=4) {
+	  bool some_set = false, some_clear = false;
+	  for (int iy=iy0; iy<=iy1; iy++) {
+	    for (int ix=ix0; ix<=ix1; ix++) {
+	      if (bitmap.value(ix,iy)) some_set = true;
+	      else                     some_clear = true;
+	    }
+	  }
+	  mask_region_type region = (some_set && some_clear) ?
+	    mask_region_mixed :
+	    (some_set ? mask_region_inside : mask_region_outside);
+	  if (bitmap.region(ix0,ix1,iy0,iy1) != region) region_ok = false;
+	}
+      }
+    }
+  }
+  unit_assert (region_ok);
+  unit_assert (bitmap.region(18,22,10,14) == mask_region_inside);
+  unit_assert (bitmap.region(0,5,0,5)     == mask_region_outside);
+  unit_assert (bitmap.region(0,36,0,28)   == mask_region_mixed);
+
   exit_();
 }
 
@@ -0,0 +1,154 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_MethodTrace.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-19
+/// @brief    Test program for MethodTrace particle advection kernels
+
+#include "main.hpp"
+#include "test.hpp"
+
+#include "problem.hpp"
+
+//----------------------------------------------------------------------
+
+/// 2D Block [0,1]^2 with 8 x 8 cells and 2 ghost zones
+const int    m3[3]  = { 12, 12, 1 };
+const int    g3[3]  = { 2, 2, 0 };
+const double xm3[3] = { 0.0, 0.0, 0.0 };
+const double h3[3]  = { 0.125, 0.125, 1.0 };
+
+/// Initialize the rotating velocity field (-(y-0.5), x-0.5), which is
+/// interpolated exactly inside the field arrays
+template <class T>
+void init_velocity (T * vx, T * vy)
+{
+  for (int iy=0; iy<m3[1]; iy++) {
+    const double y = xm3[1] + (iy - g3[1] + 0.5)*h3[1];
+    for (int ix=0; ix<m3[0]; ix++) {
+      const double x = xm3[0] + (ix - g3[0] + 0.5)*h3[0];
+      vx[ix + m3[0]*iy] = -(y - 0.5);
+      vy[ix + m3[0]*iy] =  (x - 0.5);
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+/// Advance np particles on a circle about the center of rotation with
+/// positions of type P interleaved with stride 2, and return the
+/// maximum error relative to one Euler or midpoint Runge-Kutta step
+template <class T, class P>
+double trace_error (int order, double dt, int np)
+{
+  std::vector<T> vx (m3[0]*m3[1]), vy (m3[0]*m3[1]);
+  init_velocity (vx.data(),vy.data());
+
+  const int dp = 2;
+  std::vector<P> x (dp*np,-1.0), y (dp*np,-1.0), z (dp*np,-1.0);
+  for (int ip=0; ip<np; ip++) {
+    const double a = 2.0*cello::pi*ip/np;
+    x[ip*dp] = 0.5 + 0.25*cos(a);
+    y[ip*dp] = 0.5 + 0.25*sin(a);
+  }
+  std::vector<P> x0 (x), y0 (y);
+
+  MethodTrace::advance_positions<T,P>
+    (2,order,dt,m3,g3,xm3,h3,vx.data(),vy.data(),NULL,
+     x.data(),y.data(),z.data(),dp,np);
+
+  // For velocity A*r, Euler gives r + dt*A*r, and the midpoint
+  // method adds dt^2/2 * A*A*r = - dt^2/2 * r
+
+  const double c = (order == 2) ? 1.0 - 0.5*dt*dt : 1.0;
+
+  double error = 0.0;
+  for (int ip=0; ip<np; ip++) {
+    const double rx = x0[ip*dp] - 0.5;
+    const double ry = y0[ip*dp] - 0.5;
+    const double xe = 0.5 + c*rx - dt*ry;
+    const double ye = 0.5 + c*ry + dt*rx;
+    error = std::max(error,std::abs(x[ip*dp] - xe));
+    error = std::max(error,std::abs(y[ip*dp] - ye));
+    // interleaved values are not changed
+    error = std::max(error,std::abs(x[ip*dp+1] + 1.0));
+    error = std::max(error,std::abs(y[ip*dp+1] + 1.0));
+  }
+  return error;
+}
+
+//----------------------------------------------------------------------
+
+/// Return the y velocity used to advance a particle at (x,0.5)
+template <class T, class P>
+double trace_velocity_y (double x)
+{
+  std::vector<T> vx (m3[0]*m3[1]), vy (m3[0]*m3[1]);
+  init_velocity (vx.data(),vy.data());
+
+  const double dt = 0.5;
+  P xp = x;
+  P yp = 0.5;
+  MethodTrace::advance_positions<T,P>
+    (2,1,dt,m3,g3,xm3,h3,vx.data(),vy.data(),NULL,&xp,&yp,NULL,1,1);
+  return (yp - 0.5) / dt;
+}
+
+//----------------------------------------------------------------------
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class ("MethodTrace");
+
+  //--------------------------------------------------
+
+  unit_func ("advance_positions()");
+
+  // more than one chunk of particles
+
+  const int np = 100;
+  const double dt = 0.1;
+
+  // Euler and midpoint steps differ by dt^2/2 * 0.25 ~ 1e-3
+
+  double e1 = trace_error<double,double> (1,dt,np);
+  double e2 = trace_error<double,double> (2,dt,np);
+  double e2_float_field = trace_error<float,double> (2,dt,np);
+  unit_assert (e1 < 1e-12);
+  unit_assert (e2 < 1e-12);
+  unit_assert (e2_float_field < 1e-6);
+
+  // single precision positions
+
+  double e1_float = trace_error<double,float> (1,dt,np);
+  double e2_float = trace_error<double,float> (2,dt,np);
+  double e2_float_all = trace_error<float,float> (2,dt,np);
+  unit_assert (e1_float < 1e-6);
+  unit_assert (e2_float < 1e-6);
+  unit_assert (e2_float_all < 1e-6);
+
+  //--------------------------------------------------
+
+  // positions outside the field arrays use the velocity of the
+  // nearest cell (x = -0.1875 and 1.1875) instead of extrapolating
+
+  double vy_lower = trace_velocity_y<double,double> (-1.0);
+  double vy_upper = trace_velocity_y<double,double> ( 2.0);
+  double vy_upper_float = trace_velocity_y<double,float> (2.0);
+  unit_assert (std::abs(vy_lower + 0.6875) < 1e-12);
+  unit_assert (std::abs(vy_upper - 0.6875) < 1e-12);
+  unit_assert (std::abs(vy_upper_float - 0.6875) < 1e-6);
+
+  //--------------------------------------------------
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
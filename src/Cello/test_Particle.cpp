@@ -1055,6 +1055,120 @@ PARALLEL_MAIN_BEGIN
   delete [] buffer;
   // printf ("error_gather_int %d\n",error_gather_int);
 
+  //--------------------------------------------------
+  //   Slab storage
+  //--------------------------------------------------
+
+  {
+    unit_class("ParticleData");
+
+    ParticleDescr slab_descr;
+    slab_descr.set_batch_size (16);
+    slab_descr.set_slab (true);
+
+    ParticleData slab_data;
+    Particle slab (&slab_descr,&slab_data);
+
+    const int it_s = slab.new_type ("slab");
+    const int ia_s_x = slab.new_attribute (it_s,"x",type_double);
+    const int ia_s_id = slab.new_attribute (it_s,"id",type_int64);
+    const int it_i = slab.new_type ("slab_interleaved");
+    slab.set_interleaved (it_i,true);
+    const int ia_i_x = slab.new_attribute (it_i,"x",type_double);
+    const int ia_i_id = slab.new_attribute (it_i,"id",type_int64);
+
+    unit_func ("is_slab()");
+    unit_assert (slab.is_slab());
+
+    // insert 100 particles of each type in uneven chunks, forcing the
+    // slab to grow several times
+
+    const int np_slab = 100;
+    const int it_list[2] = {it_s, it_i};
+    const int ia_x_list[2] = {ia_s_x, ia_i_x};
+    const int ia_id_list[2] = {ia_s_id, ia_i_id};
+
+    for (int k=0; k<2; k++) {
+      const int it = it_list[k];
+      for (int np=0; np<np_slab; ) {
+	const int n = std::min (np_slab-np, 7 + 5*(np % 3));
+	slab.insert_particles (it,n);
+	np += n;
+      }
+      unit_func ("insert_particles()");
+      unit_assert (slab.num_particles(it) == np_slab);
+      unit_assert (slab.num_batches(it) == (np_slab+15)/16);
+
+      const int dx = slab.stride(it,ia_x_list[k]);
+      const int di = slab.stride(it,ia_id_list[k]);
+      int64_t id = 0;
+      for (int ib=0; ib<slab.num_batches(it); ib++) {
+	double  * x = (double *)  slab.attribute_array(it,ia_x_list[k],ib);
+	int64_t * i = (int64_t *) slab.attribute_array(it,ia_id_list[k],ib);
+	for (int ip=0; ip<slab.num_particles(it,ib); ip++,id++) {
+	  x[ip*dx] = 0.5*id;
+	  i[ip*di] = id;
+	}
+      }
+
+      // delete every third particle
+
+      for (int ib=0; ib<slab.num_batches(it); ib++) {
+	const int np = slab.num_particles(it,ib);
+	int64_t * i = (int64_t *) slab.attribute_array(it,ia_id_list[k],ib);
+	bool mask[16];
+	for (int ip=0; ip<np; ip++) mask[ip] = (i[ip*di] % 3 == 0);
+	slab.delete_particles (it,ib,mask);
+      }
+
+      // whole-type array is contiguous, compressed, and in order
+
+      unit_func ("num_arrays()");
+      unit_assert (slab.num_arrays(it) == 1);
+      const int np_kept = np_slab - (np_slab+2)/3;
+      unit_func ("array_size()");
+      unit_assert (slab.array_size(it,0) == np_kept);
+      unit_func ("attribute_array()");
+      double  * x = (double *)  slab.attribute_array(it,ia_x_list[k]);
+      int64_t * i = (int64_t *) slab.attribute_array(it,ia_id_list[k]);
+      bool error_order = false;
+      int64_t id_expect = 1;
+      for (int ip=0; ip<np_kept; ip++) {
+	if (i[ip*di] != id_expect || x[ip*dx] != 0.5*id_expect)
+	  error_order = true;
+	id_expect += (id_expect % 3 == 1) ? 1 : 2;
+      }
+      unit_assert (! error_order);
+      unit_assert (x == (double *) slab.attribute_array(it,ia_x_list[k],0));
+    }
+
+    // serialize and restore
+
+    unit_func ("save_data()");
+    const int n_slab = slab.data_size();
+    char * slab_buffer = new char[n_slab];
+    unit_assert (slab.save_data(slab_buffer) - slab_buffer == n_slab);
+
+    unit_func ("load_data()");
+    ParticleData slab_data_new;
+    Particle slab_new (&slab_descr,&slab_data_new);
+    unit_assert (slab_new.load_data(slab_buffer) - slab_buffer == n_slab);
+    bool error_load = false;
+    for (int k=0; k<2; k++) {
+      const int it = it_list[k];
+      const int np = slab.num_particles(it);
+      const int di = slab.stride(it,ia_id_list[k]);
+      int64_t * i = (int64_t *) slab.attribute_array(it,ia_id_list[k]);
+      int64_t * i_new = (int64_t *) slab_new.attribute_array(it,ia_id_list[k]);
+      if (slab_new.num_particles(it) != np) error_load = true;
+      for (int ip=0; ip<np && !error_load; ip++)
+	if (i_new[ip*di] != i[ip*di]) error_load = true;
+    }
+    unit_assert (! error_load);
+
+    delete [] slab_buffer;
+  }
+
   //--------------------------------------------------
   //   Grouping
   //--------------------------------------------------
@@ -0,0 +1,195 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_ProlongRestrict.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-18
+/// @brief    Test ProlongLinear and RestrictLinear kernels
+///
+/// Compares the rank-specialized ProlongLinear and RestrictLinear
+/// kernels against straightforward reference implementations for
+/// float and double fields, ranks 1 to 3, with and without
+/// accumulate.
+
+#include "main.hpp"
+#include "test.hpp"
+#include <math.h>
+#include "mesh.hpp"
+
+//----------------------------------------------------------------------
+// Reference implementations
+//----------------------------------------------------------------------
+
+/// Reference linear prolongation: per-element weights on all axes
+template <class T>
+void prolong_reference
+(       T * values_f, int mf3[3], int of3[3], int nf3[3],
+	const T * values_c, int mc3[3], int oc3[3], int nc3[3],
+	bool accumulate)
+{
+  const int rank = (mf3[1] == 1) ? 1 : ( (mf3[2] == 1) ? 2 : 3 );
+  int g3[3];
+  for (int i=0; i<3; i++) g3[i] = (nf3[i]==2*nc3[i]) ? 1 : 0;
+  const int d3[3] = { 1, mc3[0], mc3[0]*mc3[1] };
+
+  int n3[3] = { nf3[0], (rank >= 2) ? nf3[1] : 1, (rank >= 3) ? nf3[2] : 1 };
+
+  for (int ifz=0; ifz<n3[2]; ifz++) {
+    for (int ify=0; ify<n3[1]; ify++) {
+      for (int ifx=0; ifx<n3[0]; ifx++) {
+	const int if3[3] = {ifx,ify,ifz};
+	int ic3[3] = {0,0,0};
+	double w3[3][2] = { {1.0,0.0}, {1.0,0.0}, {1.0,0.0} };
+	for (int a=0; a<rank; a++) {
+	  const int i_f = if3[a];
+	  const int n_f = n3[a];
+	  const int g_c = g3[a];
+	  int w[2] = { 1, 3 };
+	  ic3[a] = ((i_f+1) >> 1) - g_c;
+	  if (i_f==0)     ic3[a] += g_c;
+	  if (i_f==n_f-1) ic3[a] -= g_c;
+	  if (i_f==0 || i_f==n_f-1) { w[0] += 4*g_c; w[1] -= 4*g_c; }
+	  w3[a][0] = 0.25*w[ i_f&1];
+	  w3[a][1] = 0.25*w[~i_f&1];
+	}
+	const int i_c = (oc3[0]+ic3[0])
+	  + mc3[0]*((rank >= 2 ? oc3[1]+ic3[1] : 0)
+		    + mc3[1]*(rank >= 3 ? oc3[2]+ic3[2] : 0));
+	const int i_f = (of3[0]+ifx)
+	  + mf3[0]*((rank >= 2 ? of3[1]+ify : 0)
+		    + mf3[1]*(rank >= 3 ? of3[2]+ifz : 0));
+	T value = 0.0;
+	for (int kz=0; kz<(rank >= 3 ? 2 : 1); kz++) {
+	  for (int ky=0; ky<(rank >= 2 ? 2 : 1); ky++) {
+	    for (int kx=0; kx<2; kx++) {
+	      const T w = w3[0][kx]*w3[1][ky]*w3[2][kz];
+	      value += w*values_c[i_c + kx*d3[0] + ky*d3[1] + kz*d3[2]];
+	    }
+	  }
+	}
+	if (accumulate) values_f[i_f] += value;
+	else            values_f[i_f]  = value;
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+/// Reference linear restriction: average of fine children
+template <class T>
+void restrict_reference
+( T *       values_c, int mc3[3], int oc3[3], int nc3[3],
+  const T * values_f, int mf3[3], int of3[3],
+  bool accumulate)
+{
+  const int rank = (mf3[1] == 1) ? 1 : ( (mf3[2] == 1) ? 2 : 3 );
+  const int n3[3] = { nc3[0], (rank >= 2) ? nc3[1] : 1, (rank >= 3) ? nc3[2] : 1 };
+  const double scale = 1.0 / (1 << rank);
+  for (int iz=0; iz<n3[2]; iz++) {
+    for (int iy=0; iy<n3[1]; iy++) {
+      for (int ix=0; ix<n3[0]; ix++) {
+	const int i_c = (oc3[0]+ix)
+	  + mc3[0]*((rank >= 2 ? oc3[1]+iy : 0)
+		    + mc3[1]*(rank >= 3 ? oc3[2]+iz : 0));
+	T value = 0.0;
+	for (int kz=0; kz<(rank >= 3 ? 2 : 1); kz++) {
+	  for (int ky=0; ky<(rank >= 2 ? 2 : 1); ky++) {
+	    for (int kx=0; kx<2; kx++) {
+	      const int i_f = (of3[0]+2*ix+kx)
+		+ mf3[0]*((rank >= 2 ? of3[1]+2*iy+ky : 0)
+			  + mf3[1]*(rank >= 3 ? of3[2]+2*iz+kz : 0));
+	      value += values_f[i_f];
+	    }
+	  }
+	}
+	if (accumulate) values_c[i_c] += scale*value;
+	else            values_c[i_c]  = scale*value;
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+/// Compare kernels with reference implementation for given precision,
+/// rank, ghost availability, and accumulate
+template <class T>
+void test_kernels (int rank, int g, bool accumulate)
+{
+  const precision_type precision =
+    (sizeof(T) == sizeof(float)) ? precision_single : precision_double;
+  const double tolerance = (sizeof(T) == sizeof(float)) ? 1e-5 : 1e-13;
+
+  int mf3[3]={1,1,1}, of3[3]={0,0,0}, nf3[3]={1,1,1};
+  int mc3[3]={1,1,1}, oc3[3]={0,0,0}, nc3[3]={1,1,1};
+  int nr3[3]={1,1,1};
+  for (int a=0; a<rank; a++) {
+    nf3[a] = 32;  mf3[a] = nf3[a] + 8; of3[a] = 4;
+    nc3[a] = g ? 16 : 18;  mc3[a] = nc3[a] + 4; oc3[a] = 2;
+    nr3[a] = nf3[a] / 2;
+  }
+  const int mf = mf3[0]*mf3[1]*mf3[2];
+  const int mc = mc3[0]*mc3[1]*mc3[2];
+
+  std::vector<T> c(mc), c1(mc), c2(mc), f1(mf), f2(mf);
+  for (int i=0; i<mc; i++) c[i] = c1[i] = c2[i] = 1.0 + (i % 17)*0.125 + sin(i);
+  for (int i=0; i<mf; i++) f1[i] = f2[i] = 1.0 + (i % 13)*0.25 + cos(i);
+
+  ProlongLinear prolong;
+  RestrictLinear restrict;
+
+  // prolong
+
+  prolong.apply (precision,&f1[0],mf3,of3,nf3,&c[0],mc3,oc3,nc3,accumulate);
+  prolong_reference (&f2[0],mf3,of3,nf3,&c[0],mc3,oc3,nc3,accumulate);
+
+  double err_prolong = 0.0;
+  for (int i=0; i<mf; i++) {
+    err_prolong = std::max(err_prolong,fabs(double(f1[i]-f2[i])));
+  }
+
+  // restrict
+
+  restrict.apply (precision,&c1[0],mc3,oc3,nr3,&f1[0],mf3,of3,nf3,accumulate);
+  restrict_reference (&c2[0],mc3,oc3,nr3,&f1[0],mf3,of3,accumulate);
+
+  double err_restrict = 0.0;
+  for (int i=0; i<mc; i++) {
+    err_restrict = std::max(err_restrict,fabs(double(c1[i]-c2[i])));
+  }
+
+  char buffer[80];
+  snprintf (buffer,80,"%s rank %d ghosts %d accumulate %d",
+	    (precision == precision_single) ? "float" : "double",
+	    rank, g, accumulate ? 1 : 0);
+
+  unit_func (buffer);
+  unit_assert (err_prolong < tolerance && err_restrict < tolerance);
+}
+
+//----------------------------------------------------------------------
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class("ProlongLinear");
+
+  for (int rank=1; rank<=3; rank++) {
+    for (int g=0; g<2; g++) {
+      for (int accumulate=0; accumulate<2; accumulate++) {
+	test_kernels<float>  (rank,g,accumulate);
+	test_kernels<double> (rank,g,accumulate);
+      }
+    }
+  }
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
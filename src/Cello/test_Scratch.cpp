@@ -0,0 +1,87 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file      test_Scratch.cpp
+/// @author    agent (agent@local)
+/// @date      2026-10-19
+/// @brief     Program implementing unit tests for the Scratch class
+ 
+#include "main.hpp" 
+#include "test.hpp"
+
+#include "memory.hpp"
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class("Scratch");
+
+  Scratch * scratch = Scratch::instance();
+
+  unit_func("instance");
+  unit_assert (scratch != NULL);
+  unit_assert (scratch->num_slots() == 0);
+  unit_assert (scratch->bytes() == 0);
+
+  //----------------------------------------------------------------------
+
+  unit_func("array");
+
+  double * a0 = scratch->array<double>(0,1000,true);
+  int    * a1 = scratch->array<int>   (1,100);
+
+  unit_assert (scratch->num_slots() == 2);
+  unit_assert (scratch->bytes() >= int64_t(1000*sizeof(double) +
+					   100*sizeof(int)));
+
+  // aligned
+
+  unit_assert ((reinterpret_cast<uintptr_t>(a0) % 64) == 0);
+  unit_assert ((reinterpret_cast<uintptr_t>(a1) % 64) == 0);
+
+  // cleared
+
+  bool is_clear = true;
+  for (int i=0; i<1000; i++) is_clear = is_clear && (a0[i] == 0.0);
+  unit_assert (is_clear);
+
+  // reused if not larger
+
+  for (int i=0; i<1000; i++) a0[i] = i;
+  const int64_t bytes = scratch->bytes();
+
+  unit_assert (scratch->array<double>(0,500) == a0);
+  unit_assert (scratch->array<double>(0,1000) == a0);
+  unit_assert (scratch->bytes() == bytes);
+  unit_assert (a0[999] == 999.0);
+
+  // other slots unchanged when a slot grows
+
+  scratch->array<double>(2,100);
+  unit_assert (scratch->array<int>(1,100) == a1);
+
+  // grows if larger
+
+  double * a0_large = scratch->array<double>(0,10000);
+  unit_assert (scratch->bytes() >= bytes + int64_t(9000*sizeof(double)));
+  unit_assert ((reinterpret_cast<uintptr_t>(a0_large) % 64) == 0);
+
+  //----------------------------------------------------------------------
+
+  unit_func("deallocate");
+
+  scratch->deallocate();
+
+  unit_assert (scratch->num_slots() == 0);
+  unit_assert (scratch->bytes() == 0);
+
+  unit_finalize();
+
+  exit_();
+
+}
+
+PARALLEL_MAIN_END
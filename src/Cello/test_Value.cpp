@@ -32,6 +32,9 @@
 #define MASK3_STR1  "\"input/testValue.png\""
 #define EXPR3_VAL2  (1.0 - t - 10.0*x - 100.0*y - 1000.0*z)
 #define EXPR3_STR2 "(1.0 - t - 10.0*x - 100.0*y - 1000.0*z)"
+
+#define EXPR4_STR "(1.0*x + 2.0*y - 5.0*z)"
+#define MASK4_STR "(x > 0.0)"
 //----------------------------------------------------------------------
 
 void generate_input()
@@ -49,6 +52,8 @@ void generate_input()
   fp << "    value1 = [" EXPR1_STR "];  \n";
   fp << "    value2 = [" EXPR2_STR1 ",\n" MASK2_STR1 ",\n" EXPR2_STR2 ",\n" MASK2_STR2 ",\n" EXPR2_STR3 "];\n";
   fp << "    value3 = [" EXPR3_STR1 ",\n" MASK3_STR1 ",\n" EXPR3_STR2 "];\n";
+  fp << "    value4 = [" EXPR4_STR "];\n";
+  fp << "    value5 = [" EXPR4_STR ",\n" MASK4_STR "];\n";
   fp << "}\n";
 
   fp.close();
@@ -190,6 +195,26 @@ PARALLEL_MAIN_BEGIN
 
   //----------------------------------------------------------------------
 
+  unit_func ("is_time_dependent()");
+
+  Value * value4 = new Value(&parameters, "Group:value4");
+  Value * value5 = new Value(&parameters, "Group:value5");
+
+  unit_assert (value1->is_time_dependent());
+  unit_assert (value2->is_time_dependent());
+  unit_assert (value3->is_time_dependent());
+  unit_assert (! value4->is_time_dependent());
+  unit_assert (! value5->is_time_dependent());
+
+  unit_func ("has_default()");
+
+  unit_assert (value1->has_default());
+  unit_assert (value2->has_default());
+  unit_assert (value4->has_default());
+  unit_assert (! value5->has_default());
+
+  //----------------------------------------------------------------------
+
   unit_finalize();
 
   exit_();
@@ -11,6 +11,10 @@
 //----------------------------------------------------------------------
 
 #define OMEGA_TOLERANCE 1.0e-5
+
+/// Reduction in the single-precision residual of a mixed-precision
+/// Krylov solve before recomputing the residual in double precision
+#define MIXED_PRECISION_TOLERANCE 1.0e-4
  
 #ifdef CONFIG_PRECISION_SINGLE
 #   define ETA_TOLERANCE 1.0e-5
@@ -101,6 +105,24 @@ enum enzo_sync_id {
   
 //----------------------------------------------------------------------
 
+/// Slots for reusable work arrays in Scratch
+enum enzo_scratch_slot {
+  enzo_scratch_ppm_temp,
+  enzo_scratch_ppm_index,
+  enzo_scratch_ppm_color_offset,
+  enzo_scratch_ppm_velocity_y,
+  enzo_scratch_ppm_velocity_z,
+  enzo_scratch_ppm_cell_width,
+  enzo_scratch_ppm_ie_error,
+  enzo_scratch_ppm_sweep,
+  enzo_scratch_hydro_slice,
+  enzo_scratch_hydro_fluxes,
+  enzo_scratch_hydro_flatten,
+  enzo_scratch_grackle_cooling_time
+};
+
+//----------------------------------------------------------------------
+
 // #include "macros_and_parameters.h"
 #include "enzo_defines.hpp"
 #include "enzo_typedefs.hpp"
@@ -193,6 +215,7 @@ extern "C" {
 #include "enzo_EnzoMethodCheckGravity.hpp"
 #include "enzo_EnzoMethodComovingExpansion.hpp"
 #include "enzo_EnzoMethodCosmology.hpp"
+#include "enzo_EnzoMethodFof.hpp"
 #include "enzo_EnzoMethodGrackle.hpp"
 #include "enzo_EnzoMethodGravity.hpp"
 #include "enzo_EnzoMethodHeat.hpp"
@@ -201,6 +224,7 @@ extern "C" {
 #include "enzo_EnzoMethodPmUpdate.hpp"
 #include "enzo_EnzoMethodPpm.hpp"
 #include "enzo_EnzoMethodPpml.hpp"
+#include "enzo_EnzoMethodProfile.hpp"
 #include "enzo_EnzoMethodTurbulence.hpp"
 
 #include "enzo_EnzoMatrixDiagonal.hpp"
@@ -219,6 +243,7 @@ extern "C" {
 #include "enzo_EnzoSolverCg.hpp"
 #include "enzo_EnzoSolverDd.hpp"
 #include "enzo_EnzoSolverDiagonal.hpp"
+#include "enzo_EnzoSolverFft.hpp"
 #include "enzo_EnzoSolverJacobi.hpp"
 #include "enzo_EnzoSolverMg0.hpp"
 
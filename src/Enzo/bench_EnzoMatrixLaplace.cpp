@@ -0,0 +1,58 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     bench_EnzoMatrixLaplace.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-19
+/// @brief    Benchmark the EnzoMatrixLaplace matrix-vector product
+
+#include "test.hpp"
+#include "main.hpp"
+#include "enzo.hpp"
+
+//----------------------------------------------------------------------
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  bench_init("bench_EnzoMatrixLaplace");
+
+  bench_class("EnzoMatrixLaplace");
+
+  // 32^rank active cells with enough ghosts for any order
+
+  const int n = 32;
+  const int g = 3;
+
+  for (int rank=2; rank<=3; rank++) {
+
+    const int mx = n+2*g;
+    const int my = n+2*g;
+    const int mz = (rank == 3) ? n+2*g : 1;
+    const int m = mx*my*mz;
+    const int64_t num_elements = int64_t(n)*n*((rank == 3) ? n : 1);
+
+    std::vector<enzo_float> x(m), y(m,0.0);
+    for (int i=0; i<m; i++) x[i] = 1.0 + 0.001*(i % 1000);
+
+    for (int order=2; order<=6; order+=2) {
+
+      EnzoMatrixLaplace matrix (order);
+      matrix.set_dimensions (mx,my,mz);
+      matrix.set_cell_width (1.0/n,1.0/n,1.0/n);
+
+      char name[80];
+      snprintf (name,80,"matvec order %d rank %d",order,rank);
+      bench_measure (name, num_elements, 2*num_elements*sizeof(enzo_float),
+		     [&] ()
+		     { matrix.matvec (default_precision,y.data(),x.data(),g); });
+    }
+  }
+
+  bench_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
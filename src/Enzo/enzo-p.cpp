@@ -37,6 +37,8 @@
 
 #include "charm_enzo.hpp"
 
+#include "CkLoopAPI.h"
+
 //----------------------------------------------------------------------
 
 extern CProxy_EnzoSimulation proxy_enzo_simulation;
@@ -112,6 +114,15 @@ PARALLEL_MAIN_BEGIN
 
  //--------------------------------------------------
 
+#if CMK_SMP
+  // Node-level loops (e.g. Method:ppm:num_threads) use the PEs of
+  // each SMP node; without SMP nodes have a single PE and CkLoop is
+  // not used
+  CkLoop_Init();
+#endif
+
+  //--------------------------------------------------
+
   proxy_main     = thishandle;
 
   // --------------------------------------------------
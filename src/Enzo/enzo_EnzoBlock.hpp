@@ -175,10 +175,12 @@ public: // interface
   int SetMinimumSupport(enzo_float &MinimumSupportEnergyCoefficient,
 			bool comoving_coordinates);
 
-  /// Solve the hydro equations using PPM
+  /// Solve the hydro equations using PPM, updating slices of each
+  /// sweep concurrently on num_threads PEs of the node if > 1
   int SolveHydroEquations ( enzo_float time, 
 			    enzo_float dt,
-			    bool comoving_coordinates);
+			    bool comoving_coordinates,
+			    int num_threads = 1);
 
   /// Solve the hydro equations using Enzo 3.0 PPM
   int SolveHydroEquations3 ( enzo_float time, enzo_float dt);
@@ -206,6 +208,16 @@ public: /// entry methods
   /// Compute sum, min, and max of g values for EnzoMethodTurbulence
   void p_method_turbulence_end(CkReductionMsg *msg);
 
+  /// Receive neighbor particles for EnzoMethodFof
+  void p_method_fof_ghost(Index index, int n, int * ids, double * pos);
+
+  /// Complete EnzoMethodFof after all Blocks have sent their groups
+  void r_method_fof_end(CkReductionMsg *msg);
+
+  /// Receive Block data from an EnzoInitialMusic collective reader
+  void p_initial_music_recv(int index, int is_particle,
+			    int type_data, int n, char * data);
+
   /// TEMP
   double timestep() { return dt; }
 
@@ -293,6 +305,10 @@ public: /// entry methods
   void r_solver_dd_barrier(CkReductionMsg* msg);
   void r_solver_dd_end(CkReductionMsg* msg);
 
+  // EnzoSolverFft
+
+  void p_solver_fft_scatter(int n, enzo_float values[]);
+
   // EnzoSolverJacobi
 
   void p_solver_jacobi_continue();
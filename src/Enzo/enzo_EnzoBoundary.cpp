@@ -148,6 +148,7 @@ void EnzoBoundary::enforce_reflecting_
     enforce_reflecting_precision_(face,axis, array,
 				  nx,ny,nz, gx,gy,gz, cx,cy,cz, vx,vy,vz,
 				  x,y,z,    xm,ym,zm, xp,yp,zp, t);
+    field.field_data()->set_modified(index);
   }
 
   delete [] xc;
@@ -340,7 +341,7 @@ void EnzoBoundary::enforce_outflow_
     enforce_outflow_precision_(face,axis, array,
 			       nx,ny,nz, gx,gy,gz, cx,cy,cz,
 			       x,y,z,    xm,ym,zm, xp,yp,zp, t);
-    
+    field.field_data()->set_modified(index);
   }
   delete [] xc;
   delete [] yc;
@@ -58,7 +58,35 @@ void EnzoComputeCoolingTime::compute ( Block * block, enzo_float * ct) throw()
 
   if (!block->is_leaf()) return;
 
+  // Skip the computation if ct is the permanent "cooling_time" field
+  // and neither it nor its inputs have changed since last computed
+
+  FieldData * field_data = block->data()->field_data();
+  Field field = block->data()->field();
+
+  const int id_cooling_time = field.field_id("cooling_time");
+  const bool is_cached = (i_hist_ == 0) && (id_cooling_time >= 0) &&
+    (ct == (enzo_float *) field.values(id_cooling_time));
+
+  std::vector<int> id_inputs;
+  std::vector<double> params;
+
+  if (is_cached) {
+    // Grackle may use any species field, and rates depend on time
+    for (int i=0; i<field.field_count(); i++) {
+      if (i != id_cooling_time) id_inputs.push_back(i);
+    }
+    params.push_back(block->time());
+    if (field_data->derived_is_current(id_cooling_time,id_inputs,params)) {
+      return;
+    }
+  }
+
   compute_(block, ct);
+
+  if (is_cached) {
+    field_data->set_derived_current(id_cooling_time,id_inputs,params);
+  }
 }
 
 //----------------------------------------------------------------------
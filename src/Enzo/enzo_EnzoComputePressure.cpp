@@ -64,7 +64,60 @@ void EnzoComputePressure::compute (Block * block, enzo_float * p) throw()
 
   if (!block->is_leaf()) return;
 
+  // Skip the computation if p is the permanent "pressure" field and
+  // neither it nor its inputs have changed since it was last computed
+
+  FieldData * field_data = block->data()->field_data();
+  Field field = block->data()->field();
+
+  const int id_pressure = field.field_id("pressure");
+  const bool is_cached = (i_hist_ == 0) && (id_pressure >= 0) &&
+    (p == (enzo_float *) field.values(id_pressure));
+
+  std::vector<int> id_inputs;
+  std::vector<double> params;
+
+  if (is_cached) {
+    cache_key_(block,&id_inputs,&params);
+    if (field_data->derived_is_current(id_pressure,id_inputs,params)) return;
+  }
+
   compute_(block, p);
+
+  if (is_cached) {
+    field_data->set_derived_current(id_pressure,id_inputs,params);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoComputePressure::cache_key_
+(Block * block,
+ std::vector<int> * id_inputs,
+ std::vector<double> * params) const throw()
+{
+  Field field = block->data()->field();
+  const bool use_grackle = enzo::config()->method_grackle_use_grackle;
+  const bool dual_energy = enzo::config()->ppm_dual_energy;
+
+  if (use_grackle) {
+    // Grackle may use any species field
+    const int id_pressure = field.field_id("pressure");
+    for (int i=0; i<field.field_count(); i++) {
+      if (i != id_pressure) id_inputs->push_back(i);
+    }
+  } else {
+    id_inputs->push_back(field.field_id("density"));
+    id_inputs->push_back(field.field_id("velocity_x"));
+    id_inputs->push_back(field.field_id("velocity_y"));
+    id_inputs->push_back(field.field_id("velocity_z"));
+    id_inputs->push_back(field.field_id("total_energy"));
+    id_inputs->push_back(field.field_id("internal_energy"));
+  }
+  params->push_back(gamma_);
+  params->push_back(comoving_coordinates_ ? 1.0 : 0.0);
+  params->push_back(use_grackle ? 1.0 : 0.0);
+  params->push_back(dual_energy ? 1.0 : 0.0);
 }
 
 //----------------------------------------------------------------------
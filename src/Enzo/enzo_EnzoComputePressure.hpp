@@ -52,7 +52,13 @@ public: // interface
 #endif
     );
 
-    
+protected: // functions
+
+  /// Return the fields and parameters that the "pressure" field
+  /// depends on, used to decide whether it must be recomputed
+  void cache_key_ (Block * block,
+		   std::vector<int> * id_inputs,
+		   std::vector<double> * params) const throw();
 
 protected: // attributes
 
@@ -71,7 +71,53 @@ void EnzoComputeTemperature::compute ( Block * block, enzo_float * t) throw()
 
   if (!block->is_leaf()) return;
 
-  compute_(block, t);
+  // Skip the computation if t is the permanent "temperature" field
+  // and neither it nor its inputs have changed since last computed.
+  // Pressure is brought up to date first, since it is an input
+
+  FieldData * field_data = block->data()->field_data();
+  Field field = block->data()->field();
+
+  const bool use_grackle = enzo::config()->method_grackle_use_grackle;
+  const int id_temperature = field.field_id("temperature");
+  const int id_pressure    = field.field_id("pressure");
+  const bool is_cached = (i_hist_ == 0) && (id_temperature >= 0) &&
+    (use_grackle || id_pressure >= 0) &&
+    (t == (enzo_float *) field.values(id_temperature));
+
+  if (! is_cached) {
+    compute_(block, t);
+    return;
+  }
+
+  std::vector<int> id_inputs;
+  std::vector<double> params;
+
+  if (use_grackle) {
+    for (int i=0; i<field.field_count(); i++) {
+      if (i != id_temperature) id_inputs.push_back(i);
+    }
+  } else {
+    const int in = cello::index_static();
+    EnzoComputePressure compute_pressure(EnzoBlock::Gamma[in],
+                                         comoving_coordinates_);
+    compute_pressure.compute
+      (block, (enzo_float *) field.values(id_pressure));
+    id_inputs.push_back(field.field_id("density"));
+    id_inputs.push_back(id_pressure);
+  }
+  params.push_back(density_floor_);
+  params.push_back(temperature_floor_);
+  params.push_back(mol_weight_);
+  params.push_back(enzo::units()->temperature());
+  params.push_back(use_grackle ? block->time() : 0.0);
+
+  if (field_data->derived_is_current(id_temperature,id_inputs,params)) return;
+
+  // pressure is current from above
+  compute_(block, t, false);
+
+  field_data->set_derived_current(id_temperature,id_inputs,params);
 }
 
 //----------------------------------------------------------------------
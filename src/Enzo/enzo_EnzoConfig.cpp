@@ -31,6 +31,7 @@ EnzoConfig::EnzoConfig() throw ()
   ppm_steepening(false),
   ppm_use_minimum_pressure_support(false),
   ppm_mol_weight(0.0),
+  ppm_num_threads(1),
   field_gamma(0.0),
   physics_cosmology(false),
   physics_cosmology_hubble_constant_now(0.0),
@@ -78,6 +79,8 @@ EnzoConfig::EnzoConfig() throw ()
   initial_music_throttle_group_size(),
   initial_music_throttle_seconds_stagger(),
   initial_music_throttle_seconds_delay(),
+  initial_music_collective(),
+  initial_music_num_readers(),
   // EnzoInitialPm
   initial_pm_field(""),
   initial_pm_mpp(0.0),
@@ -112,6 +115,11 @@ EnzoConfig::EnzoConfig() throw ()
   interpolation_method(""),
   // EnzoMethodCheckGravity
   method_check_gravity_particle_type(),
+  // EnzoMethodFof
+  method_fof_particle_type(""),
+  method_fof_linking_length(0.0),
+  method_fof_min_members(0),
+  method_fof_file_name(""),
   // EnzoMethodHeat
   method_heat_alpha(0.0),
   // EnzoMethodHydro
@@ -141,6 +149,17 @@ EnzoConfig::EnzoConfig() throw ()
   method_pm_deposit_alpha(0.5),
   /// EnzoMethodPmUpdate
   method_pm_update_max_dt(std::numeric_limits<double>::max()),
+  /// EnzoMethodProfile
+  method_profile_fields(),
+  method_profile_radial_bins(0),
+  method_profile_radius_min(0.0),
+  method_profile_radius_max(0.0),
+  method_profile_radial_scale(""),
+  method_profile_histogram_bins(0),
+  method_profile_histogram_min(),
+  method_profile_histogram_max(),
+  method_profile_histogram_scale(""),
+  method_profile_file_name(""),
   /// EnzoProlong
   prolong_enzo_type(),
   prolong_enzo_positive(true),
@@ -154,8 +173,11 @@ EnzoConfig::EnzoConfig() throw ()
   solver_restart_cycle(),
   /// EnzoSolver<Krylov>
   solver_precondition(),
+  solver_mixed_precision(),
   solver_coarse_level(),
   solver_is_unigrid(),
+  /// EnzoSolverFft
+  solver_max_size(),
   stopping_redshift()
 
 {
@@ -210,6 +232,7 @@ void EnzoConfig::pup (PUP::er &p)
   p | ppm_steepening;
   p | ppm_use_minimum_pressure_support;
   p | ppm_mol_weight;
+  p | ppm_num_threads;
 
   p | field_gamma;
 
@@ -283,6 +306,8 @@ void EnzoConfig::pup (PUP::er &p)
   p | initial_music_throttle_group_size;
   p | initial_music_throttle_seconds_stagger;
   p | initial_music_throttle_seconds_delay;
+  p | initial_music_collective;
+  p | initial_music_num_readers;
 
   p | initial_pm_field;
   p | initial_pm_mpp;
@@ -302,6 +327,11 @@ void EnzoConfig::pup (PUP::er &p)
 
   p | method_check_gravity_particle_type;
 
+  p | method_fof_particle_type;
+  p | method_fof_linking_length;
+  p | method_fof_min_members;
+  p | method_fof_file_name;
+
   p | method_heat_alpha;
 
   p | method_hydro_method;
@@ -323,6 +353,18 @@ void EnzoConfig::pup (PUP::er &p)
   p | method_pm_deposit_alpha;
   p | method_pm_update_max_dt;
 
+  p | method_profile_fields;
+  PUParray(p,method_profile_center,3);
+  p | method_profile_radial_bins;
+  p | method_profile_radius_min;
+  p | method_profile_radius_max;
+  p | method_profile_radial_scale;
+  p | method_profile_histogram_bins;
+  p | method_profile_histogram_min;
+  p | method_profile_histogram_max;
+  p | method_profile_histogram_scale;
+  p | method_profile_file_name;
+
   p | prolong_enzo_type;
   p | prolong_enzo_positive;
 
@@ -334,8 +376,10 @@ void EnzoConfig::pup (PUP::er &p)
   p | solver_weight;
   p | solver_restart_cycle;
   p | solver_precondition;
+  p | solver_mixed_precision;
   p | solver_coarse_level;
   p | solver_is_unigrid;
+  p | solver_max_size;
 
   p | stopping_redshift;
 
@@ -416,6 +460,8 @@ void EnzoConfig::read(Parameters * p) throw()
     ("Method:ppm:use_minimum_pressure_support",false);
   ppm_mol_weight = p->value_float
     ("Method:ppm:mol_weight",0.6);
+  ppm_num_threads = p->value_integer
+    ("Method:ppm:num_threads",1);
 
   // InitialMusic
 
@@ -467,6 +513,10 @@ void EnzoConfig::read(Parameters * p) throw()
     ("Initial:music:throttle_seconds_stagger",0.0);
   initial_music_throttle_seconds_delay = p->value_float
     ("Initial:music:throttle_seconds_delay",0.0);
+  initial_music_collective = p->value_logical
+    ("Initial:music:collective",false);
+  initial_music_num_readers = p->value_integer
+    ("Initial:music:num_readers",0);
 
   // PM method and initialization
 
@@ -475,6 +525,46 @@ void EnzoConfig::read(Parameters * p) throw()
   method_pm_update_max_dt = p->value_float
     ("Method:pm_update:max_dt", std::numeric_limits<double>::max());
 
+  // Profile method
+
+  method_profile_fields.clear();
+  const int num_profile_fields = p->list_length("Method:profile:fields");
+  for (int i=0; i<num_profile_fields; i++) {
+    method_profile_fields.push_back
+      (p->list_value_string(i,"Method:profile:fields"));
+  }
+  for (int axis=0; axis<3; axis++) {
+    method_profile_center[axis] = p->list_value_float
+      (axis,"Method:profile:center",
+       0.5*(domain_lower[axis] + domain_upper[axis]));
+  }
+  method_profile_radial_bins = p->value_integer
+    ("Method:profile:radial_bins",32);
+  method_profile_radius_min = p->value_float
+    ("Method:profile:radius_min",0.0);
+  method_profile_radius_max = p->value_float
+    ("Method:profile:radius_max",0.5*(domain_upper[0] - domain_lower[0]));
+  method_profile_radial_scale = p->value_string
+    ("Method:profile:radial_scale","linear");
+  method_profile_histogram_bins = p->value_integer
+    ("Method:profile:histogram_bins",0);
+  method_profile_histogram_min.clear();
+  method_profile_histogram_max.clear();
+  const int num_histogram_min = p->list_length("Method:profile:histogram_min");
+  for (int i=0; i<num_histogram_min; i++) {
+    method_profile_histogram_min.push_back
+      (p->list_value_float(i,"Method:profile:histogram_min"));
+  }
+  const int num_histogram_max = p->list_length("Method:profile:histogram_max");
+  for (int i=0; i<num_histogram_max; i++) {
+    method_profile_histogram_max.push_back
+      (p->list_value_float(i,"Method:profile:histogram_max"));
+  }
+  method_profile_histogram_scale = p->value_string
+    ("Method:profile:histogram_scale","log");
+  method_profile_file_name = p->value_string
+    ("Method:profile:file_name","profile-%06d.txt");
+
   // ENZO interpolation
   prolong_enzo_type     = p->value_logical ("Prolong:enzo:type","2A");
   prolong_enzo_positive = p->value_logical ("Prolong:enzo:positive",true);
@@ -630,6 +720,18 @@ void EnzoConfig::read(Parameters * p) throw()
   method_check_gravity_particle_type = p->value_string
     ("Method:check_gravity:particle_type","dark");
 
+  method_fof_particle_type = p->value_string
+    ("Method:fof:particle_type","dark");
+
+  method_fof_linking_length = p->value_float
+    ("Method:fof:linking_length",0.2);
+
+  method_fof_min_members = p->value_integer
+    ("Method:fof:min_members",10);
+
+  method_fof_file_name = p->value_string
+    ("Method:fof:file_name","fof-%06d.txt");
+
   method_heat_alpha = p->value_float
     ("Method:heat:alpha",1.0);
 
@@ -735,8 +837,10 @@ void EnzoConfig::read(Parameters * p) throw()
   solver_weight.      resize(num_solvers);
   solver_restart_cycle.resize(num_solvers);
   solver_precondition.resize(num_solvers);
+  solver_mixed_precision.resize(num_solvers);
   solver_coarse_level.resize(num_solvers);
   solver_is_unigrid.resize(num_solvers);
+  solver_max_size.resize(num_solvers);
 
   for (int index_solver=0; index_solver<num_solvers; index_solver++) {
 
@@ -793,6 +897,9 @@ void EnzoConfig::read(Parameters * p) throw()
     solver_restart_cycle[index_solver] =
       p->value_integer(solver_name + ":restart_cycle",1);
 
+    solver_mixed_precision[index_solver] =
+      p->value_logical(solver_name + ":mixed_precision",false);
+
     solver_coarse_level[index_solver] = 
       p->value_integer (solver_name + ":coarse_level",
 			solver_min_level[index_solver]);
@@ -800,6 +907,9 @@ void EnzoConfig::read(Parameters * p) throw()
     solver_is_unigrid[index_solver] =
       p->value_logical (solver_name + ":is_unigrid",false);
 
+    solver_max_size[index_solver] =
+      p->value_integer (solver_name + ":max_size",128*128*128);
+
   }
 
   //======================================================================
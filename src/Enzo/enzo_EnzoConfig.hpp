@@ -117,6 +117,7 @@ public: // interface
       ppm_steepening(false),
       ppm_use_minimum_pressure_support(false),
       ppm_mol_weight(0.0),
+      ppm_num_threads(1),
       field_gamma(0.0),
       // Cosmology
       physics_cosmology(false),
@@ -165,6 +166,8 @@ public: // interface
       initial_music_throttle_group_size(),
       initial_music_throttle_seconds_stagger(),
       initial_music_throttle_seconds_delay(),
+      initial_music_collective(),
+      initial_music_num_readers(),
       // EnzoInitialPm
       initial_pm_field(""),
       initial_pm_mpp(0.0),
@@ -199,6 +202,11 @@ public: // interface
       interpolation_method(""),
       // EnzoMethodCheckGravity
       method_check_gravity_particle_type(),
+      // EnzoMethodFof
+      method_fof_particle_type(""),
+      method_fof_linking_length(0.0),
+      method_fof_min_members(0),
+      method_fof_file_name(""),
       // EnzoMethodHeat
       method_heat_alpha(0.0),
       // EnzoMethodHydro
@@ -229,6 +237,17 @@ public: // interface
       method_pm_deposit_alpha(0.5),
       // EnzoMethodPmUpdate
       method_pm_update_max_dt(0.0),
+      // EnzoMethodProfile
+      method_profile_fields(),
+      method_profile_radial_bins(0),
+      method_profile_radius_min(0.0),
+      method_profile_radius_max(0.0),
+      method_profile_radial_scale(""),
+      method_profile_histogram_bins(0),
+      method_profile_histogram_min(),
+      method_profile_histogram_max(),
+      method_profile_histogram_scale(""),
+      method_profile_file_name(""),
       // EnzoProlong
       prolong_enzo_type(),
       prolong_enzo_positive(true),
@@ -242,8 +261,11 @@ public: // interface
       solver_restart_cycle(),
       // EnzoSolver<Krylov>
       solver_precondition(),
+      solver_mixed_precision(),
       solver_coarse_level(),
       solver_is_unigrid(),
+      // EnzoSolverFft
+      solver_max_size(),
       // EnzoStopping
       stopping_redshift()
 
@@ -288,6 +310,7 @@ public: // attributes
   bool                       ppm_steepening;
   bool                       ppm_use_minimum_pressure_support;
   double                     ppm_mol_weight;
+  int                        ppm_num_threads;
 
   double                     field_gamma;
 
@@ -347,6 +370,8 @@ public: // attributes
   int                         initial_music_throttle_group_size;
   double                      initial_music_throttle_seconds_stagger;
   double                      initial_music_throttle_seconds_delay;
+  bool                        initial_music_collective;
+  int                         initial_music_num_readers;
 
   /// EnzoInitialPm
   std::string                initial_pm_field;
@@ -394,6 +419,12 @@ public: // attributes
   /// EnzoMethodCheckGravity
   std::string                method_check_gravity_particle_type;
   
+  /// EnzoMethodFof
+  std::string                method_fof_particle_type;
+  double                     method_fof_linking_length;
+  int                        method_fof_min_members;
+  std::string                method_fof_file_name;
+
   /// EnzoMethodHeat
   double                     method_heat_alpha;
 
@@ -433,6 +464,19 @@ public: // attributes
 
   double                     method_pm_update_max_dt;
 
+  /// EnzoMethodProfile
+  std::vector<std::string>   method_profile_fields;
+  double                     method_profile_center[3];
+  int                        method_profile_radial_bins;
+  double                     method_profile_radius_min;
+  double                     method_profile_radius_max;
+  std::string                method_profile_radial_scale;
+  int                        method_profile_histogram_bins;
+  std::vector<double>        method_profile_histogram_min;
+  std::vector<double>        method_profile_histogram_max;
+  std::string                method_profile_histogram_scale;
+  std::string                method_profile_file_name;
+
   std::string                prolong_enzo_type;
   bool                       prolong_enzo_positive;
   
@@ -473,11 +517,18 @@ public: // attributes
   /// Solver index for Krylov solver preconditioner
   std::vector<int>           solver_precondition;
 
+  /// Whether Krylov solver iterates in single precision with
+  /// double-precision residual correction
+  std::vector<int>           solver_mixed_precision;
+
   /// Mg0 coarse grid solver
 
   std::vector<int>           solver_coarse_level;
   std::vector<int>           solver_is_unigrid;
 
+  /// EnzoSolverFft maximum number of cells in the gathered solve level
+  std::vector<int>           solver_max_size;
+
   /// Stop at specified redshift for cosmology
   double                     stopping_redshift;
 
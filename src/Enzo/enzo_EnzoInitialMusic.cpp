@@ -45,8 +45,17 @@ EnzoInitialMusic::EnzoInitialMusic
     throttle_close_count_(enzo_config->initial_music_throttle_close_count),
     throttle_group_size_    (enzo_config->initial_music_throttle_group_size),
     throttle_seconds_stagger_ (enzo_config->initial_music_throttle_seconds_stagger),
-    throttle_seconds_delay_ (enzo_config->initial_music_throttle_seconds_delay)
+    throttle_seconds_delay_ (enzo_config->initial_music_throttle_seconds_delay),
+    collective_ (enzo_config->initial_music_collective),
+    num_readers_ (enzo_config->initial_music_num_readers)
 {
+  if (collective_ && level_ != 0) {
+    WARNING1 ("EnzoInitialMusic::EnzoInitialMusic()",
+	      "Collective reads require level 0 initial conditions, "
+	      "not level %d: reading per Block instead",
+	      level_);
+    collective_ = false;
+  }
 }
 
 //----------------------------------------------------------------------
@@ -76,6 +85,8 @@ void EnzoInitialMusic::pup (PUP::er &p)
   p | throttle_group_size_;
   p | throttle_seconds_stagger_;
   p | throttle_seconds_delay_;
+  p | collective_;
+  p | num_readers_;
 }
 
 //----------------------------------------------------------------------
@@ -86,6 +97,14 @@ void EnzoInitialMusic::enforce_block
 
   if (block->level() != level_) return;
 
+  // If reading collectively, data is sent by reader processes after
+  // all Blocks have been created
+
+  if (collective_) {
+    block->initial_expect(field_files_.size() + particle_files_.size());
+    return;
+  }
+
   // Optionally pause before reading if throttling enabled.  For
   // reducing filesystem contention on large runs
   throttle_stagger_();
@@ -222,18 +241,7 @@ void EnzoInitialMusic::enforce_block
 
     file->data_read (data);
 
-    enzo_float * array = (enzo_float *) field.values(field_names_[index]);
-
-    if (type_data == type_single) {
-
-      copy_field_data_to_array_
-	(array,data_float,mx,my,mz,nx,ny,nz,gx,gy,gz,n4,IX,IY);
-      
-    } else if (type_data == type_double) {
-
-      copy_field_data_to_array_
-	(array,data_double,mx,my,mz,nx,ny,nz,gx,gy,gz,n4,IX,IY);
-    }
+    apply_field_data(block,index,type_data,data);
 
     if (type_data == type_single) {
       delete [] data_float;
@@ -399,145 +407,379 @@ void EnzoInitialMusic::enforce_block
       CmiUnlock(throttle_node_lock);
     }
     
-    // Create particles and initialize them
+    apply_particle_data(block,index,type_data,data);
 
-    Particle particle = block->data()->particle();
+    if (type_data == type_single) {
+      delete [] data_float;
+    } else if (type_data == type_double) {
+      delete [] data_double;
+    }
+  }
+}
 
-    const int it = particle.type_index(particle_types_[index]);
-    const int ia = particle.attribute_index(it,particle_attributes_[index]);
+//----------------------------------------------------------------------
 
-    const int np = nx*ny*nz;
+void EnzoInitialMusic::enforce_block_exit ( Block * block ) throw()
+{
+  // Start collective reads once all root-level Blocks exist and
+  // have called initial_expect()
 
-    // insert particles if they don't exist yet
-    if (particle.num_particles(it) == 0) {
-      particle.insert_particles(it,np);
-      enzo::simulation()->data_insert_particles(np);
-    }
+  if (collective_ && block->index().is_root()) {
+    proxy_enzo_simulation.p_initial_music_read();
+  }
+}
 
-    // read particle attribute
-    union {
-      void *   array;
-      float *  array_float;
-      double * array_double;
-    };
+//----------------------------------------------------------------------
 
-    const int type_array = particle.attribute_type(it,ia);
+void EnzoInitialMusic::read_collective
+(int reader, int num_readers, long long * bytes)
+{
+  for (size_t index=0; index<field_files_.size(); index++) {
+    (*bytes) += read_collective_dataset_
+      (reader, num_readers, index, false,
+       field_files_[index],field_datasets_[index],field_coords_[index]);
+  }
+  for (size_t index=0; index<particle_files_.size(); index++) {
+    (*bytes) += read_collective_dataset_
+      (reader, num_readers, index, true,
+       particle_files_[index],particle_datasets_[index],
+       particle_coords_[index]);
+  }
+}
 
-    if (type_array == type_single) {
-      if (type_data == type_single) {
-	copy_particle_data_to_array_
-	  (array_float,data_float,particle,it,ia,np);
-      } else if (type_data == type_double) {
-	copy_particle_data_to_array_
-	  (array_float,data_double,particle,it,ia,np);
-      }
-    } else if (type_array == type_double) {
-      if (type_data == type_single) {
-	copy_particle_data_to_array_
-	  (array_double,data_float,particle,it,ia,np);
-      } else if (type_data == type_double) {
-	copy_particle_data_to_array_
-	  (array_double,data_double,particle,it,ia,np);
+//----------------------------------------------------------------------
+
+long long EnzoInitialMusic::read_collective_dataset_
+(int reader, int num_readers, int index, bool is_particle,
+ std::string file_name, std::string dataset, std::string coords)
+{
+  const Config * config = cello::config();
+
+  // Root-level block counts and sizes
+
+  int nb3[3], n3[3];
+  for (int axis=0; axis<3; axis++) {
+    nb3[axis] = config->mesh_root_blocks[axis];
+    n3[axis]  = config->mesh_root_size[axis] / nb3[axis];
+  }
+
+  // File dimension of each axis
+
+  const int I3[3] = { int(coords.find ("x")),
+		      int(coords.find ("y")),
+		      int(coords.find ("z")) };
+
+  ASSERT4 ("EnzoInitialMusic::read_collective_dataset_()",
+	   "Collective reads require 3D coordinates, not \"%s\" (%d %d %d)",
+	   coords.c_str(),I3[0],I3[1],I3[2],
+	   (I3[0] >= 0 && I3[1] >= 0 && I3[2] >= 0));
+
+  // Axes in order of file dimension: slowest (aS), middle (aM), and
+  // fastest (aF) varying
+
+  int aS = 0, aM = 1, aF = 2;
+  if (I3[aS] > I3[aM]) std::swap(aS,aM);
+  if (I3[aM] > I3[aF]) std::swap(aM,aF);
+  if (I3[aS] > I3[aM]) std::swap(aS,aM);
+
+  // Pencils of Blocks along the fastest-varying axis, assigned to
+  // readers round-robin
+
+  const int num_pencils = nb3[aS]*nb3[aM];
+
+  if (reader >= num_pencils) return 0;
+
+  FileHdf5 * file = new FileHdf5 ("./",file_name);
+  file->file_open();
+
+  int m4[4] = {0};
+  int type_data = type_unknown;
+  file->data_open (dataset, &type_data, m4,m4+1,m4+2,m4+3);
+
+  const int bytes_data =
+    (type_data == type_single) ? sizeof(float) :
+    (type_data == type_double) ? sizeof(double) : 0;
+
+  if (bytes_data == 0) {
+    ERROR3 ("EnzoInitialMusic::read_collective_dataset_()",
+	    "Unsupported data type %d in file %s dataset %s",
+	    type_data,file_name.c_str(),dataset.c_str());
+  }
+
+  const int mF = m4[I3[aF]];
+  const int nF = std::min(mF, nb3[aF]*n3[aF]);
+  const int nS = n3[aS];
+  const int nM = n3[aM];
+
+  const int n_slab  = nS*nM*nF;
+  const int n_block = nS*nM*n3[aF];
+
+  std::vector<char> slab (n_slab*bytes_data);
+
+  long long bytes = 0;
+
+  for (int pencil=reader; pencil<num_pencils; pencil+=num_readers) {
+
+    const int bS = pencil / nb3[aM];
+    const int bM = pencil % nb3[aM];
+
+    // select the pencil, adjusting offsets if the domain is larger
+    // than the file input as in enforce_block()
+
+    int o4[4] = {0,0,0,0};
+    int c4[4] = {1,1,1,1};
+    o4[I3[aS]] = (bS*nS) % m4[I3[aS]];
+    o4[I3[aM]] = (bM*nM) % m4[I3[aM]];
+    c4[I3[aS]] = nS;
+    c4[I3[aM]] = nM;
+    c4[I3[aF]] = nF;
+
+    file->data_slice
+      (m4[0],m4[1],m4[2],m4[3],
+       c4[0],c4[1],c4[2],c4[3],
+       o4[0],o4[1],o4[2],o4[3]);
+
+    file->mem_create (nF,nM,nS, nF,nM,nS, 0,0,0);
+    file->data_read (&slab[0]);
+    file->mem_close();
+
+    bytes += (long long)(n_slab)*bytes_data;
+
+    // scatter Block sub-volumes, stored in file order as in enforce_block()
+
+    const int bytes_row = n3[aF]*bytes_data;
+
+    for (int bF=0; bF<nb3[aF]; bF++) {
+
+      const int oF = (bF*n3[aF]) % mF;
+
+      std::vector<char> block_data (n_block*bytes_data);
+
+      for (int iS=0; iS<nS; iS++) {
+	for (int iM=0; iM<nM; iM++) {
+	  const int i_slab  = (oF + nF*(iM + nM*iS))*bytes_data;
+	  const int i_block = (n3[aF]*(iM + nM*iS))*bytes_data;
+	  memcpy (&block_data[i_block], &slab[i_slab], bytes_row);
+	}
       }
-    } else {
-      ERROR3 ("EnzoInitialMusic::enforce_block()",
-	      "Unsupported particle precision %s for "
-	      "particle type %s attribute %s",
-	      cello::precision_name[type_array],
-	      particle.type_name(it).c_str(),
-	      particle.attribute_name(it,ia).c_str());
+
+      int ib3[3];
+      ib3[aS] = bS;
+      ib3[aM] = bM;
+      ib3[aF] = bF;
+      Index index_block (ib3[0],ib3[1],ib3[2]);
+
+      enzo::block_array()[index_block].p_initial_music_recv
+	(index, is_particle, type_data, block_data.size(), &block_data[0]);
     }
-    
+  }
+
+  file->data_close();
+  file->file_close();
+  delete file;
+
+  return bytes;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoInitialMusic::apply_field_data
+(Block * block, int index, int type_data, void * data) const
+{
+  Field field = block->data()->field();
+
+  int mx,my,mz;
+  int nx,ny,nz;
+  int gx,gy,gz;
+
+  field.dimensions (0,&mx,&my,&mz);
+  field.size         (&nx,&ny,&nz);
+  field.ghost_depth(0,&gx,&gy,&gz);
+
+  const int IX = field_coords_[index].find ("x");
+  const int IY = field_coords_[index].find ("y");
+  const int IZ = field_coords_[index].find ("z");
+
+  int n4[4] = {1};
+  n4[IX] = nx;
+  n4[IY] = ny;
+  n4[IZ] = nz;
+
+  enzo_float * array = (enzo_float *) field.values(field_names_[index]);
+
+  if (type_data == type_single) {
+
+    copy_field_data_to_array_
+      (array,(float *)data,mx,my,mz,nx,ny,nz,gx,gy,gz,n4,IX,IY);
+
+  } else if (type_data == type_double) {
+
+    copy_field_data_to_array_
+      (array,(double *)data,mx,my,mz,nx,ny,nz,gx,gy,gz,n4,IX,IY);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoInitialMusic::apply_particle_data
+(Block * block, int index, int type_data, void * data_in)
+{
+  Field field = block->data()->field();
+
+  int nx,ny,nz;
+  field.size (&nx,&ny,&nz);
+
+  double lower_block[3];
+  double upper_block[3];
+  block->lower(lower_block, lower_block+1, lower_block+2);
+  block->upper(upper_block, upper_block+1, upper_block+2);
+
+  const int IX = particle_coords_[index].find ("x");
+  const int IY = particle_coords_[index].find ("y");
+  const int IZ = particle_coords_[index].find ("z");
+
+  double h4[4] = {1};
+  h4[IX] = (upper_block[0] - lower_block[0]) / nx;
+  h4[IY] = (upper_block[1] - lower_block[1]) / ny;
+  h4[IZ] = (upper_block[2] - lower_block[2]) / nz;
+
+  union {
+    void   * data;
+    float  * data_float;
+    double * data_double;
+  };
+  data = data_in;
+
+  // Create particles and initialize them
+
+  Particle particle = block->data()->particle();
+
+  const int it = particle.type_index(particle_types_[index]);
+  const int ia = particle.attribute_index(it,particle_attributes_[index]);
+
+  const int np = nx*ny*nz;
+
+  // insert particles if they don't exist yet
+  if (particle.num_particles(it) == 0) {
+    particle.insert_particles(it,np);
+    enzo::simulation()->data_insert_particles(np);
+  }
+
+  // read particle attribute
+  union {
+    void *   array;
+    float *  array_float;
+    double * array_double;
+  };
+
+  const int type_array = particle.attribute_type(it,ia);
+
+  if (type_array == type_single) {
     if (type_data == type_single) {
-      delete [] data_float;
+      copy_particle_data_to_array_
+	(array_float,data_float,particle,it,ia,np);
     } else if (type_data == type_double) {
-      delete [] data_double;
+      copy_particle_data_to_array_
+	(array_float,data_double,particle,it,ia,np);
     }
-
-    data = NULL;
-
-    // update positions with displacements
-    if (type_array == type_single) {
-      
-      if (particle_datasets_[index] == "ParticleDisplacements_x") {
-	for (int iz=0; iz<nz; iz++) {
-	  for (int iy=0; iy<ny; iy++) {
-	    for (int ix=0; ix<nx; ix++) {
-	      int ip = ix + nx*(iy + ny*iz);
-	      int ib,io;
-	      particle.index(ip,&ib,&io);
-	      array = particle.attribute_array(it,ia,ib);
-	      array_float[io] += lower_block[0] + (ix+0.5)*h4[IX];
-	    }
+  } else if (type_array == type_double) {
+    if (type_data == type_single) {
+      copy_particle_data_to_array_
+	(array_double,data_float,particle,it,ia,np);
+    } else if (type_data == type_double) {
+      copy_particle_data_to_array_
+	(array_double,data_double,particle,it,ia,np);
+    }
+  } else {
+    ERROR3 ("EnzoInitialMusic::apply_particle_data()",
+	    "Unsupported particle precision %s for "
+	    "particle type %s attribute %s",
+	    cello::precision_name[type_array],
+	    particle.type_name(it).c_str(),
+	    particle.attribute_name(it,ia).c_str());
+  }
+  
+  // update positions with displacements
+  if (type_array == type_single) {
+    
+    if (particle_datasets_[index] == "ParticleDisplacements_x") {
+      for (int iz=0; iz<nz; iz++) {
+	for (int iy=0; iy<ny; iy++) {
+	  for (int ix=0; ix<nx; ix++) {
+	    int ip = ix + nx*(iy + ny*iz);
+	    int ib,io;
+	    particle.index(ip,&ib,&io);
+	    array = particle.attribute_array(it,ia,ib);
+	    array_float[io] += lower_block[0] + (ix+0.5)*h4[IX];
 	  }
 	}
-      } else if (particle_datasets_[index] == "ParticleDisplacements_y") {
-	for (int iz=0; iz<nz; iz++) {
-	  for (int iy=0; iy<ny; iy++) {
-	    for (int ix=0; ix<nx; ix++) {
-	      int ip = ix + nx*(iy + ny*iz);
-	      int ib,io;
-	      particle.index(ip,&ib,&io);
-	      array = particle.attribute_array(it,ia,ib);
-	      array_float[io] += lower_block[1] + (iy+0.5)*h4[IY];
-	    }
+      }
+    } else if (particle_datasets_[index] == "ParticleDisplacements_y") {
+      for (int iz=0; iz<nz; iz++) {
+	for (int iy=0; iy<ny; iy++) {
+	  for (int ix=0; ix<nx; ix++) {
+	    int ip = ix + nx*(iy + ny*iz);
+	    int ib,io;
+	    particle.index(ip,&ib,&io);
+	    array = particle.attribute_array(it,ia,ib);
+	    array_float[io] += lower_block[1] + (iy+0.5)*h4[IY];
 	  }
 	}
-      } else if (particle_datasets_[index] == "ParticleDisplacements_z") {
-	for (int iz=0; iz<nz; iz++) {
-	  for (int iy=0; iy<ny; iy++) {
-	    for (int ix=0; ix<nx; ix++) {
-	      int ip = ix + nx*(iy + ny*iz);
-	      int ib,io;
-	      particle.index(ip,&ib,&io);
-	      array = particle.attribute_array(it,ia,ib);
-	      array_float[io] += lower_block[2] + (iz+0.5)*h4[IZ];
-	    }
+      }
+    } else if (particle_datasets_[index] == "ParticleDisplacements_z") {
+      for (int iz=0; iz<nz; iz++) {
+	for (int iy=0; iy<ny; iy++) {
+	  for (int ix=0; ix<nx; ix++) {
+	    int ip = ix + nx*(iy + ny*iz);
+	    int ib,io;
+	    particle.index(ip,&ib,&io);
+	    array = particle.attribute_array(it,ia,ib);
+	    array_float[io] += lower_block[2] + (iz+0.5)*h4[IZ];
 	  }
 	}
       }
+    }
 
-    } else { // (type_array != type_single) {
-      
-      if (particle_datasets_[index] == "ParticleDisplacements_x") {
-	for (int iz=0; iz<nz; iz++) {
-	  for (int iy=0; iy<ny; iy++) {
-	    for (int ix=0; ix<nx; ix++) {
-	      int ip = ix + nx*(iy + ny*iz);
-	      int ib,io;
-	      particle.index(ip,&ib,&io);
-	      array = particle.attribute_array(it,ia,ib);
-	      array_double[io] += lower_block[0] + (ix+0.5)*h4[IX];
-	    }
+  } else { // (type_array != type_single) {
+    
+    if (particle_datasets_[index] == "ParticleDisplacements_x") {
+      for (int iz=0; iz<nz; iz++) {
+	for (int iy=0; iy<ny; iy++) {
+	  for (int ix=0; ix<nx; ix++) {
+	    int ip = ix + nx*(iy + ny*iz);
+	    int ib,io;
+	    particle.index(ip,&ib,&io);
+	    array = particle.attribute_array(it,ia,ib);
+	    array_double[io] += lower_block[0] + (ix+0.5)*h4[IX];
 	  }
 	}
-      } else if (particle_datasets_[index] == "ParticleDisplacements_y") {
-	for (int iz=0; iz<nz; iz++) {
-	  for (int iy=0; iy<ny; iy++) {
-	    for (int ix=0; ix<nx; ix++) {
-	      int ip = ix + nx*(iy + ny*iz);
-	      int ib,io;
-	      particle.index(ip,&ib,&io);
-	      array = particle.attribute_array(it,ia,ib);
-	      array_double[io] += lower_block[1] + (iy+0.5)*h4[IY];
-	    }
+      }
+    } else if (particle_datasets_[index] == "ParticleDisplacements_y") {
+      for (int iz=0; iz<nz; iz++) {
+	for (int iy=0; iy<ny; iy++) {
+	  for (int ix=0; ix<nx; ix++) {
+	    int ip = ix + nx*(iy + ny*iz);
+	    int ib,io;
+	    particle.index(ip,&ib,&io);
+	    array = particle.attribute_array(it,ia,ib);
+	    array_double[io] += lower_block[1] + (iy+0.5)*h4[IY];
 	  }
 	}
-      } else if (particle_datasets_[index] == "ParticleDisplacements_z") {
-	for (int iz=0; iz<nz; iz++) {
-	  for (int iy=0; iy<ny; iy++) {
-	    for (int ix=0; ix<nx; ix++) {
-	      int ip = ix + nx*(iy + ny*iz);
-	      int ib,io;
-	      particle.index(ip,&ib,&io);
-	      array = particle.attribute_array(it,ia,ib);
-	      array_double[io] += lower_block[2] + (iz+0.5)*h4[IZ];
-	    }
+      }
+    } else if (particle_datasets_[index] == "ParticleDisplacements_z") {
+      for (int iz=0; iz<nz; iz++) {
+	for (int iy=0; iy<ny; iy++) {
+	  for (int ix=0; ix<nx; ix++) {
+	    int ip = ix + nx*(iy + ny*iz);
+	    int ib,io;
+	    particle.index(ip,&ib,&io);
+	    array = particle.attribute_array(it,ia,ib);
+	    array_double[io] += lower_block[2] + (iz+0.5)*h4[IZ];
 	  }
 	}
       }
     }
-  }  
+  }
 }
 
 //----------------------------------------------------------------------
@@ -623,3 +865,81 @@ void EnzoInitialMusic::copy_particle_data_to_array_
     array[io] = data[ip];
   }
 }
+
+//======================================================================
+
+/// Return the EnzoInitialMusic object in the Problem
+static EnzoInitialMusic * initial_music_()
+{
+  Problem * problem = cello::problem();
+  int index = 0;
+  while (Initial * initial = problem->initial(index++)) {
+    EnzoInitialMusic * initial_music = dynamic_cast<EnzoInitialMusic*>(initial);
+    if (initial_music) return initial_music;
+  }
+  return NULL;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSimulation::p_initial_music_read()
+{
+  // Reader processes are spread evenly across processes
+
+  EnzoInitialMusic * initial = initial_music_();
+
+  const int npe = CkNumPes();
+  const int num_readers = initial->num_readers();
+  const int ipe = CkMyPe();
+  const int reader = (ipe*num_readers) / npe;
+  const bool is_reader = ((reader*npe + num_readers - 1) / num_readers == ipe);
+
+  double data[3] = {0.0, 0.0, 0.0};
+
+  if (is_reader) {
+    Timer timer;
+    timer.start();
+    long long bytes = 0;
+    initial->read_collective(reader,num_readers,&bytes);
+    timer.stop();
+    data[0] = bytes;
+    data[1] = timer.value();
+    data[2] = 1.0;
+  }
+
+  CkCallback callback
+    (CkIndex_EnzoSimulation::r_initial_music_read_end(NULL), thisProxy[0]);
+  contribute(3*sizeof(double),data,CkReduction::sum_double,callback);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSimulation::r_initial_music_read_end(CkReductionMsg * msg)
+{
+  const double * data = (const double *) msg->getData();
+  const double bytes = data[0];
+  const double num_readers = data[2];
+  const double time = (num_readers > 0) ? data[1] / num_readers : 0.0;
+  delete msg;
+
+  cello::monitor()->print
+    ("Initial", "music read %.3f GB with %d readers in %.3f s (%.1f MB/s)",
+     bytes*1e-9, int(num_readers), time,
+     (time > 0.0) ? bytes*1e-6/time : 0.0);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_initial_music_recv
+(int index, int is_particle, int type_data, int n, char * data)
+{
+  EnzoInitialMusic * initial = initial_music_();
+
+  if (is_particle) {
+    initial->apply_particle_data(this,index,type_data,data);
+  } else {
+    initial->apply_field_data(this,index,type_data,data);
+  }
+
+  initial_received();
+}
@@ -32,7 +32,9 @@ public: // interface
   /// CHARM++ migration constructor
   EnzoInitialMusic(CkMigrateMessage *m)
     : Initial (m),
-      level_(0)
+      level_(0),
+      collective_(false),
+      num_readers_(0)
   {  }
 
   /// Destructor
@@ -46,8 +48,37 @@ public: // interface
   virtual void enforce_block
   ( Block * block, const Hierarchy * hierarchy ) throw();
 
+  /// Start collective reads from the root Block if enabled
+  virtual void enforce_block_exit ( Block * block ) throw();
+
+  /// Read this reader's share of all datasets and send Block
+  /// sub-volumes to their Blocks, accumulating bytes read
+  void read_collective (int reader, int num_readers, long long * bytes);
+
+  /// Number of reader processes for collective reads
+  int num_readers() const throw()
+  {
+    const int n = (num_readers_ > 0) ? num_readers_ : CkNumNodes();
+    return std::min(n,CkNumPes());
+  }
+
+  /// Copy Block field data read from file for the index'th field file
+  void apply_field_data
+  (Block * block, int index, int type_data, void * data) const;
+
+  /// Create particles and initialize the attribute from Block data read
+  /// from file for the index'th particle file
+  void apply_particle_data
+  (Block * block, int index, int type_data, void * data);
+
 protected: // functions
 
+  /// Read pencils of Blocks from a dataset for the given reader, and
+  /// send Block sub-volumes to Blocks.  Returns bytes read
+  long long read_collective_dataset_
+  (int reader, int num_readers, int index, bool is_particle,
+   std::string file_name, std::string dataset, std::string coords);
+
   /// If internode throttling enabled, sleep (i_noden * throttle_seconds_stagger_) seconds
   /// before first file open for each pe in node i_node
   void throttle_stagger_();
@@ -110,6 +141,14 @@ protected: // attributes
   /// if internode throttling, delay after each open/close pair
   double throttle_seconds_delay_;
 
+  /// Whether a small set of reader processes read pencils of Blocks
+  /// and send sub-volumes to Blocks, instead of each Block reading
+  bool collective_;
+
+  /// Number of reader processes for collective reads, or 0 for one
+  /// per node
+  int num_readers_;
+
 };
 
 #endif /* ENZO_ENZO_INITIAL_MUSIC_HPP */
@@ -116,10 +116,19 @@ void EnzoInitialPm::uniform_placement_
 
     double t = block->time();
 
-    mask_->evaluate (bitmask, t, 
-                     nx, nx, xv,
-                     ny, ny, yv,
-                     nz, nz, zv);
+    // evaluate the mask per cell only if the Block is partly masked
+
+    const mask_region_type region =
+      mask_->region (t, nx, xv, ny, yv, nz, zv);
+
+    if (region == mask_region_mixed) {
+      mask_->evaluate (bitmask, t, 
+                       nx, nx, xv,
+                       ny, ny, yv,
+                       nz, nz, zv);
+    } else {
+      std::fill_n (bitmask, nx*ny*nz, (region == mask_region_inside));
+    }
 
     // count particles
     int np = 0;
@@ -17,10 +17,12 @@ void EnzoMatrixDiagonal::matvec (int id_y, int id_x, Block * block, int g0) thro
   block->cell_width (&hx_,&hy_,&hz_);
   field.dimensions(0,&mx_,&my_,&mz_);
 
-  enzo_float * X = (enzo_float * ) field.values(id_x);
-  enzo_float * Y = (enzo_float * ) field.values(id_y);
+  ASSERT2 ("EnzoMatrixDiagonal::matvec()",
+	   "Fields %d and %d must have the same precision",
+	   id_y,id_x,(field.precision(id_y) == field.precision(id_x)));
 
-  matvec_(Y,X,g0);
+  matvec ((precision_type)field.precision(id_x),
+	  field.values(id_y),field.values(id_x),g0);
 }
 
 //----------------------------------------------------------------------
@@ -29,7 +31,16 @@ void EnzoMatrixDiagonal::matvec
 (precision_type precision,
  void * y, void * x, int g0) throw()
 {
-  matvec_((enzo_float *)(y),(enzo_float *)(x),g0);
+  if (precision == precision_single) {
+    matvec_((float *)(y),(float *)(x),g0);
+  } else if (precision == precision_double) {
+    matvec_((double *)(y),(double *)(x),g0);
+  } else if (precision == precision_quadruple) {
+    matvec_((long double *)(y),(long double *)(x),g0);
+  } else {
+    ERROR1("EnzoMatrixDiagonal::matvec()",
+	   "precision %d not recognized", precision);
+  }
 }
 
 //----------------------------------------------------------------------
@@ -48,8 +59,8 @@ void EnzoMatrixDiagonal::diagonal (int id_x, Block * block, int g0) throw()
 
 //----------------------------------------------------------------------
 
-// template <class T>
-void EnzoMatrixDiagonal::matvec_ (enzo_float * Y, enzo_float * X, int g0) const throw()
+template <class T>
+void EnzoMatrixDiagonal::matvec_ (T * Y, T * X, int g0) const throw()
 {
   const double d = hx_*hx_;
 
@@ -69,7 +69,8 @@ public: // virtual functions
 
 protected: // functions
 
-  void matvec_ (enzo_float * Y, enzo_float * X, int g0) const throw();
+  template <class T>
+  void matvec_ (T * Y, T * X, int g0) const throw();
 
   void diagonal_ (enzo_float * X, int g0) const throw();
 
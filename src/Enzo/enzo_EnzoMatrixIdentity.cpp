@@ -17,10 +17,12 @@ void EnzoMatrixIdentity::matvec
 
   field.dimensions(0,&mx_,&my_,&mz_);
 
-  enzo_float * X = (enzo_float * ) field.values(id_x);
-  enzo_float * Y = (enzo_float * ) field.values(id_y);
+  ASSERT2 ("EnzoMatrixIdentity::matvec()",
+	   "Fields %d and %d must have the same precision",
+	   id_y,id_x,(field.precision(id_y) == field.precision(id_x)));
 
-  matvec_(Y,X,g0);
+  matvec ((precision_type)field.precision(id_x),
+	  field.values(id_y),field.values(id_x),g0);
 }
 
 //----------------------------------------------------------------------
@@ -29,7 +31,16 @@ void EnzoMatrixIdentity::matvec
 (precision_type precision,
  void * y, void * x, int g0) throw()
 {
-  matvec_((enzo_float *)(y),(enzo_float *)(x),g0);
+  if (precision == precision_single) {
+    matvec_((float *)(y),(float *)(x),g0);
+  } else if (precision == precision_double) {
+    matvec_((double *)(y),(double *)(x),g0);
+  } else if (precision == precision_quadruple) {
+    matvec_((long double *)(y),(long double *)(x),g0);
+  } else {
+    ERROR1("EnzoMatrixIdentity::matvec()",
+	   "precision %d not recognized", precision);
+  }
 }
 
 //----------------------------------------------------------------------
@@ -47,7 +58,8 @@ void EnzoMatrixIdentity::diagonal (int id_x, Block * block, int g0) throw()
 
 //----------------------------------------------------------------------
 
-void EnzoMatrixIdentity::matvec_ (enzo_float * Y, enzo_float * X, int g0) const throw()
+template <class T>
+void EnzoMatrixIdentity::matvec_ (T * Y, T * X, int g0) const throw()
 {
   const int ix0 = (mx_ > 1) ? g0 : 0;
   const int iy0 = (my_ > 1) ? g0 : 0;
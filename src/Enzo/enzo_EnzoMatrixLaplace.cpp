@@ -20,10 +20,12 @@ void EnzoMatrixLaplace::matvec (int i_y, int i_x, Block * block,
   field.dimensions(0,&mx_,&my_,&mz_);
   block->cell_width (&hx_,&hy_,&hz_);
   
-  enzo_float * X = (enzo_float * ) field.values(i_x);
-  enzo_float * Y = (enzo_float * ) field.values(i_y);
-  
-  matvec_(Y,X,g0);
+  ASSERT2 ("EnzoMatrixLaplace::matvec()",
+	   "Fields %d and %d must have the same precision",
+	   i_y,i_x,(field.precision(i_y) == field.precision(i_x)));
+
+  matvec ((precision_type)field.precision(i_x),
+	  field.values(i_y),field.values(i_x),g0);
 }
 
 //----------------------------------------------------------------------
@@ -32,7 +34,16 @@ void EnzoMatrixLaplace::matvec
 (precision_type precision,
  void * y, void * x, int g0) throw()
 {
-  matvec_((enzo_float *)(y),(enzo_float *)(x),g0);
+  if (precision == precision_single) {
+    matvec_((float *)(y),(float *)(x),g0);
+  } else if (precision == precision_double) {
+    matvec_((double *)(y),(double *)(x),g0);
+  } else if (precision == precision_quadruple) {
+    matvec_((long double *)(y),(long double *)(x),g0);
+  } else {
+    ERROR1("EnzoMatrixLaplace::matvec()",
+	   "precision %d not recognized", precision);
+  }
 }
 
 //----------------------------------------------------------------------
@@ -51,14 +62,47 @@ void EnzoMatrixLaplace::diagonal (int i_x, Block * block, int g0) throw()
 
 //----------------------------------------------------------------------
 
+double EnzoMatrixLaplace::eigenvalue
+(const double theta3[3], const double h3[3]) const throw()
+{
+  // Sum of the one-dimensional stencil symbols along each axis
+
+  const int rank = cello::rank();
+
+  double lambda = 0.0;
+
+  for (int axis=0; axis<rank; axis++) {
+
+    const double t = theta3[axis];
+    const double h2 = h3[axis]*h3[axis];
+
+    if (order_ == 2) {
+      lambda += (-2.0 + 2.0*cos(t)) / h2;
+    } else if (order_ == 4) {
+      lambda += (-30.0 + 32.0*cos(t) - 2.0*cos(2.0*t)) / (12.0*h2);
+    } else if (order_ == 6) {
+      lambda += (-2720.0 + 2910.0*cos(t) - 192.0*cos(2.0*t)
+		 + 2.0*cos(3.0*t)) / (1080.0*h2);
+    } else {
+      ERROR1 ("EnzoMatrixLaplace::eigenvalue()",
+	      "Order %d operator is not supported",
+	      order_);
+    }
+  }
+  return lambda;
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
 void EnzoMatrixLaplace::matvec_
-(enzo_float * Y, enzo_float * X, int g0) const throw()
+(T * Y, T * X, int g0) const throw()
 {
   const int idx = 1;
   const int idy = mx_;
   const int idz = mx_*my_;
 
-  const int rank = cello::rank();
+  const int rank = rank_();
 
   if (order_ == 2) {
 
@@ -150,7 +194,7 @@ void EnzoMatrixLaplace::matvec_
 	for   (int iy=g0; iy<my_-g0; iy++) {
 	  for (int ix=g0; ix<mx_-g0; ix++) {
 	    const int i = ix + mx_*(iy + my_*iz);
-	    enzo_float * xp = X + i;
+	    T * xp = X + i;
 	    Y[i] = (c0x*(xp[0]) +
 		    c1x*(xp[-idx] +xp[idx]) +
 		    c2x*(xp[-idx2]+xp[idx2]))
@@ -222,7 +266,7 @@ void EnzoMatrixLaplace::matvec_
 	      +    (c0*(X[i]) +
 		    c1*(X[i-idy] +X[i+idy]) +
 		    c2*(X[i-idy2]+X[i+idy2]) +
-		    c2*(X[i-idy3]+X[i+idy3])) * dy
+		    c3*(X[i-idy3]+X[i+idy3])) * dy
 	      +    (c0*(X[i]) +
 		    c1*(X[i-idz] +X[i+idz]) +
 		    c2*(X[i-idz2]+X[i+idz2]) +
@@ -242,7 +286,7 @@ void EnzoMatrixLaplace::matvec_
 
 void EnzoMatrixLaplace::diagonal_ (enzo_float * X, int g0) const throw()
 {
-  const int rank = cello::rank();
+  const int rank = rank_();
 
   if (order_ == 2) {
     
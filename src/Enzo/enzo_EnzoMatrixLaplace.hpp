@@ -76,6 +76,15 @@ public: // interface
     hy_ = hy;
     hz_ = hz;
   }
+
+  /// Set array dimensions, including ghost zones.  Required for
+  /// lower-level methods that don't have access to the Block
+  void set_dimensions (int mx, int my, int mz)
+  {
+    mx_ = mx;
+    my_ = my;
+    mz_ = mz;
+  }
   
 public: // virtual functions
 
@@ -99,12 +108,26 @@ public: // virtual functions
   virtual int ghost_depth() const throw()
   { return (order_ == 2) ? 1 : ( (order_ == 4) ? 2 : 3); }
 
+  /// Return the order of the operator
+  int order() const throw()
+  { return order_; }
+
+  /// Eigenvalue of the operator on a periodic grid for the Fourier
+  /// mode with phase angle theta3[] per cell and cell widths h3[]
+  double eigenvalue (const double theta3[3], const double h3[3]) const throw();
+
 protected: // functions
 
-  void matvec_ (enzo_float * Y, enzo_float * X, int g0) const throw();
+  template <class T>
+  void matvec_ (T * Y, T * X, int g0) const throw();
 
   void diagonal_ (enzo_float * X, int g0) const throw();
 
+  /// Return the rank implied by the array dimensions, so that
+  /// lower-level methods don't require a Simulation
+  int rank_ () const throw()
+  { return (mz_ > 1) ? 3 : ( (my_ > 1) ? 2 : 1 ); }
+
 protected: // attributes
 
   int mx_, my_, mz_;
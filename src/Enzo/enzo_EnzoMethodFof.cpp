@@ -0,0 +1,772 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoMethodFof.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-19
+/// @brief    Implementation of the EnzoMethodFof class
+///
+/// Block groups are sent to the root process as a byte buffer with
+/// the following layout:
+///
+///     int    ng, nm, nl
+///     int    group   [ng][2]   local id, count
+///     double group   [ng][10]  mass, x0[3], sum m (x-x0)[3], sum m v[3]
+///     int    map     [nm][2]   particle, local group id
+///     int    link    [nl][5]   neighbor index values[3], particle, local group id
+///
+/// where "map" lists the group of each Block particle near the Block
+/// boundary, and "link" lists the group linked to each neighbor
+/// particle.
+
+#include "cello.hpp"
+#include "enzo.hpp"
+
+// #define TRACE_FOF
+
+//----------------------------------------------------------------------
+
+/// Particles received from neighboring Blocks
+struct FofGhosts {
+  std::vector<Index>  index;
+  std::vector<int>    id;
+  std::vector<double> x;
+};
+
+/// Summary of a group of particles
+struct FofGroup {
+  int count;
+  double mass;
+  double x0[3];
+  double mx[3];
+  double mv[3];
+};
+
+//----------------------------------------------------------------------
+
+template <class T>
+static void fof_put_ (std::vector<char> & buffer, const T * values, int n)
+{
+  const size_t i0 = buffer.size();
+  buffer.resize(i0 + n*sizeof(T));
+  if (n > 0) memcpy (&buffer[i0],values,n*sizeof(T));
+}
+
+template <class T>
+static const char * fof_get_ (const char * p, T * values, int n)
+{
+  if (n > 0) memcpy (values,p,n*sizeof(T));
+  return p + n*sizeof(T);
+}
+
+/// Return the root of i in the union-find forest, compressing the path
+static int fof_find_ (std::vector<int> & parent, int i)
+{
+  int r = i;
+  while (parent[r] != r) r = parent[r];
+  while (parent[i] != r) { int j = parent[i]; parent[i] = r; i = j; }
+  return r;
+}
+
+static void fof_union_ (std::vector<int> & parent, int i, int j)
+{
+  i = fof_find_(parent,i);
+  j = fof_find_(parent,j);
+  if (i < j) parent[j] = i;
+  else if (j < i) parent[i] = j;
+}
+
+//----------------------------------------------------------------------
+
+EnzoMethodFof::EnzoMethodFof
+(std::string particle_type,
+ double linking_length,
+ int min_members,
+ std::string file_name) throw()
+  : Method(),
+    particle_type_(particle_type),
+    linking_length_(linking_length),
+    min_members_(min_members),
+    file_name_(file_name),
+    i_sync_(-1),
+    i_data_(-1),
+    catalog_()
+{
+  ScalarDescr * scalar_descr_sync = cello::scalar_descr_sync();
+  i_sync_ = scalar_descr_sync->new_value("method_fof:sync");
+
+  ScalarDescr * scalar_descr_void = cello::scalar_descr_void();
+  i_data_ = scalar_descr_void->new_value("method_fof:ghosts");
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodFof::pup (PUP::er &p)
+{
+  // NOTE: change this function whenever attributes change
+
+  TRACEPUP;
+
+  Method::pup(p);
+
+  p | particle_type_;
+  p | linking_length_;
+  p | min_members_;
+  p | file_name_;
+  p | i_sync_;
+  p | i_data_;
+
+  // NOTE: catalog_ not packed since catalogs are written before
+  // load balancing or checkpointing
+}
+
+//----------------------------------------------------------------------
+
+double EnzoMethodFof::linking_length_code_ () const throw()
+{
+  double xm,ym,zm,xp,yp,zp;
+  cello::hierarchy()->lower(&xm,&ym,&zm);
+  cello::hierarchy()->upper(&xp,&yp,&zp);
+  return linking_length_ * (xp - xm) / cello::config()->mesh_root_size[0];
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodFof::compute ( Block * block) throw()
+{
+  EnzoBlock * enzo_block = enzo::block(block);
+
+  if (! block->is_leaf()) {
+
+    // Non-leaf Blocks only take part in the reduction
+
+    int count = 0;
+    CkCallback callback (CkIndex_EnzoBlock::r_method_fof_end(NULL),
+			 enzo_block->proxy_array());
+    enzo_block->contribute(sizeof(int),&count,CkReduction::sum_int,callback);
+    return;
+  }
+
+  Particle particle = block->data()->particle();
+
+  const int it = particle.type_index(particle_type_);
+  const int rank = cello::rank();
+  const double b = linking_length_code_();
+
+  double bm3[3],bp3[3],dm3[3],dp3[3];
+  block->lower(bm3,bm3+1,bm3+2);
+  block->upper(bp3,bp3+1,bp3+2);
+  cello::hierarchy()->lower(dm3,dm3+1,dm3+2);
+  cello::hierarchy()->upper(dp3,dp3+1,dp3+2);
+
+  bool periodic[3];
+  block->periodicity(periodic);
+
+  // Gather particle positions
+
+  std::vector<double> x3[3];
+  const int np = particle.num_particles(it);
+  for (int axis=0; axis<3; axis++) x3[axis].resize(np,0.0);
+  for (int ib=0, i0=0; ib<particle.num_batches(it); ib++) {
+    particle.position(it,ib,
+		      x3[0].data()+i0,
+		      (rank >= 2) ? x3[1].data()+i0 : NULL,
+		      (rank >= 3) ? x3[2].data()+i0 : NULL);
+    i0 += particle.num_particles(it,ib);
+  }
+
+  // Send particles within the linking length of each neighbor
+
+  const int min_level = cello::config()->mesh_min_level;
+
+  ItNeighbor it_neighbor =
+    block->it_neighbor(0,block->index(),neighbor_leaf,min_level,0);
+
+  int of3[3];
+  int num_neighbors = 0;
+
+  while (it_neighbor.next(of3)) {
+
+    ++num_neighbors;
+
+    // Shift positions across periodic domain boundaries
+
+    double shift3[3] = {0.0, 0.0, 0.0};
+    for (int axis=0; axis<rank; axis++) {
+      const double h = 0.5*b;
+      if (periodic[axis]) {
+	if (of3[axis] == +1 && bp3[axis] > dp3[axis] - h)
+	  shift3[axis] = dm3[axis] - dp3[axis];
+	if (of3[axis] == -1 && bm3[axis] < dm3[axis] + h)
+	  shift3[axis] = dp3[axis] - dm3[axis];
+      }
+    }
+
+    std::vector<int> ids;
+    std::vector<double> pos;
+    for (int ip=0; ip<np; ip++) {
+      bool in_face = true;
+      for (int axis=0; axis<rank; axis++) {
+	const double x = x3[axis][ip];
+	if (of3[axis] == -1 && ! (x < bm3[axis] + b)) in_face = false;
+	if (of3[axis] == +1 && ! (x > bp3[axis] - b)) in_face = false;
+      }
+      if (in_face) {
+	ids.push_back(ip);
+	for (int axis=0; axis<3; axis++) {
+	  pos.push_back(x3[axis][ip] + shift3[axis]);
+	}
+      }
+    }
+
+    enzo::block_array()[it_neighbor.index()].p_method_fof_ghost
+      (block->index(), ids.size(), ids.data(), pos.data());
+  }
+
+  // Count self and neighbor messages
+
+  Sync * sync = psync_(block);
+  sync->set_stop(num_neighbors + 1);
+  if (sync->next()) compute_groups_(enzo_block);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_method_fof_ghost
+(Index index, int n, int * ids, double * pos)
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+  EnzoMethodFof * method =
+    static_cast<EnzoMethodFof *> (cello::problem()->method("fof"));
+  method->ghost_recv(this,index,n,ids,pos);
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodFof::ghost_recv
+(EnzoBlock * enzo_block, Index index,
+ int n, const int * ids, const double * pos) throw()
+{
+  // Save neighbor particles, which may arrive before compute()
+
+  FofGhosts ** pghosts = (FofGhosts **) pdata_(enzo_block);
+
+  if (*pghosts == NULL) *pghosts = new FofGhosts;
+
+  FofGhosts * ghosts = *pghosts;
+
+  for (int i=0; i<n; i++) {
+    ghosts->index.push_back(index);
+    ghosts->id.push_back(ids[i]);
+    ghosts->x.push_back(pos[3*i+0]);
+    ghosts->x.push_back(pos[3*i+1]);
+    ghosts->x.push_back(pos[3*i+2]);
+  }
+
+  if (psync_(enzo_block)->next()) compute_groups_(enzo_block);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodFof::compute_groups_ (EnzoBlock * enzo_block) throw()
+{
+  Block * block = enzo_block;
+
+  Particle particle = block->data()->particle();
+
+  const int it = particle.type_index(particle_type_);
+  const int rank = cello::rank();
+  const double b = linking_length_code_();
+
+  double bm3[3],bp3[3];
+  block->lower(bm3,bm3+1,bm3+2);
+  block->upper(bp3,bp3+1,bp3+2);
+
+  // Particle mass: "mass" attribute if any, else "mass" constant if
+  // any, else 1
+
+  const int ia_m = particle.attribute_index(it,"mass");
+  const int ic_m = particle.constant_index(it,"mass");
+  double mass_constant = 1.0;
+  if (ia_m < 0 && ic_m >= 0) {
+    mass_constant = *((enzo_float *)particle.constant_value(it,ic_m));
+  }
+
+  // Gather Block particle positions, velocities, and masses
+
+  const int np = particle.num_particles(it);
+
+  std::vector<double> x3[3], v3[3], m(np,mass_constant);
+  for (int axis=0; axis<3; axis++) {
+    x3[axis].resize(np,0.0);
+    v3[axis].resize(np,0.0);
+  }
+
+  for (int ib=0, i0=0; ib<particle.num_batches(it); ib++) {
+    const int npb = particle.num_particles(it,ib);
+    particle.position(it,ib,
+		      x3[0].data()+i0,
+		      (rank >= 2) ? x3[1].data()+i0 : NULL,
+		      (rank >= 3) ? x3[2].data()+i0 : NULL);
+    particle.velocity(it,ib,
+		      v3[0].data()+i0,
+		      (rank >= 2) ? v3[1].data()+i0 : NULL,
+		      (rank >= 3) ? v3[2].data()+i0 : NULL);
+    if (ia_m >= 0) {
+      const int dm = particle.stride(it,ia_m);
+      const char * ma = particle.attribute_array(it,ia_m,ib);
+      for (int ip=0; ip<npb; ip++) {
+	m[i0+ip] = (particle.attribute_bytes(it,ia_m) == sizeof(float)) ?
+	  ((const float *) ma)[ip*dm] : ((const double *) ma)[ip*dm];
+      }
+    }
+    i0 += npb;
+  }
+
+  // Append neighbor particles within the linking length of the Block
+
+  FofGhosts ** pghosts = (FofGhosts **) pdata_(block);
+  FofGhosts * ghosts = *pghosts;
+  const int ng_all = ghosts ? ghosts->id.size() : 0;
+
+  std::vector<int> ghost_list;
+  for (int ig=0; ig<ng_all; ig++) {
+    bool in_range = true;
+    for (int axis=0; axis<rank; axis++) {
+      const double x = ghosts->x[3*ig+axis];
+      if (x < bm3[axis] - b || x > bp3[axis] + b) in_range = false;
+    }
+    if (in_range) ghost_list.push_back(ig);
+  }
+  const int ng = ghost_list.size();
+  const int n = np + ng;
+
+  auto position = [&] (int i, int axis) -> double
+    { return (i < np) ? x3[axis][i] : ghosts->x[3*ghost_list[i-np]+axis]; };
+
+  // Build cell list with cell width at least the linking length,
+  // coarsened to limit the number of cells to O(n)
+
+  int nc3[3] = {1,1,1};
+  double cm3[3],cw3[3];
+  for (int axis=0; axis<3; axis++) {
+    cm3[axis] = bm3[axis] - b;
+    cw3[axis] = 1.0;
+    if (axis < rank) {
+      const double w = bp3[axis] - bm3[axis] + 2*b;
+      nc3[axis] = std::max(1,int(w / b));
+    }
+  }
+  while ((double)nc3[0]*nc3[1]*nc3[2] > 2.0*n + 8 &&
+	 (nc3[0] > 1 || nc3[1] > 1 || nc3[2] > 1)) {
+    for (int axis=0; axis<3; axis++) nc3[axis] = (nc3[axis]+1)/2;
+  }
+  for (int axis=0; axis<rank; axis++) {
+    cw3[axis] = (bp3[axis] - bm3[axis] + 2*b) / nc3[axis];
+  }
+
+  const int nc = nc3[0]*nc3[1]*nc3[2];
+  std::vector<int> head(nc,-1), next(n,-1), cell(3*n,0);
+
+  for (int i=0; i<n; i++) {
+    int ic = 0;
+    for (int axis=rank-1; axis>=0; axis--) {
+      int k = (position(i,axis) - cm3[axis]) / cw3[axis];
+      k = std::max(0,std::min(nc3[axis]-1,k));
+      cell[3*i+axis] = k;
+      ic = ic*nc3[axis] + k;
+    }
+    next[i] = head[ic];
+    head[ic] = i;
+  }
+
+  // Link particles in the same or adjacent cells
+
+  std::vector<int> parent(n);
+  for (int i=0; i<n; i++) parent[i] = i;
+
+  const double b2 = b*b;
+  const int kx = 1;
+  const int ky = (rank >= 2) ? 1 : 0;
+  const int kz = (rank >= 3) ? 1 : 0;
+
+  for (int i=0; i<n; i++) {
+    const int cx = cell[3*i+0];
+    const int cy = cell[3*i+1];
+    const int cz = cell[3*i+2];
+    for (int iz=std::max(0,cz-kz); iz<=std::min(nc3[2]-1,cz+kz); iz++) {
+      for (int iy=std::max(0,cy-ky); iy<=std::min(nc3[1]-1,cy+ky); iy++) {
+	for (int ix=std::max(0,cx-kx); ix<=std::min(nc3[0]-1,cx+kx); ix++) {
+	  const int ic = ix + nc3[0]*(iy + nc3[1]*iz);
+	  for (int j=head[ic]; j>i; j=next[j]) {
+	    double r2 = 0.0;
+	    for (int axis=0; axis<rank; axis++) {
+	      const double d = position(i,axis) - position(j,axis);
+	      r2 += d*d;
+	    }
+	    if (r2 <= b2) fof_union_(parent,i,j);
+	  }
+	}
+      }
+    }
+  }
+
+  // Number groups containing Block particles and accumulate their
+  // summaries
+
+  std::vector<int> group_of_root(n,-1);
+  std::vector<FofGroup> groups;
+  std::vector<char> is_open;
+
+  for (int ip=0; ip<np; ip++) {
+    const int r = fof_find_(parent,ip);
+    int & g = group_of_root[r];
+    if (g == -1) {
+      g = groups.size();
+      FofGroup group;
+      group.count = 0;
+      group.mass  = 0.0;
+      for (int axis=0; axis<3; axis++) {
+	group.x0[axis] = x3[axis][ip];
+	group.mx[axis] = 0.0;
+	group.mv[axis] = 0.0;
+      }
+      groups.push_back(group);
+      is_open.push_back(0);
+    }
+    FofGroup & group = groups[g];
+    group.count ++;
+    group.mass += m[ip];
+    for (int axis=0; axis<3; axis++) {
+      group.mx[axis] += m[ip]*(x3[axis][ip] - group.x0[axis]);
+      group.mv[axis] += m[ip]*v3[axis][ip];
+    }
+  }
+
+  // Groups of Block particles near the boundary
+
+  std::vector<int> maps;
+  for (int ip=0; ip<np; ip++) {
+    bool is_boundary = false;
+    for (int axis=0; axis<rank; axis++) {
+      const double x = x3[axis][ip];
+      if (x < bm3[axis] + b || x > bp3[axis] - b) is_boundary = true;
+    }
+    if (is_boundary) {
+      const int g = group_of_root[fof_find_(parent,ip)];
+      maps.push_back(ip);
+      maps.push_back(g);
+      is_open[g] = 1;
+    }
+  }
+
+  // Groups linked to neighbor particles
+
+  std::vector<int> links;
+  for (int k=0; k<ng; k++) {
+    const int g = group_of_root[fof_find_(parent,np+k)];
+    if (g >= 0) {
+      const int ig = ghost_list[k];
+      int v3[3];
+      ghosts->index[ig].values(v3);
+      links.push_back(v3[0]);
+      links.push_back(v3[1]);
+      links.push_back(v3[2]);
+      links.push_back(ghosts->id[ig]);
+      links.push_back(g);
+      is_open[g] = 1;
+    }
+  }
+
+  // Pack groups that are halos or may be merged with neighbor groups
+
+  std::vector<int>    group_int;
+  std::vector<double> group_double;
+  for (size_t g=0; g<groups.size(); g++) {
+    const FofGroup & group = groups[g];
+    if (is_open[g] || group.count >= min_members_) {
+      group_int.push_back(g);
+      group_int.push_back(group.count);
+      group_double.push_back(group.mass);
+      for (int axis=0; axis<3; axis++) group_double.push_back(group.x0[axis]);
+      for (int axis=0; axis<3; axis++) group_double.push_back(group.mx[axis]);
+      for (int axis=0; axis<3; axis++) group_double.push_back(group.mv[axis]);
+    }
+  }
+
+  const int nlen[3] = { int(group_int.size()/2),
+			int(maps.size()/2),
+			int(links.size()/5) };
+
+  std::vector<char> buffer;
+  fof_put_(buffer,nlen,3);
+  fof_put_(buffer,group_int.data(),group_int.size());
+  fof_put_(buffer,group_double.data(),group_double.size());
+  fof_put_(buffer,maps.data(),maps.size());
+  fof_put_(buffer,links.data(),links.size());
+
+  int v3[3];
+  block->index().values(v3);
+  std::vector<char> message;
+  fof_put_(message,v3,3);
+  message.insert(message.end(),buffer.begin(),buffer.end());
+
+#ifdef TRACE_FOF
+  CkPrintf ("%d TRACE_FOF %s particles %d ghosts %d groups %d sent %d\n",
+	    CkMyPe(),block->name().c_str(),np,ng,int(groups.size()),nlen[0]);
+#endif
+
+  proxy_enzo_simulation[0].p_method_fof_catalog
+    (block->cycle(), block->time(), message.size(), message.data());
+
+  // Clear neighbor particles and Sync for the next call
+
+  delete ghosts;
+  *pghosts = NULL;
+  psync_(block)->reset();
+
+  int count = 1;
+  CkCallback callback (CkIndex_EnzoBlock::r_method_fof_end(NULL),
+		       enzo_block->proxy_array());
+  enzo_block->contribute(sizeof(int),&count,CkReduction::sum_int,callback);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::r_method_fof_end(CkReductionMsg * msg)
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+  method()->compute_resume (this,msg);
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodFof::compute_resume
+(Block * block, CkReductionMsg * msg) throw()
+{
+  const int count = *((int *)msg->getData());
+  delete msg;
+
+  // Root Block sends the number of leaf Blocks to the root process
+
+  if (block->index().is_root() && block->level() == 0) {
+    proxy_enzo_simulation[0].p_method_fof_count(block->cycle(),count);
+  }
+
+  block->compute_done();
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSimulation::p_method_fof_catalog
+(int cycle, double time, int n, char * buffer)
+{
+  EnzoMethodFof * method =
+    static_cast<EnzoMethodFof *> (cello::problem()->method("fof"));
+  method->catalog_recv(cycle,time,n,buffer);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSimulation::p_method_fof_count (int cycle, int count)
+{
+  EnzoMethodFof * method =
+    static_cast<EnzoMethodFof *> (cello::problem()->method("fof"));
+  method->catalog_count(cycle,count);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodFof::catalog_recv
+(int cycle, double time, int n, const char * buffer) throw()
+{
+  Catalog & catalog = catalog_[cycle];
+  catalog.time = time;
+  catalog.buffers.push_back(std::vector<char>(buffer,buffer+n));
+  if (catalog_ready_(cycle)) catalog_write_(cycle);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodFof::catalog_count (int cycle, int count) throw()
+{
+  catalog_[cycle].count = count;
+  if (catalog_ready_(cycle)) catalog_write_(cycle);
+}
+
+//----------------------------------------------------------------------
+
+bool EnzoMethodFof::catalog_ready_ (int cycle) const throw()
+{
+  auto it = catalog_.find(cycle);
+  return (it != catalog_.end() &&
+	  it->second.count == int(it->second.buffers.size()));
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodFof::catalog_write_ (int cycle) throw()
+{
+  Catalog & catalog = catalog_[cycle];
+
+  int px,py,pz;
+  cello::hierarchy()->get_periodicity(&px,&py,&pz);
+  const int periodic[3] = {px,py,pz};
+  double dm3[3],dp3[3];
+  cello::hierarchy()->lower(dm3,dm3+1,dm3+2);
+  cello::hierarchy()->upper(dp3,dp3+1,dp3+2);
+
+  // Read Block groups, boundary particle groups, and links
+
+  typedef std::pair<Index,int> Key;
+
+  std::vector<FofGroup> groups;
+  std::map<Key,int> group_id;
+  std::map<Key,int> particle_group;
+  std::vector< std::pair<Key,int> > links;
+
+  for (size_t ib=0; ib<catalog.buffers.size(); ib++) {
+
+    const char * p = catalog.buffers[ib].data();
+
+    int v3[3], nlen[3];
+    p = fof_get_(p,v3,3);
+    p = fof_get_(p,nlen,3);
+    Index index;
+    index.set_values(v3);
+
+    const int ng = nlen[0];
+    const int nm = nlen[1];
+    const int nl = nlen[2];
+
+    std::vector<int> group_int(2*ng), maps(2*nm), link(5*nl);
+    std::vector<double> group_double(10*ng);
+    p = fof_get_(p,group_int.data(),2*ng);
+    p = fof_get_(p,group_double.data(),10*ng);
+    p = fof_get_(p,maps.data(),2*nm);
+    p = fof_get_(p,link.data(),5*nl);
+
+    for (int k=0; k<ng; k++) {
+      FofGroup group;
+      group.count = group_int[2*k+1];
+      group.mass  = group_double[10*k];
+      for (int axis=0; axis<3; axis++) {
+	group.x0[axis] = group_double[10*k+1+axis];
+	group.mx[axis] = group_double[10*k+4+axis];
+	group.mv[axis] = group_double[10*k+7+axis];
+      }
+      group_id[Key(index,group_int[2*k])] = groups.size();
+      groups.push_back(group);
+    }
+    for (int k=0; k<nm; k++) {
+      particle_group[Key(index,maps[2*k])] = group_id[Key(index,maps[2*k+1])];
+    }
+    for (int k=0; k<nl; k++) {
+      Index index_owner;
+      index_owner.set_values(&link[5*k]);
+      links.push_back(std::pair<Key,int>
+		      (Key(index_owner,link[5*k+3]),
+		       group_id[Key(index,link[5*k+4])]));
+    }
+  }
+
+  // Merge groups linked across Block boundaries
+
+  const int num_groups = groups.size();
+  std::vector<int> parent(num_groups);
+  for (int i=0; i<num_groups; i++) parent[i] = i;
+
+  for (size_t k=0; k<links.size(); k++) {
+    auto it = particle_group.find(links[k].first);
+    if (it != particle_group.end()) {
+      fof_union_(parent,it->second,links[k].second);
+    }
+  }
+
+  // Combine group summaries, using the nearest periodic image of
+  // each group's reference position
+
+  std::vector<FofGroup> halos;
+  std::vector<int> halo_of_root(num_groups,-1);
+  for (int i=0; i<num_groups; i++) {
+    const int r = fof_find_(parent,i);
+    if (halo_of_root[r] == -1) {
+      halo_of_root[r] = halos.size();
+      FofGroup halo;
+      halo.count = 0;
+      halo.mass = 0.0;
+      for (int axis=0; axis<3; axis++) {
+	halo.x0[axis] = groups[r].x0[axis];
+	halo.mx[axis] = 0.0;
+	halo.mv[axis] = 0.0;
+      }
+      halos.push_back(halo);
+    }
+    FofGroup & halo = halos[halo_of_root[r]];
+    const FofGroup & group = groups[i];
+    halo.count += group.count;
+    halo.mass  += group.mass;
+    for (int axis=0; axis<3; axis++) {
+      double dx = group.x0[axis] - halo.x0[axis];
+      const double lx = dp3[axis] - dm3[axis];
+      if (periodic[axis]) {
+	if (dx >  0.5*lx) dx -= lx;
+	if (dx < -0.5*lx) dx += lx;
+      }
+      halo.mx[axis] += group.mx[axis] + group.mass*dx;
+      halo.mv[axis] += group.mv[axis];
+    }
+  }
+
+  // Write halos, in order of decreasing mass
+
+  std::vector<int> order;
+  for (size_t h=0; h<halos.size(); h++) {
+    if (halos[h].count >= min_members_) order.push_back(h);
+  }
+  std::sort(order.begin(),order.end(),
+	    [&] (int a, int b) { return halos[a].mass > halos[b].mass; });
+
+  char file_name[256];
+  snprintf (file_name,sizeof(file_name),file_name_.c_str(),cycle);
+
+  FILE * fp = fopen (file_name,"w");
+
+  if (fp == NULL) {
+
+    WARNING1 ("EnzoMethodFof::catalog_write_()",
+	      "Cannot open halo catalog file %s for writing",
+	      file_name);
+
+  } else {
+
+    fprintf (fp,"# cycle %d time %g halos %d linking_length %g min_members %d\n",
+	     cycle,catalog.time,int(order.size()),linking_length_,min_members_);
+    fprintf (fp,"# id count mass x y z vx vy vz\n");
+
+    for (size_t k=0; k<order.size(); k++) {
+      const FofGroup & halo = halos[order[k]];
+      double x3[3],v3[3];
+      for (int axis=0; axis<3; axis++) {
+	x3[axis] = halo.x0[axis] + halo.mx[axis] / halo.mass;
+	const double lx = dp3[axis] - dm3[axis];
+	if (periodic[axis]) {
+	  if (x3[axis] <  dm3[axis]) x3[axis] += lx;
+	  if (x3[axis] >= dp3[axis]) x3[axis] -= lx;
+	}
+	v3[axis] = halo.mv[axis] / halo.mass;
+      }
+      fprintf (fp,"%d %d %.8g %.10g %.10g %.10g %.8g %.8g %.8g\n",
+	       int(k),halo.count,halo.mass,
+	       x3[0],x3[1],x3[2],v3[0],v3[1],v3[2]);
+    }
+
+    fclose (fp);
+  }
+
+  cello::monitor()->print ("Method","%s wrote %d halos to %s",
+			   name().c_str(),int(order.size()),file_name);
+
+  catalog_.erase(cycle);
+}
@@ -0,0 +1,147 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoMethodFof.hpp
+/// @author   agent (agent@local)
+/// @date     2026-10-19
+/// @brief    [\ref Enzo] Declaration of the EnzoMethodFof class
+///
+/// In-situ friends-of-friends halo finder for particles
+
+#ifndef ENZO_ENZO_METHOD_FOF_HPP
+#define ENZO_ENZO_METHOD_FOF_HPP
+
+class EnzoMethodFof : public Method {
+
+  /// @class    EnzoMethodFof
+  /// @ingroup  Enzo
+  /// @brief [\ref Enzo] Friends-of-friends halo finder that writes a
+  /// halo catalog instead of particle data
+  ///
+  /// @details Each leaf Block sends the particles lying within one
+  /// linking length of its faces, edges, and corners to its leaf
+  /// neighbors, then links its own and received particles using a
+  /// cell list.  Blocks send the summaries of their local groups,
+  /// together with the links between local groups and neighbor
+  /// particles, to the root process, which merges groups across
+  /// Blocks and writes the catalog of halos with at least
+  /// min_members particles.
+
+public: // interface
+
+  /// Create a new EnzoMethodFof object
+  EnzoMethodFof (std::string particle_type,
+		 double linking_length,
+		 int min_members,
+		 std::string file_name) throw();
+
+  /// Destructor
+  virtual ~EnzoMethodFof() throw()
+  {}
+
+  /// Charm++ PUP::able declarations
+  PUPable_decl(EnzoMethodFof);
+
+  /// Charm++ PUP::able migration constructor
+  EnzoMethodFof (CkMigrateMessage *m)
+    : Method (m),
+      particle_type_(""),
+      linking_length_(0.0),
+      min_members_(0),
+      file_name_(""),
+      i_sync_(-1),
+      i_data_(-1),
+      catalog_()
+  { }
+
+  /// CHARM++ Pack / Unpack function
+  void pup (PUP::er &p);
+
+public: // virtual functions
+
+  /// Find groups in the Block and send them to the root process
+  virtual void compute ( Block * block) throw();
+
+  /// Return the name of this EnzoMethodFof
+  virtual std::string name () throw ()
+  { return "fof"; }
+
+  /// Complete the Method after all Blocks have sent their groups
+  virtual void compute_resume ( Block * block,
+				CkReductionMsg * msg) throw();
+
+public: // methods
+
+  /// Receive particles from a neighboring Block
+  void ghost_recv (EnzoBlock * enzo_block, Index index,
+		   int n, const int * ids, const double * pos) throw();
+
+  /// Receive the groups of a Block on the root process
+  void catalog_recv (int cycle, double time, int n, const char * buffer) throw();
+
+  /// Receive the number of leaf Blocks on the root process
+  void catalog_count (int cycle, int count) throw();
+
+protected: // methods
+
+  /// Link own and neighbor particles and send groups to the root
+  void compute_groups_ (EnzoBlock * enzo_block) throw();
+
+  /// Merge Block groups and write the halo catalog for the cycle
+  void catalog_write_ (int cycle) throw();
+
+  /// Whether all Block groups for the cycle have been received
+  bool catalog_ready_ (int cycle) const throw();
+
+  /// Return the linking length in code units
+  double linking_length_code_ () const throw();
+
+  /// Access the Sync counting received neighbor messages
+  Sync * psync_(Block * block)
+  {
+    ScalarData<Sync> * scalar_data = block->data()->scalar_data_sync();
+    ScalarDescr *      scalar_descr = cello::scalar_descr_sync();
+    return scalar_data->value(scalar_descr,i_sync_);
+  }
+
+  /// Access the received neighbor particles of the Block
+  void ** pdata_(Block * block)
+  {
+    ScalarData<void *> * scalar_data = block->data()->scalar_data_void();
+    ScalarDescr *        scalar_descr = cello::scalar_descr_void();
+    return scalar_data->value(scalar_descr,i_data_);
+  }
+
+protected: // attributes
+
+  /// Particle type to find halos in
+  std::string particle_type_;
+
+  /// Linking length relative to the root-level cell width
+  double linking_length_;
+
+  /// Minimum number of particles in a halo
+  int min_members_;
+
+  /// Catalog file name format, with the cycle as argument
+  std::string file_name_;
+
+  /// Index of the Sync Scalar for counting neighbor messages
+  int i_sync_;
+
+  /// Index of the void Scalar for received neighbor particles
+  int i_data_;
+
+  /// Block group data received on the root process for each cycle
+  struct Catalog {
+    Catalog() : count(-1), time(0.0), buffers() {}
+    int count;
+    double time;
+    std::vector< std::vector<char> > buffers;
+  };
+
+  /// Catalogs in progress on the root process (not packed)
+  std::map<int,Catalog> catalog_;
+
+};
+
+#endif /* ENZO_ENZO_METHOD_FOF_HPP */
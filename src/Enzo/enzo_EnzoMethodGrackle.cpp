@@ -513,8 +513,7 @@ double EnzoMethodGrackle::timestep ( Block * block ) const throw()
     enzo_float * cooling_time = field.is_field("cooling_time") ?
                         (enzo_float *) field.values("cooling_time") : NULL;
 
-    // make it if it doesn't exist
-    bool delete_cooling_time = false;
+    // use a work array if it doesn't exist
     int gx,gy,gz;
     field.ghost_depth (0,&gx,&gy,&gz);
 
@@ -528,8 +527,8 @@ double EnzoMethodGrackle::timestep ( Block * block ) const throw()
     int size = ngx*ngy*ngz;
 
     if (!(cooling_time)){
-      cooling_time = new enzo_float [size];
-      delete_cooling_time = true;
+      cooling_time = Scratch::instance()->array<enzo_float>
+        (enzo_scratch_grackle_cooling_time,size);
     }
 
     calculate_cooling_time(block, cooling_time, NULL, NULL, 0);
@@ -545,10 +544,6 @@ double EnzoMethodGrackle::timestep ( Block * block ) const throw()
         }
       }
     }
-
-    if (delete_cooling_time){
-      delete [] cooling_time;
-    }
   }
 #endif
 
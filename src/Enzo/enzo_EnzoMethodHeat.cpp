@@ -47,9 +47,37 @@ void EnzoMethodHeat::compute ( Block * block) throw()
 
     Field field = block->data()->field();
 
-    enzo_float * T = (enzo_float *) field.values ("temperature");
+    const int id_temp = field.field_id ("temperature");
 
-    compute_ (block,T);
+    if (field.history_mode(id_temp) == history_swap) {
+
+      // write new values into the next history buffer, then make it
+      // current without copying
+
+      const enzo_float * T = (enzo_float *) field.values (id_temp);
+      enzo_float * T_new   = (enzo_float *) field.values_next (id_temp);
+
+      compute_all_ (block,T,T_new);
+
+      field.swap_history (id_temp);
+
+    } else {
+
+      // copy current values since they are updated in place
+
+      enzo_float * T = (enzo_float *) field.values (id_temp);
+
+      int mx,my,mz;
+      field.dimensions (id_temp,&mx,&my,&mz);
+      const int m = mx*my*mz;
+
+      enzo_float * T_old = new enzo_float [m];
+      for (int i=0; i<m; i++) T_old[i] = T[i];
+
+      compute_all_ (block,T_old,T);
+
+      delete [] T_old;
+    }
   }
 
   block->compute_done();
@@ -57,6 +85,91 @@ void EnzoMethodHeat::compute ( Block * block) throw()
 
 //----------------------------------------------------------------------
 
+bool EnzoMethodHeat::overlap_refresh () const throw()
+{
+  // interior values cannot be updated in place while boundary cells
+  // still need the old values
+
+  const FieldDescr * field_descr = cello::field_descr();
+  const int id_temp = field_descr->field_id ("temperature");
+  return (field_descr->history_mode(id_temp) == history_swap);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodHeat::compute_interior ( Block * block) throw()
+{
+  Field field = block->data()->field();
+
+  const int id_temp = field.field_id ("temperature");
+
+  const enzo_float * T = (enzo_float *) field.values (id_temp);
+  enzo_float * T_new   = (enzo_float *) field.values_next (id_temp);
+
+  int mx,my,mz;
+  int gx,gy,gz;
+  field.dimensions  (id_temp,&mx,&my,&mz);
+  field.ghost_depth (id_temp,&gx,&gy,&gz);
+
+  // cells at least one cell away from ghost zones along each axis
+
+  const int rank = ((mz == 1) ? ((my == 1) ? 1 : 2) : 3);
+
+  const int ix0 =             gx+1;
+  const int iy0 = (rank < 2) ? 0 : gy+1;
+  const int iz0 = (rank < 3) ? 0 : gz+1;
+  const int ix1 =             mx-gx-1;
+  const int iy1 = (rank < 2) ? 1 : my-gy-1;
+  const int iz1 = (rank < 3) ? 1 : mz-gz-1;
+
+  compute_ (block,T,T_new,ix0,ix1,iy0,iy1,iz0,iz1);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodHeat::compute_boundary ( Block * block) throw()
+{
+  Field field = block->data()->field();
+
+  const int id_temp = field.field_id ("temperature");
+
+  const enzo_float * T = (enzo_float *) field.values (id_temp);
+  enzo_float * T_new   = (enzo_float *) field.values_next (id_temp);
+
+  int mx,my,mz;
+  int gx,gy,gz;
+  field.dimensions  (id_temp,&mx,&my,&mz);
+  field.ghost_depth (id_temp,&gx,&gy,&gz);
+
+  // one-cell-thick layers of cells adjacent to ghost zones, not
+  // updated by compute_interior(); layers may overlap if the Block
+  // is thin, which is harmless since new values only depend on T
+
+  const int rank = ((mz == 1) ? ((my == 1) ? 1 : 2) : 3);
+
+  const int iy0 = (rank < 2) ? 0 : gy+1;
+  const int iz0 = (rank < 3) ? 0 : gz+1;
+  const int iy1 = (rank < 2) ? 1 : my-gy-1;
+  const int iz1 = (rank < 3) ? 1 : mz-gz-1;
+
+  if (rank >= 3) {
+    compute_ (block,T,T_new, gx,mx-gx, gy,my-gy, gz,gz+1);
+    compute_ (block,T,T_new, gx,mx-gx, gy,my-gy, mz-gz-1,mz-gz);
+  }
+  if (rank >= 2) {
+    compute_ (block,T,T_new, gx,mx-gx, gy,gy+1, iz0,iz1);
+    compute_ (block,T,T_new, gx,mx-gx, my-gy-1,my-gy, iz0,iz1);
+  }
+  compute_ (block,T,T_new, gx,gx+1, iy0,iy1, iz0,iz1);
+  compute_ (block,T,T_new, mx-gx-1,mx-gx, iy0,iy1, iz0,iz1);
+
+  field.swap_history (id_temp);
+
+  block->compute_done();
+}
+
+//----------------------------------------------------------------------
+
 double EnzoMethodHeat::timestep ( Block * block ) const throw()
 {
   // initialize_(block);
@@ -83,7 +196,27 @@ double EnzoMethodHeat::timestep ( Block * block ) const throw()
 
 //======================================================================
 
-void EnzoMethodHeat::compute_ (Block * block,enzo_float * Unew) const throw()
+void EnzoMethodHeat::compute_all_
+(Block * block, const enzo_float * U, enzo_float * Unew) const throw()
+{
+  Field field = block->data()->field();
+
+  const int id_temp = field.field_id ("temperature");
+
+  int mx,my,mz;
+  int gx,gy,gz;
+
+  field.dimensions  (id_temp,&mx,&my,&mz);
+  field.ghost_depth (id_temp,&gx,&gy,&gz);
+
+  compute_ (block,U,Unew, gx,mx-gx, gy,my-gy, gz,mz-gz);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodHeat::compute_
+(Block * block, const enzo_float * U, enzo_float * Unew,
+ int ix0, int ix1, int iy0, int iy1, int iz0, int iz1) const throw()
 {
   Data * data = block->data();
   Field field   =      data->field();
@@ -91,10 +224,8 @@ void EnzoMethodHeat::compute_ (Block * block,enzo_float * Unew) const throw()
   const int id_temp_ = field.field_id ("temperature");
 
   int mx,my,mz;
-  int gx,gy,gz;
 
   field.dimensions  (id_temp_,&mx,&my,&mz);
-  field.ghost_depth (id_temp_,&gx,&gy,&gz);
 
   // Initialize array increments
   const int idx = 1;
@@ -110,18 +241,13 @@ void EnzoMethodHeat::compute_ (Block * block,enzo_float * Unew) const throw()
   double dyi = 1.0/(hy*hy);
   double dzi = 1.0/(hz*hz);
 
-  const int m = mx*my*mz;
-
   const int rank = ((mz == 1) ? ((my == 1) ? 1 : 2) : 3);
 
   const double dt = timestep(block);
 
-  enzo_float * U = new enzo_float [m];
-  for (int i=0; i<m; i++) U[i]=Unew[i];
-
   if (rank == 1) {
 
-    for (int ix=gx; ix<mx-gx; ix++) {
+    for (int ix=ix0; ix<ix1; ix++) {
 
       int i = ix;
 
@@ -133,8 +259,8 @@ void EnzoMethodHeat::compute_ (Block * block,enzo_float * Unew) const throw()
 
   } else if (rank == 2) {
 
-    for (int iy=gy; iy<my-gy; iy++) {
-      for (int ix=gy; ix<mx-gy; ix++) {
+    for (int iy=iy0; iy<iy1; iy++) {
+      for (int ix=ix0; ix<ix1; ix++) {
 
 	int i = ix + mx*iy;
 
@@ -148,9 +274,9 @@ void EnzoMethodHeat::compute_ (Block * block,enzo_float * Unew) const throw()
 
   } else if (rank == 3) {
 
-    for (int iz=gz; iz<mz-gz; iz++) {
-      for (int iy=gy; iy<my-gy; iy++) {
-	for (int ix=gx; ix<mx-gx; ix++) {
+    for (int iz=iz0; iz<iz1; iz++) {
+      for (int iy=iy0; iy<iy1; iy++) {
+	for (int ix=ix0; ix<ix1; ix++) {
 
 	  int i = ix + mx*(iy + my*iz);
 
@@ -165,6 +291,4 @@ void EnzoMethodHeat::compute_ (Block * block,enzo_float * Unew) const throw()
     }
   }
 
-  delete [] U;
-
 }
@@ -44,6 +44,17 @@ public: // interface
   /// Apply the method to advance a block one timestep 
   virtual void compute( Block * block) throw();
 
+  /// Overlap the temperature refresh with computing interior cells,
+  /// which requires new values to be written into a separate
+  /// "swap" history buffer
+  virtual bool overlap_refresh () const throw();
+
+  /// Update cells whose stencil does not include ghost zones
+  virtual void compute_interior ( Block * block) throw();
+
+  /// Update the remaining cells after ghost zones are refreshed
+  virtual void compute_boundary ( Block * block) throw();
+
   virtual std::string name () throw () 
   { return "heat"; }
 
@@ -52,7 +63,15 @@ public: // interface
 
 protected: // methods
 
-  void compute_ (Block * block, enzo_float * Unew ) const throw();
+  /// Update cells with indices in [ix0,ix1) x [iy0,iy1) x [iz0,iz1)
+  void compute_ (Block * block, const enzo_float * U,
+		 enzo_float * Unew,
+		 int ix0, int ix1, int iy0, int iy1, int iz0, int iz1)
+    const throw();
+
+  /// Update all cells outside ghost zones
+  void compute_all_ (Block * block, const enzo_float * U,
+		     enzo_float * Unew ) const throw();
 
 protected: // attributes
 
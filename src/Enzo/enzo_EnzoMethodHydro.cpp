@@ -739,8 +739,10 @@ void EnzoMethodHydro::ppm_euler_x_(Block * block, int iz)
   int nc = field_groups->size("color");
   na += nc*ns;
 
-  // allocate array
-  enzo_float * slice_array = new enzo_float [na];
+  // get array (reused between calls)
+  Scratch * scratch = Scratch::instance();
+  enzo_float * slice_array = scratch->array<enzo_float>
+    (enzo_scratch_hydro_slice,na);
 
   // initialize array of slices
   
@@ -841,7 +843,8 @@ void EnzoMethodHydro::ppm_euler_x_(Block * block, int iz)
 
   int nf = (23 + 3*nc)*ns;
   
-  enzo_float * fluxes_array = new enzo_float [nf];
+  enzo_float * fluxes_array = scratch->array<enzo_float>
+    (enzo_scratch_hydro_fluxes,nf);
 
   enzo_float * pf = fluxes_array;
   
@@ -941,7 +944,8 @@ void EnzoMethodHydro::ppm_euler_x_(Block * block, int iz)
   
   enzo_float dt = block->dt();
   
-  enzo_float * flatten_array = new enzo_float[ns];
+  enzo_float * flatten_array = scratch->array<enzo_float>
+    (enzo_scratch_hydro_flatten,ns);
 
   int riemann_solver_fallback = 1;
   
@@ -1181,10 +1185,7 @@ void EnzoMethodHydro::ppm_euler_x_(Block * block, int iz)
   //   } // ENDFOR colors
   // } // ENDFOR j
 
-  // deallocate array
-  delete [] flatten_array;
-  delete [] fluxes_array;
-  delete [] slice_array;
+  // (arrays are kept in Scratch for the next call)
 }
 
 //----------------------------------------------------------------------
@@ -163,9 +163,13 @@ void EnzoMethodPmDeposit::compute ( Block * block) throw()
 
       // Accumulated single velocity array for Baryon deposit
 
-      for (int ib=0; ib<particle.num_batches(it); ib++) {
+      // (one array per batch, or one for all particles if Particle:slab)
 
-        const int np = particle.num_particles(it,ib);
+      const int nb = particle.num_arrays(it);
+
+      for (int ib=0; ib<nb; ib++) {
+
+        const int np = particle.array_size(it,ib);
 
         if (rank == 1) {
 
@@ -123,7 +123,7 @@ void EnzoMethodPmUpdate::compute ( Block * block) throw()
     const int dv = particle.stride(it, ia_vx);
     const int da = particle.stride(it, ia_ax);
 
-    const int nb = particle.num_batches (it);
+    const int nb = particle.num_arrays (it);
 
     const double dt = block->dt();
 
@@ -169,7 +169,7 @@ void EnzoMethodPmUpdate::compute ( Block * block) throw()
 	az = (enzo_float *) particle.attribute_array (it, ia_az, ib);
       }
 
-      const int np = particle.num_particles(it,ib);
+      const int np = particle.array_size(it,ib);
 
       if (rank >= 1) {
 
@@ -268,7 +268,7 @@ double EnzoMethodPmUpdate::timestep ( Block * block ) const throw()
     Field    field    = block->data()->field();
 
     const int it = particle.type_index ("dark");
-    const int nb = particle.num_batches (it);
+    const int nb = particle.num_arrays (it);
 
     const int ia_vx = particle.attribute_index (it, "vx");
     const int ia_vy = particle.attribute_index (it, "vy");
@@ -307,7 +307,7 @@ double EnzoMethodPmUpdate::timestep ( Block * block ) const throw()
     }
 
     for (int ib=0; ib<nb; ib++) {
-      const int np = particle.num_particles(it,ib);
+      const int np = particle.array_size(it,ib);
 
       if (rank >= 1) {
 	const enzo_float * vx = (const enzo_float *) 
@@ -34,7 +34,8 @@
 
 EnzoMethodPpm::EnzoMethodPpm ()
   : Method(),
-    comoving_coordinates_(enzo::config()->physics_cosmology)
+    comoving_coordinates_(enzo::config()->physics_cosmology),
+    num_threads_(enzo::config()->ppm_num_threads)
 {
   // Initialize default Refresh object
 
@@ -64,6 +65,7 @@ void EnzoMethodPpm::pup (PUP::er &p)
   Method::pup(p);
 
   p | comoving_coordinates_;
+  p | num_threads_;
 }
 
 //----------------------------------------------------------------------
@@ -141,8 +143,13 @@ void EnzoMethodPpm::compute ( Block * block) throw()
 
     TRACE_PPM ("BEGIN SolveHydroEquations");
 
+    // CkLoop tasks run on PEs of this node, so more threads than
+    // node PEs only add overhead
+    const int num_threads = (num_threads_ == 0) ?
+      CkMyNodeSize() : std::min(num_threads_,CkMyNodeSize());
+
     enzo_block->SolveHydroEquations 
-      ( block->time(), block->dt(), comoving_coordinates_ );
+      ( block->time(), block->dt(), comoving_coordinates_, num_threads );
 
     TRACE_PPM ("END SolveHydroEquations");
 
@@ -25,7 +25,8 @@ public: // interface
   /// Charm++ PUP::able migration constructor
   EnzoMethodPpm (CkMigrateMessage *m)
     : Method (m),
-      comoving_coordinates_(false)
+      comoving_coordinates_(false),
+      num_threads_(1)
   {}
 
   /// CHARM++ Pack / Unpack function
@@ -45,6 +46,9 @@ public: // virtual methods
 protected: // interface
 
   bool comoving_coordinates_;
+
+  /// Number of PEs in the node sharing each Block's sweeps (0 for all)
+  int num_threads_;
 };
 
 #endif /* ENZO_ENZO_METHOD_PPM_HPP */
@@ -0,0 +1,407 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoMethodProfile.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-19
+/// @brief    Implementation of the EnzoMethodProfile class
+///
+/// The reduction array contains the following values, where nr is
+/// the number of radial bins, nh the number of histogram bins, and
+/// nf the number of fields:
+///
+///     header    [4]                 cycle, time, number of sums, nf
+///     radial    [nr][2 + 2*nf]      volume, mass, sum f dV[nf], sum f dm[nf]
+///     histogram [nf][nh + 2][2]     volume, mass (underflow, bins, overflow)
+///     extrema   [nf][2]             min f, max f
+///
+/// Header values are copied, extrema are reduced with min and max,
+/// and all other values are summed.
+
+#include "cello.hpp"
+#include "enzo.hpp"
+
+#include "enzo.decl.h"
+
+//----------------------------------------------------------------------
+
+EnzoMethodProfile::EnzoMethodProfile
+(std::vector<std::string> field_list,
+ const double center[3],
+ int radial_bins,
+ double radius_min,
+ double radius_max,
+ bool radial_log,
+ int histogram_bins,
+ std::vector<double> histogram_min,
+ std::vector<double> histogram_max,
+ bool histogram_log,
+ std::string file_name) throw()
+  : Method(),
+    field_list_(field_list),
+    radial_bins_(radial_bins),
+    radius_min_(radius_min),
+    radius_max_(radius_max),
+    radial_log_(radial_log),
+    histogram_bins_(histogram_bins),
+    histogram_min_(histogram_min),
+    histogram_max_(histogram_max),
+    histogram_log_(histogram_log),
+    file_name_(file_name)
+{
+  for (int axis=0; axis<3; axis++) center_[axis] = center[axis];
+
+  const int nf = field_list_.size();
+
+  ASSERT ("EnzoMethodProfile::EnzoMethodProfile()",
+	  "Method:profile:fields must contain at least one field",
+	  nf > 0);
+
+  ASSERT ("EnzoMethodProfile::EnzoMethodProfile()",
+	  "Method:profile:radius_min must be positive for log radial bins",
+	  ! (radial_bins_ > 0 && radial_log_ && radius_min_ <= 0.0));
+
+  ASSERT ("EnzoMethodProfile::EnzoMethodProfile()",
+	  "Method:profile:radius_max must be larger than radius_min",
+	  ! (radial_bins_ > 0 && radius_max_ <= radius_min_));
+
+  if (histogram_bins_ > 0) {
+    ASSERT3 ("EnzoMethodProfile::EnzoMethodProfile()",
+	     "Method:profile:histogram_min and histogram_max lengths %d %d "
+	     "must match the number of fields %d",
+	     int(histogram_min_.size()),int(histogram_max_.size()),nf,
+	     (int(histogram_min_.size()) == nf &&
+	      int(histogram_max_.size()) == nf));
+    for (int i_f=0; i_f<nf; i_f++) {
+      ASSERT1 ("EnzoMethodProfile::EnzoMethodProfile()",
+	       "Invalid histogram range for field %s",
+	       field_list_[i_f].c_str(),
+	       (histogram_max_[i_f] > histogram_min_[i_f]) &&
+	       ! (histogram_log_ && histogram_min_[i_f] <= 0.0));
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodProfile::pup (PUP::er &p)
+{
+  // NOTE: change this function whenever attributes change
+
+  TRACEPUP;
+
+  Method::pup(p);
+
+  p | field_list_;
+  PUParray(p,center_,3);
+  p | radial_bins_;
+  p | radius_min_;
+  p | radius_max_;
+  p | radial_log_;
+  p | histogram_bins_;
+  p | histogram_min_;
+  p | histogram_max_;
+  p | histogram_log_;
+  p | file_name_;
+}
+
+//----------------------------------------------------------------------
+
+int EnzoMethodProfile::bin_
+(double value, double vmin, double vmax, int nb, bool is_log,
+ bool clamp) const throw()
+{
+  double ratio;
+  if (is_log) {
+    if (value <= 0.0) return clamp ? 0 : -1;
+    ratio = log(value/vmin) / log(vmax/vmin);
+  } else {
+    ratio = (value - vmin) / (vmax - vmin);
+  }
+  // compare in floating point before converting to int, since ratio
+  // may be NaN or too large to convert; NaN counts as overflow
+  int ib;
+  if      (ratio < 0.0)     ib = -1;
+  else if (! (ratio < 1.0)) ib = nb;
+  else                      ib = std::min(nb, int (nb*ratio));
+  if (clamp) {
+    // underflow is bin 0, overflow is bin nb + 1
+    ib = std::max(0, std::min(nb + 1, ib + 1));
+  } else if (ib >= nb) {
+    ib = -1;
+  }
+  return ib;
+}
+
+//----------------------------------------------------------------------
+
+double EnzoMethodProfile::bin_edge_
+(int ib, double vmin, double vmax, int nb, bool is_log) const throw()
+{
+  return is_log ?
+    vmin * pow(vmax/vmin, double(ib)/nb) :
+    vmin + (vmax - vmin)*ib/nb;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodProfile::compute ( Block * block) throw()
+{
+  EnzoBlock * enzo_block = enzo::block(block);
+
+  const int nf = field_list_.size();
+  const int nr = radial_bins_;
+  const int nh = histogram_bins_;
+  const int ns = num_sum_();
+  const int nv = 4 + ns + 2*nf;
+
+  std::vector<double> values (nv, 0.0);
+
+  values[0] = block->cycle();
+  values[1] = block->time();
+  values[2] = ns;
+  values[3] = nf;
+
+  double * radial    = &values[4];
+  double * histogram = radial + nr*(2 + 2*nf);
+  double * extrema   = histogram + nf*(nh + 2)*2;
+
+  for (int i_f=0; i_f<nf; i_f++) {
+    extrema[2*i_f]   =   std::numeric_limits<double>::max();
+    extrema[2*i_f+1] = - std::numeric_limits<double>::max();
+  }
+
+  if (block->is_leaf()) {
+
+    Field field = block->data()->field();
+
+    std::vector<enzo_float *> f(nf);
+    for (int i_f=0; i_f<nf; i_f++) {
+      const int id = field.field_id(field_list_[i_f]);
+      ASSERT1 ("EnzoMethodProfile::compute()",
+	       "Unknown field %s in Method:profile:fields",
+	       field_list_[i_f].c_str(),
+	       id >= 0);
+      f[i_f] = (enzo_float *) field.values(id);
+    }
+    const enzo_float * d = field.is_field("density") ?
+      (enzo_float *) field.values("density") : NULL;
+
+    int mx,my,mz;
+    int nx,ny,nz;
+    int gx,gy,gz;
+    const int id0 = field.field_id(field_list_[0]);
+    field.dimensions  (id0,&mx,&my,&mz);
+    field.size        (&nx,&ny,&nz);
+    field.ghost_depth (id0,&gx,&gy,&gz);
+
+    const int rank = cello::rank();
+
+    double xm,ym,zm;
+    double hx,hy,hz;
+    block->lower(&xm,&ym,&zm);
+    block->cell_width(&hx,&hy,&hz);
+    const double dv = hx * ((rank >= 2) ? hy : 1.0) * ((rank >= 3) ? hz : 1.0);
+
+    // Radial distances use the nearest periodic image of the center
+
+    int p3[3];
+    cello::hierarchy()->get_periodicity(p3,p3+1,p3+2);
+    double dm3[3],dp3[3];
+    cello::hierarchy()->lower(dm3,dm3+1,dm3+2);
+    cello::hierarchy()->upper(dp3,dp3+1,dp3+2);
+
+    auto distance = [&] (double x, int axis) -> double
+      {
+	double dx = x - center_[axis];
+	const double lx = dp3[axis] - dm3[axis];
+	if (p3[axis]) {
+	  if (dx >  0.5*lx) dx -= lx;
+	  if (dx < -0.5*lx) dx += lx;
+	}
+	return dx;
+      };
+
+    for (int iz=gz; iz<gz+nz; iz++) {
+      const double dz = (rank >= 3) ? distance(zm + (iz-gz+0.5)*hz,2) : 0.0;
+      for (int iy=gy; iy<gy+ny; iy++) {
+	const double dy = (rank >= 2) ? distance(ym + (iy-gy+0.5)*hy,1) : 0.0;
+	for (int ix=gx; ix<gx+nx; ix++) {
+	  const double dx = distance(xm + (ix-gx+0.5)*hx,0);
+	  const int i = ix + mx*(iy + my*iz);
+
+	  const double dmass = d ? d[i]*dv : 0.0;
+
+	  if (nr > 0) {
+	    const double r = sqrt(dx*dx + dy*dy + dz*dz);
+	    const int ir = bin_(r,radius_min_,radius_max_,nr,radial_log_,false);
+	    if (ir >= 0) {
+	      double * bin = radial + ir*(2 + 2*nf);
+	      bin[0] += dv;
+	      bin[1] += dmass;
+	      for (int i_f=0; i_f<nf; i_f++) {
+		bin[2+i_f]    += f[i_f][i]*dv;
+		bin[2+nf+i_f] += f[i_f][i]*dmass;
+	      }
+	    }
+	  }
+
+	  for (int i_f=0; i_f<nf; i_f++) {
+	    const double value = f[i_f][i];
+	    if (nh > 0) {
+	      const int ih = bin_(value,histogram_min_[i_f],histogram_max_[i_f],
+				  nh,histogram_log_,true);
+	      double * bin = histogram + 2*(i_f*(nh + 2) + ih);
+	      bin[0] += dv;
+	      bin[1] += dmass;
+	    }
+	    extrema[2*i_f]   = std::min(extrema[2*i_f],  value);
+	    extrema[2*i_f+1] = std::max(extrema[2*i_f+1],value);
+	  }
+	}
+      }
+    }
+  }
+
+  // The root process writes the result, so Blocks need not wait for
+  // the reduction to complete
+
+  CkCallback callback (CkIndex_EnzoSimulation::r_method_profile_write(NULL),
+		       proxy_enzo_simulation[0]);
+  enzo_block->contribute
+    (nv*sizeof(double),values.data(),r_method_profile_type,callback);
+
+  block->compute_done();
+}
+
+//----------------------------------------------------------------------
+
+CkReduction::reducerType r_method_profile_type;
+
+void register_method_profile(void)
+{ r_method_profile_type = CkReduction::addReducer(r_method_profile); }
+
+CkReductionMsg * r_method_profile(int n, CkReductionMsg ** msgs)
+{
+  const double * values0 = (const double *) msgs[0]->getData();
+  const int ns = values0[2];
+  const int nf = values0[3];
+  const int nv = 4 + ns + 2*nf;
+
+  std::vector<double> accum (values0, values0 + nv);
+
+  for (int i=1; i<n; i++) {
+    const double * values = (const double *) msgs[i]->getData();
+    for (int k=4; k<4+ns; k++) {
+      accum[k] += values[k];
+    }
+    for (int i_f=0; i_f<nf; i_f++) {
+      const int k = 4 + ns + 2*i_f;
+      accum[k]   = std::min(accum[k],  values[k]);
+      accum[k+1] = std::max(accum[k+1],values[k+1]);
+    }
+  }
+  return CkReductionMsg::buildNew(nv*sizeof(double),accum.data());
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSimulation::r_method_profile_write(CkReductionMsg * msg)
+{
+  EnzoMethodProfile * method =
+    static_cast<EnzoMethodProfile *> (cello::problem()->method("profile"));
+  method->write(msg);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodProfile::write (CkReductionMsg * msg) throw()
+{
+  const double * values = (const double *) msg->getData();
+
+  const int cycle = values[0];
+  const double time = values[1];
+
+  const int nf = field_list_.size();
+  const int nr = radial_bins_;
+  const int nh = histogram_bins_;
+
+  const double * radial    = &values[4];
+  const double * histogram = radial + nr*(2 + 2*nf);
+  const double * extrema   = histogram + nf*(nh + 2)*2;
+
+  char file_name[256];
+  snprintf (file_name,sizeof(file_name),file_name_.c_str(),cycle);
+
+  FILE * fp = fopen (file_name,"w");
+
+  if (fp == NULL) {
+
+    WARNING1 ("EnzoMethodProfile::write()",
+	      "Cannot open profile file %s for writing",
+	      file_name);
+    delete msg;
+    return;
+  }
+
+  fprintf (fp,"# cycle %d time %.10g\n",cycle,time);
+  for (int i_f=0; i_f<nf; i_f++) {
+    fprintf (fp,"# field %s min %.8g max %.8g\n",
+	     field_list_[i_f].c_str(),extrema[2*i_f],extrema[2*i_f+1]);
+  }
+
+  // Radial profiles: volume- and mass-weighted averages
+
+  if (nr > 0) {
+    fprintf (fp,"\n# radial center %.10g %.10g %.10g\n",
+	     center_[0],center_[1],center_[2]);
+    fprintf (fp,"# r_min r_max volume mass");
+    for (int i_f=0; i_f<nf; i_f++)
+      fprintf (fp," %s_volume",field_list_[i_f].c_str());
+    for (int i_f=0; i_f<nf; i_f++)
+      fprintf (fp," %s_mass",field_list_[i_f].c_str());
+    fprintf (fp,"\n");
+    for (int ir=0; ir<nr; ir++) {
+      const double * bin = radial + ir*(2 + 2*nf);
+      const double volume = bin[0];
+      const double mass   = bin[1];
+      fprintf (fp,"%.8g %.8g %.8g %.8g",
+	       bin_edge_(ir,  radius_min_,radius_max_,nr,radial_log_),
+	       bin_edge_(ir+1,radius_min_,radius_max_,nr,radial_log_),
+	       volume,mass);
+      for (int i_f=0; i_f<nf; i_f++)
+	fprintf (fp," %.8g",(volume > 0.0) ? bin[2+i_f]/volume : 0.0);
+      for (int i_f=0; i_f<nf; i_f++)
+	fprintf (fp," %.8g",(mass > 0.0) ? bin[2+nf+i_f]/mass : 0.0);
+      fprintf (fp,"\n");
+    }
+  }
+
+  // Histograms: volume and mass in each bin, including values below
+  // and above the histogram range in the first and last rows
+
+  if (nh > 0) {
+    for (int i_f=0; i_f<nf; i_f++) {
+      const double vmin = histogram_min_[i_f];
+      const double vmax = histogram_max_[i_f];
+      fprintf (fp,"\n# histogram %s\n",field_list_[i_f].c_str());
+      fprintf (fp,"# value_min value_max volume mass\n");
+      for (int ih=0; ih<nh+2; ih++) {
+	const double * bin = histogram + 2*(i_f*(nh + 2) + ih);
+	const double lo = (ih == 0) ?
+	  -std::numeric_limits<double>::infinity() :
+	  bin_edge_(ih-1,vmin,vmax,nh,histogram_log_);
+	const double hi = (ih == nh + 1) ?
+	  std::numeric_limits<double>::infinity() :
+	  bin_edge_(ih,vmin,vmax,nh,histogram_log_);
+	fprintf (fp,"%.8g %.8g %.8g %.8g\n",lo,hi,bin[0],bin[1]);
+      }
+    }
+  }
+
+  fclose (fp);
+
+  cello::monitor()->print ("Method","%s wrote %s",
+			   name().c_str(),file_name);
+
+  delete msg;
+}
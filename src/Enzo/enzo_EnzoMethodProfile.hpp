@@ -0,0 +1,137 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoMethodProfile.hpp
+/// @author   agent (agent@local)
+/// @date     2026-10-19
+/// @brief    [\ref Enzo] Declaration of the EnzoMethodProfile class
+///
+/// In-situ radial profiles and histograms of Field values
+
+#ifndef ENZO_ENZO_METHOD_PROFILE_HPP
+#define ENZO_ENZO_METHOD_PROFILE_HPP
+
+class EnzoMethodProfile : public Method {
+
+  /// @class    EnzoMethodProfile
+  /// @ingroup  Enzo
+  /// @brief [\ref Enzo] Accumulate spherically averaged profiles and
+  /// volume- and mass-weighted histograms of fields
+  ///
+  /// @details Each leaf Block bins its cells into radial shells about
+  /// a center point and into histogram bins of each field's values.
+  /// Bins from all Blocks are combined using a single custom
+  /// reduction, and the root process writes the resulting tables to
+  /// a text file.  Bin edges are either linearly or logarithmically
+  /// spaced.  Mass weights use the "density" field if it exists.
+
+public: // interface
+
+  /// Create a new EnzoMethodProfile object
+  EnzoMethodProfile (std::vector<std::string> field_list,
+		     const double center[3],
+		     int radial_bins,
+		     double radius_min,
+		     double radius_max,
+		     bool radial_log,
+		     int histogram_bins,
+		     std::vector<double> histogram_min,
+		     std::vector<double> histogram_max,
+		     bool histogram_log,
+		     std::string file_name) throw();
+
+  /// Destructor
+  virtual ~EnzoMethodProfile() throw()
+  {}
+
+  /// Charm++ PUP::able declarations
+  PUPable_decl(EnzoMethodProfile);
+
+  /// Charm++ PUP::able migration constructor
+  EnzoMethodProfile (CkMigrateMessage *m)
+    : Method (m),
+      field_list_(),
+      radial_bins_(0),
+      radius_min_(0.0),
+      radius_max_(0.0),
+      radial_log_(false),
+      histogram_bins_(0),
+      histogram_min_(),
+      histogram_max_(),
+      histogram_log_(false),
+      file_name_("")
+  {
+    for (int axis=0; axis<3; axis++) center_[axis] = 0.0;
+  }
+
+  /// CHARM++ Pack / Unpack function
+  void pup (PUP::er &p);
+
+public: // virtual functions
+
+  /// Accumulate profiles and histograms for the Block
+  virtual void compute ( Block * block) throw();
+
+  /// Return the name of this EnzoMethodProfile
+  virtual std::string name () throw ()
+  { return "profile"; }
+
+public: // methods
+
+  /// Write the reduced profiles and histograms on the root process
+  void write (CkReductionMsg * msg) throw();
+
+protected: // methods
+
+  /// Return the number of summed values in the reduction array
+  int num_sum_ () const throw()
+  {
+    const int nf = field_list_.size();
+    return radial_bins_*(2 + 2*nf) + nf*(histogram_bins_ + 2)*2;
+  }
+
+  /// Return the radial or histogram bin containing value, -1 if none
+  int bin_ (double value, double vmin, double vmax, int nb, bool is_log,
+	    bool clamp) const throw();
+
+  /// Return the lower edge of bin ib
+  double bin_edge_ (int ib, double vmin, double vmax, int nb,
+		    bool is_log) const throw();
+
+protected: // attributes
+
+  /// Fields to profile
+  std::vector<std::string> field_list_;
+
+  /// Center of the radial profiles
+  double center_[3];
+
+  /// Number of radial bins, or 0 for no radial profiles
+  int radial_bins_;
+
+  /// Inner radius of the radial profiles
+  double radius_min_;
+
+  /// Outer radius of the radial profiles
+  double radius_max_;
+
+  /// Whether radial bins are logarithmically spaced
+  bool radial_log_;
+
+  /// Number of histogram bins, or 0 for no histograms
+  int histogram_bins_;
+
+  /// Lower limit of histogram bins for each field
+  std::vector<double> histogram_min_;
+
+  /// Upper limit of histogram bins for each field
+  std::vector<double> histogram_max_;
+
+  /// Whether histogram bins are logarithmically spaced
+  bool histogram_log_;
+
+  /// Output file name format, with the cycle as argument
+  std::string file_name_;
+
+};
+
+#endif /* ENZO_ENZO_METHOD_PROFILE_HPP */
@@ -303,7 +303,8 @@ Solver * EnzoProblem::create_solver_
        enzo_config->solver_max_level[index_solver],
        enzo_config->solver_iter_max[index_solver],
        enzo_config->solver_res_tol[index_solver],
-       enzo_config->solver_precondition[index_solver]);
+       enzo_config->solver_precondition[index_solver],
+       enzo_config->solver_mixed_precision[index_solver]);
 
   } else if (solver_type == "dd") {
 
@@ -341,7 +342,8 @@ Solver * EnzoProblem::create_solver_
        enzo_config->solver_iter_max[index_solver],
        enzo_config->solver_res_tol[index_solver],
        enzo_config->solver_precondition[index_solver],
-       enzo_config->solver_coarse_level[index_solver]);
+       enzo_config->solver_coarse_level[index_solver],
+       enzo_config->solver_mixed_precision[index_solver]);
 
   } else if (solver_type == "diagonal") {
 
@@ -353,6 +355,19 @@ Solver * EnzoProblem::create_solver_
        enzo_config->solver_restart_cycle[index_solver],
        solve_type);
 
+  } else if (solver_type == "fft") {
+
+    solver = new EnzoSolverFft
+      (enzo_config->solver_list[index_solver],
+       enzo_config->solver_field_x[index_solver],
+       enzo_config->solver_field_b[index_solver],
+       enzo_config->solver_monitor_iter[index_solver],
+       enzo_config->solver_restart_cycle[index_solver],
+       solve_type,
+       enzo_config->solver_min_level[index_solver],
+       enzo_config->solver_max_level[index_solver],
+       enzo_config->solver_max_size[index_solver]);
+
   } else if (solver_type == "jacobi") {
 
     solver = new EnzoSolverJacobi
@@ -543,6 +558,29 @@ Method * EnzoProblem::create_method_
 
     method = new EnzoMethodCosmology;
 
+  } else if (name == "profile") {
+
+    method = new EnzoMethodProfile
+      (enzo_config->method_profile_fields,
+       enzo_config->method_profile_center,
+       enzo_config->method_profile_radial_bins,
+       enzo_config->method_profile_radius_min,
+       enzo_config->method_profile_radius_max,
+       enzo_config->method_profile_radial_scale == "log",
+       enzo_config->method_profile_histogram_bins,
+       enzo_config->method_profile_histogram_min,
+       enzo_config->method_profile_histogram_max,
+       enzo_config->method_profile_histogram_scale == "log",
+       enzo_config->method_profile_file_name);
+
+  } else if (name == "fof") {
+
+    method = new EnzoMethodFof
+      (enzo_config->method_fof_particle_type,
+       enzo_config->method_fof_linking_length,
+       enzo_config->method_fof_min_members,
+       enzo_config->method_fof_file_name);
+
   } else if (name == "comoving_expansion") {
 
     bool comoving_coordinates = enzo_config->physics_cosmology;
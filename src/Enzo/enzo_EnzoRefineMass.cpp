@@ -64,8 +64,30 @@ EnzoRefineMass::EnzoRefineMass
 //----------------------------------------------------------------------
 
 int EnzoRefineMass::apply ( Block * block ) throw ()
+{
+  return apply_tiles_(block);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoRefineMass::tile_begin ( Block * block ) throw ()
+{
+  initialize_output_(block->data()->field_data());
+}
+
+//----------------------------------------------------------------------
+
+void EnzoRefineMass::tile_apply
+( Block * block, int tile, int num_tiles,
+  bool * any_refine, bool * all_coarsen ) throw ()
 {
   Field field = block->data()->field();
+
+  void * output = output_values_(field.field_data());
+
+  // refinement is already decided and output is not needed
+  if (*any_refine && ! output) return;
+
   int level = block->level();
 
   double hx,hy,hz;
@@ -90,126 +112,31 @@ int EnzoRefineMass::apply ( Block * block ) throw ()
   field.dimensions (id_field, &mx,&my,&mz);
   field.ghost_depth(id_field, &gx,&gy,&gz);
 
-  precision_type precision = field.precision(id_field);
-
-  //  int num_fields = field_descr->field_count();
+  int lo[3] = {gx,gy,gz};
+  int hi[3] = {mx-gx,my-gy,mz-gz};
+  tile_limits_(tile,num_tiles,cello::rank(),lo,hi);
 
-  bool all_coarsen = true;
-  bool any_refine = false;
-
-  union {
-    float *       rho4;
-    double *      rho8;
-    long double * rho16;
-  };
-  union {
-    float *       out4;
-    double *      out8;
-    long double * out16;
-  };
+  precision_type precision = field.precision(id_field);
 
-  rho4 = (float *) field.values(id_field);
-  out4 = (float*) initialize_output_(field.field_data());
+  void * rho = field.values(id_field);
 
   double vol = hx*hy*hz;
   
   switch (precision) {
   case precision_single:
-    if (out4) {
-#ifdef DEBUG_REFINE      
-      double min =  std::numeric_limits<float>::max();
-      double max = -min;
-      double sum = 0.0;
-#endif      
-      for (int iz=gz; iz<mz-gz; iz++) {
-	for (int iy=gy; iy<my-gy; iy++) {
-	  for (int ix=gx; ix<mx-gx; ix++) {
-	    int i = ix + mx*(iy + my*iz);
-	    double mass = vol*rho4[i];
-#ifdef DEBUG_REFINE      
-	    min = std::min(min,mass);
-	    max = std::max(max,mass);
-	    sum += mass;
-#endif	    
-	    if      (mass < mass_max_coarsen) out4[i] = -1;
-	    else if (mass < mass_min_refine)  out4[i] =  0;
-	    else                              out4[i] = +1;
-	  }
-	}
-      }
-#ifdef DEBUG_REFINE      
-      double sum2= 0.0;
-      for (int i=0; i<mx*my*mz; i++) sum2 += vol*rho4[i];
-      CkPrintf ("DEBUG_REFINE_MASS %s sum (%18.15g) [%18.15g]\n",
-		name_.c_str(),sum,sum2);
-      CkPrintf ("DEBUG_REFINE_MASS %s refine %18.15g\n",
-		name_.c_str(),mass_min_refine);
-#endif      
-    }
-    for (int iz=gz; iz<mz-gz; iz++) {
-      for (int iy=gy; iy<my-gy; iy++) {
-	for (int ix=gx; ix<mx-gx; ix++) {
-	  int i = ix + mx*(iy + my*iz);
-	  double mass = vol*rho4[i];
-	  if (mass > mass_min_refine)  any_refine  = true;
-	  if (mass > mass_max_coarsen) all_coarsen = false;
-	}
-      }
-    }
+    evaluate_tile_ ((const float *)rho, (float *)output,
+		    mx,my,mz,lo,hi,vol,mass_min_refine,mass_max_coarsen,
+		    any_refine,all_coarsen);
     break;
   case precision_double:
-    if (out8) {
-      double min =  std::numeric_limits<double>::max();
-      double max = -min;
-      for (int iz=gz; iz<mz-gz; iz++) {
-	for (int iy=gy; iy<my-gy; iy++) {
-	  for (int ix=gx; ix<mx-gx; ix++) {
-	    int i = ix + mx*(iy + my*iz);
-	    double mass = vol*rho8[i];
-	    min = std::min(min,mass);
-	    max = std::max(max,mass);
-	    if      (mass < mass_max_coarsen) out8[i] = -1;
-	    else if (mass < mass_min_refine)  out8[i] =  0;
-	    else                              out8[i] = +1;
-	  }
-	}
-      }
-    }
-    for (int iz=gz; iz<mz-gz; iz++) {
-      for (int iy=gy; iy<my-gy; iy++) {
-	for (int ix=gx; ix<mx-gx; ix++) {
-	  int i = ix + mx*(iy + my*iz);
-	  double mass = vol*rho8[i];
-	  if (mass > mass_min_refine)  any_refine  = true;
-	  if (mass > mass_max_coarsen) all_coarsen = false;
-	}
-      }
-    }
+    evaluate_tile_ ((const double *)rho, (double *)output,
+		    mx,my,mz,lo,hi,vol,mass_min_refine,mass_max_coarsen,
+		    any_refine,all_coarsen);
     break;
   case precision_quadruple:
-    if (out16) {
-      for (int iz=gz; iz<mz-gz; iz++) {
-	for (int iy=gy; iy<my-gy; iy++) {
-	  for (int ix=gx; ix<mx-gx; ix++) {
-	    int i = ix + mx*(iy + my*iz);
-	    long double mass = vol*rho16[i];
-	    if      (mass < mass_max_coarsen) out16[i] = -1;
-	    else if (mass < mass_min_refine)  out16[i] =  0;
-	    else                              out16[i] = +1;
-	  }
-	}
-      }
-    }
-    for (int iz=gz; iz<mz-gz; iz++) {
-      for (int iy=gy; iy<my-gy; iy++) {
-	for (int ix=gx; ix<mx-gx; ix++) {
-	  int i = ix + mx*(iy + my*iz);
-	  long double mass = vol*rho16[i];
-	  if (mass > mass_min_refine)  any_refine  = true;
-	  if (mass > mass_max_coarsen) all_coarsen = false;
-	}
-      }
-    }
+    evaluate_tile_ ((const long double *)rho, (long double *)output,
+		    mx,my,mz,lo,hi,vol,mass_min_refine,mass_max_coarsen,
+		    any_refine,all_coarsen);
     break;
   default:
     ERROR2("EnzoRefineMass::apply",
@@ -217,16 +144,54 @@ int EnzoRefineMass::apply ( Block * block ) throw ()
 	   precision,0);
     break;
   }
+}
 
-  int adapt_result = 
-    any_refine ?  adapt_refine : (all_coarsen ? adapt_coarsen : adapt_same) ;
-
-  // Don't refine if already at maximum level
-  adjust_for_level_( &adapt_result, block->level() );
-
-  return adapt_result;
+//----------------------------------------------------------------------
 
+template <class T>
+void EnzoRefineMass::evaluate_tile_
+(const T * rho, T * output,
+ int mx, int my, int mz,
+ const int lo[3], const int hi[3],
+ double vol,
+ double mass_min_refine, double mass_max_coarsen,
+ bool * any_refine, bool * all_coarsen) const throw()
+{
+  bool refine  = *any_refine;
+  bool coarsen = *all_coarsen;
+  for (int iz=lo[2]; iz<hi[2]; iz++) {
+    for (int iy=lo[1]; iy<hi[1]; iy++) {
+      // early exit: refinement decided and no output field to fill
+      if (refine && ! output) {
+	*any_refine = true;
+	return;
+      }
+      const int i0 = mx*(iy + my*iz);
+      bool row_refine = false;
+      bool row_keep   = false;
+      if (output) {
+	for (int ix=lo[0]; ix<hi[0]; ix++) {
+	  const int i = ix + i0;
+	  const double mass = vol*rho[i];
+	  if      (mass < mass_max_coarsen) output[i] = -1;
+	  else if (mass < mass_min_refine)  output[i] =  0;
+	  else                              output[i] = +1;
+	  row_refine |= (mass > mass_min_refine);
+	  row_keep   |= (mass > mass_max_coarsen);
+	}
+      } else {
+	for (int ix=lo[0]; ix<hi[0]; ix++) {
+	  const double mass = vol*rho[ix + i0];
+	  row_refine |= (mass > mass_min_refine);
+	  row_keep   |= (mass > mass_max_coarsen);
+	}
+      }
+      refine  = refine  || row_refine;
+      coarsen = coarsen && ! row_keep;
+    }
+  }
+  *any_refine  = refine;
+  *all_coarsen = coarsen;
 }
 
 //======================================================================
-
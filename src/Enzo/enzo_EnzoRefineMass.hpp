@@ -55,6 +55,27 @@ public: // interface
 
   virtual std::string name () const { return "mass"; };
 
+  virtual bool is_tiled () const { return true; }
+
+  /// Initialize the output field if any
+  virtual void tile_begin (Block * block) throw();
+
+  /// Evaluate the mass criteria on the given tile
+  virtual void tile_apply (Block * block, int tile, int num_tiles,
+			   bool * any_refine, bool * all_coarsen) throw();
+
+private: // functions
+
+  /// Single pass over the tile updating refine / coarsen flags and
+  /// the output field if any
+  template <class T>
+  void evaluate_tile_ (const T * rho, T * output,
+		       int mx, int my, int mz,
+		       const int lo[3], const int hi[3],
+		       double vol,
+		       double mass_min_refine, double mass_max_coarsen,
+		       bool * any_refine, bool * all_coarsen) const throw();
+
 private:
 
   /// Field containing density to compare against
@@ -34,23 +34,38 @@ EnzoRefineShock::EnzoRefineShock(double pressure_min_refine,
 
 int EnzoRefineShock::apply ( Block * block ) throw ()
 {
+  return apply_tiles_(block);
+}
 
-  Field field = block->data()->field();
-
-  int nx,ny,nz;
-  field.size(&nx,&ny,&nz);
-
-  int rank = cello::rank();
+//----------------------------------------------------------------------
 
+void EnzoRefineShock::tile_begin ( Block * block ) throw ()
+{
   // compute pressure using the EnzoComputePressure class
 
   EnzoComputePressure compute_pressure (gamma_,comoving_coordinates_);
   compute_pressure.compute(block);
 
-  Data * data = block->data();
-  double xm[3],xp[3];
-  data->lower(&xm[0],&xm[1],&xm[2]);
-  data->upper(&xp[0],&xp[1],&xp[2]);
+  initialize_output_(block->data()->field_data());
+}
+
+//----------------------------------------------------------------------
+
+void EnzoRefineShock::tile_apply
+( Block * block, int tile, int num_tiles,
+  bool * any_refine, bool * all_coarsen ) throw ()
+{
+  Field field = block->data()->field();
+
+  void * output = output_values_(field.field_data());
+
+  // refinement is already decided and output is not needed
+  if (*any_refine && ! output) return;
+
+  int nx,ny,nz;
+  field.size(&nx,&ny,&nz);
+
+  int rank = cello::rank();
 
   int id_velocity = field.field_id("velocity_x");
 
@@ -79,29 +94,17 @@ int EnzoRefineShock::apply ( Block * block ) throw ()
   if (rank < 2) gy = 0;
   if (rank < 3) gz = 0;
 
-  //  precision_type precision = field.precision(id_velocity);
+  int lo[3] = {gx,gy,gz};
+  int hi[3] = {nx+gx,ny+gy,nz+gz};
+  tile_limits_(tile,num_tiles,rank,lo,hi);
 
-  void * output = initialize_output_(field.field_data());
-
-  bool any_refine  = false;
-  bool all_coarsen = true;
-  
   evaluate_block_((const enzo_float**) v3,
 		  (const enzo_float*)  te,
 		  (const enzo_float*)  de,
 		  (const enzo_float*)  p,
 		  (enzo_float*) output,
-		  nxd,nyd,nzd,nx,ny,nz,gx,gy,gz,
-		  &any_refine,&all_coarsen, rank);
-
-  int adapt_result =  
-    any_refine ? adapt_refine : (all_coarsen ? adapt_coarsen : adapt_same) ;
-
-  // Don't refine if already at maximum level
-  adjust_for_level_ (&adapt_result,block->level());
-
-  return adapt_result;
-
+		  nxd,nyd,nzd,lo,hi,
+		  any_refine,all_coarsen, rank);
 }
 
 //----------------------------------------------------------------------
@@ -113,15 +116,11 @@ void EnzoRefineShock::evaluate_block_
  const enzo_float * p,
  enzo_float * output,
  int ndx, int ndy, int ndz,
- int nx, int ny, int nz,
- int gx, int gy, int gz,
+ const int lo[3], const int hi[3],
  bool *any_refine,
  bool * all_coarsen, 
  int rank)
 {
-  (*all_coarsen) = true;
-  (*any_refine)  = false;
-
   const int d3[3] = {1, ndx, ndx*ndy};
 
 #ifdef DEBUG_ENZO_REFINE_SHOCK
@@ -133,9 +132,11 @@ void EnzoRefineShock::evaluate_block_
   
   for (int axis=0; axis<rank; axis++) {
 
-    for (int iz=gz; iz<nz+gz; iz++) {
-      for (int iy=gy; iy<ny+gy; iy++) {
-	for (int ix=gx; ix<nx+gx; ix++) {
+    for (int iz=lo[2]; iz<hi[2]; iz++) {
+      for (int iy=lo[1]; iy<hi[1]; iy++) {
+	// early exit: refinement decided and no output field to fill
+	if (*any_refine && ! output) return;
+	for (int ix=lo[0]; ix<hi[0]; ix++) {
 
 	  int i = ix + ndx*(iy + ndy*iz);
 	  int id = d3[axis];
@@ -66,6 +66,15 @@ public: // interface
 
   virtual std::string name () const { return "shock"; };
 
+  virtual bool is_tiled () const { return true; }
+
+  /// Compute the pressure field and initialize the output field if any
+  virtual void tile_begin (Block * block) throw();
+
+  /// Evaluate the shock criteria on the given tile
+  virtual void tile_apply (Block * block, int tile, int num_tiles,
+			   bool * any_refine, bool * all_coarsen) throw();
+
 private: // functions
 
   void evaluate_block_( const enzo_float ** v3,
@@ -74,8 +83,7 @@ private: // functions
 			const enzo_float * p,
 			enzo_float * output,
 			int ndx, int ndy, int ndz,
-			int nx, int ny, int nz,
-			int gx, int gy, int gz,
+			const int lo[3], const int hi[3],
 			bool *any_refine,
 			bool *all_coarsen, 
 			int rank);
@@ -46,6 +46,29 @@ public: // functions
   /// Barrier after constructor to ensure all EnzoSimulation objects created
   void r_startup_begun (CkReductionMsg *);
 
+  /// Read initial conditions if this is an EnzoInitialMusic reader
+  /// process
+  void p_initial_music_read();
+
+  /// Report EnzoInitialMusic collective read bandwidth
+  void r_initial_music_read_end (CkReductionMsg *);
+
+  /// Receive a Block's right-hand side for EnzoSolverFft
+  void p_solver_fft_gather (int index_solver, Index index, int order,
+			    double h3[3], int ib3[3], int nb3[3],
+			    int n3[3], int g3[3],
+			    int n, enzo_float values[]);
+
+  /// Receive a Block's groups for the EnzoMethodFof halo catalog
+  void p_method_fof_catalog (int cycle, double time, int n, char buffer[]);
+
+  /// Receive the number of Blocks contributing to the EnzoMethodFof
+  /// halo catalog
+  void p_method_fof_count (int cycle, int count);
+
+  /// Write reduced EnzoMethodProfile profiles and histograms
+  void r_method_profile_write (CkReductionMsg * msg);
+
 public: // virtual functions
 
   /// Initialize the Enzo Simulation
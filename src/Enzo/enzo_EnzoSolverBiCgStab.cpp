@@ -191,7 +191,8 @@ EnzoSolverBiCgStab::EnzoSolverBiCgStab
  int min_level, int max_level,
  int iter_max, double res_tol,
  int index_precon,
- int coarse_level
+ int coarse_level,
+ bool mixed_precision
  ) 
   : Solver(name,
 	   field_x,
@@ -211,8 +212,14 @@ EnzoSolverBiCgStab::EnzoSolverBiCgStab
     gx_(0), gy_(0), gz_(0),
     coarse_level_(coarse_level),
     ir_loop_3_(-1),
-    ir_loop_9_(-1)
+    ir_loop_9_(-1),
+    mixed_precision_(mixed_precision),
+    iw_(-1)
 {
+  ASSERT1 ("EnzoSolverBiCgStab::EnzoSolverBiCgStab()",
+	   "Solver %s: mixed_precision does not support a preconditioner",
+	   name.c_str(),
+	   ! (mixed_precision && index_precon >= 0));
 
   //  if (solve_type == solve_tree) {
   ScalarDescr * scalar_descr_quad = cello::scalar_descr_long_double();
@@ -242,6 +249,7 @@ EnzoSolverBiCgStab::EnzoSolverBiCgStab
   is_vs_ =     scalar_descr_quad->new_value("solver_bicgstab_vs");
   is_us_ =     scalar_descr_quad->new_value("solver_bicgstab_us");
   is_qs_ =     scalar_descr_quad->new_value("solver_bicgstab_qs");
+  is_err_exact_ = scalar_descr_quad->new_value("solver_bicgstab_err_exact");
 
   if (solve_type == solve_tree) {
    
@@ -254,6 +262,7 @@ EnzoSolverBiCgStab::EnzoSolverBiCgStab
   
   ScalarDescr * scalar_descr_int = cello::scalar_descr_int();
   is_iter_ = scalar_descr_int->new_value("solver_bicgstab_iter");
+  is_iter_exact_ = scalar_descr_int->new_value("solver_bicgstab_iter_exact");
 
   FieldDescr * field_descr = cello::field_descr();
 
@@ -265,6 +274,23 @@ EnzoSolverBiCgStab::EnzoSolverBiCgStab
   iq_ = field_descr->insert_temporary();
   iu_ = field_descr->insert_temporary();
 
+  if (mixed_precision_) {
+
+    // BiCgStab vectors are single precision; X and B keep their
+    // precision, and the residual is periodically recomputed from X
+    // using the full-precision temporary W
+
+    field_descr->set_precision (ir_, precision_single);
+    field_descr->set_precision (ir0_,precision_single);
+    field_descr->set_precision (ip_, precision_single);
+    field_descr->set_precision (iy_, precision_single);
+    field_descr->set_precision (iv_, precision_single);
+    field_descr->set_precision (iq_, precision_single);
+    field_descr->set_precision (iu_, precision_single);
+
+    iw_ = field_descr->insert_temporary();
+  }
+
   /// Initialize default Refresh (called before entry to compute())
 
   new_register_refresh_();
@@ -304,6 +330,8 @@ void EnzoSolverBiCgStab::pup(PUP::er& p) {
     p | is_qs_;
     p | is_dot_sync_;
     p | is_iter_;
+    p | is_err_exact_;
+    p | is_iter_exact_;
 
     p | res_tol_;
     p | index_precon_;
@@ -329,6 +357,8 @@ void EnzoSolverBiCgStab::pup(PUP::er& p) {
     p | coarse_level_;
     p | ir_loop_3_;
     p | ir_loop_9_;
+    p | mixed_precision_;
+    p | iw_;
   }
 
 //----------------------------------------------------------------------
@@ -379,12 +409,21 @@ void EnzoSolverBiCgStab::apply
 
 //======================================================================
 
+void EnzoSolverBiCgStab::compute_(EnzoBlock* block) throw() {
+  if (mixed_precision_) compute_<float>     (block);
+  else                  compute_<enzo_float>(block);
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
 void EnzoSolverBiCgStab::compute_(EnzoBlock* block) throw() {
 
   TRACE_BCG(block,this,"compute");
   
   /// initialize BiCgStab iteration counter
   (s_iter_(block)) = 0;
+  (s_iter_exact_(block)) = 0;
 
   /// access field container on this block
 
@@ -396,13 +435,13 @@ void EnzoSolverBiCgStab::compute_(EnzoBlock* block) throw() {
   /// access relevant fields
 
   enzo_float* X   = (enzo_float*) field.values(ix_);
-  enzo_float* R   = (enzo_float*) field.values(ir_);
-  enzo_float* R0  = (enzo_float*) field.values(ir0_);
-  enzo_float* P   = (enzo_float*) field.values(ip_);
-  enzo_float* Y   = (enzo_float*) field.values(iy_);
-  enzo_float* V   = (enzo_float*) field.values(iv_);
-  enzo_float* Q   = (enzo_float*) field.values(iq_);
-  enzo_float* U   = (enzo_float*) field.values(iu_);
+  T* R   = (T*) field.values(ir_);
+  T* R0  = (T*) field.values(ir0_);
+  T* P   = (T*) field.values(ip_);
+  T* Y   = (T*) field.values(iy_);
+  T* V   = (T*) field.values(iv_);
+  T* Q   = (T*) field.values(iq_);
+  T* U   = (T*) field.values(iu_);
 
   COPY_FIELD(block,ib_,"B0_bcg");
   for (int i=0; i<m_; i++) {
@@ -432,7 +471,7 @@ void EnzoSolverBiCgStab::compute_(EnzoBlock* block) throw() {
 
       for (int i=0; i<m_; i++) X[i] = X_copy[i];
 
-      A_->residual (ir_, ib_, ix_, block);
+      residual_<T> (block);
       
     }
   }
@@ -504,9 +543,11 @@ void EnzoSolverBiCgStab::compute_(EnzoBlock* block) throw() {
 void EnzoBlock::r_solver_bicgstab_start_1(CkReductionMsg* msg) {
 
   performance_start_(perf_compute,__FILE__,__LINE__);
+  const int index_region = performance_solver_start_();
 
   static_cast<EnzoSolverBiCgStab*> (solver())->start_2(this,msg);
 
+  performance_solver_stop_(index_region);
   performance_stop_(perf_compute,__FILE__,__LINE__);
 
 }
@@ -515,6 +556,15 @@ void EnzoBlock::r_solver_bicgstab_start_1(CkReductionMsg* msg) {
 
 void EnzoSolverBiCgStab::start_2(EnzoBlock* block,
 				 CkReductionMsg *msg) throw() {
+  if (mixed_precision_) start_2_<float>     (block,msg);
+  else                  start_2_<enzo_float>(block,msg);
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoSolverBiCgStab::start_2_(EnzoBlock* block,
+				  CkReductionMsg *msg) throw() {
 
 
   TRACE_BCG(block,this,"start_2");
@@ -535,20 +585,12 @@ void EnzoSolverBiCgStab::start_2(EnzoBlock* block,
 
   Field field = block->data()->field();
 
-  /// update B and initialize temporary vectors (on leaf blocks only)
-
-  std::vector<long double> reduce;
-  reduce.resize(3+1);
-  reduce.clear();
-  reduce[0] = 3;
+  /// update B (on leaf blocks only)
 
   if (is_finest_(block)) {
 
     /// access relevant fields
     enzo_float* B  = (enzo_float*) field.values(ib_);
-    enzo_float* R0 = (enzo_float*) field.values(ir0_);
-    enzo_float* P  = (enzo_float*) field.values(ip_);
-    enzo_float* R  = (enzo_float*) field.values(ir_);
     enzo_float* X  = (enzo_float*) field.values(ix_);
 
     /// for singular problems, project B into R(A)
@@ -567,9 +609,39 @@ void EnzoSolverBiCgStab::start_2(EnzoBlock* block,
 	X[i] -= x_shift;
       }
     }
+  }
+
+  restart_<T>(block);
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoSolverBiCgStab::restart_(EnzoBlock* block) throw() {
+
+  TRACE_BCG(block,this,"restart");
+
+  /// access field container on this block
+
+  Field field = block->data()->field();
+
+  /// initialize temporary vectors (on leaf blocks only)
+
+  std::vector<long double> reduce;
+  reduce.resize(3+1);
+  reduce.clear();
+  reduce[0] = 3;
+
+  if (is_finest_(block)) {
+
+    /// access relevant fields
+    enzo_float* B  = (enzo_float*) field.values(ib_);
+    T* R0 = (T*) field.values(ir0_);
+    T* P  = (T*) field.values(ip_);
+    T* R  = (T*) field.values(ir_);
 
     // recompute residual given shifted B and X
-    A_->residual (ir_, ib_, ix_, block);
+    residual_<T> (block);
 
     /// LINE 01:  R0 = B - A * X_0
     /// LINE 02:  P0 = R0
@@ -622,9 +694,11 @@ void EnzoSolverBiCgStab::start_2(EnzoBlock* block,
 void EnzoBlock::r_solver_bicgstab_start_3(CkReductionMsg* msg) {
 
   performance_start_(perf_compute,__FILE__,__LINE__);
+  const int index_region = performance_solver_start_();
 
   static_cast<EnzoSolverBiCgStab*> (solver())->loop_0a(this,msg);
   
+  performance_solver_stop_(index_region);
   performance_stop_(perf_compute,__FILE__,__LINE__);
 }
 
@@ -670,6 +744,14 @@ void EnzoSolverBiCgStab::loop_0b(EnzoBlock* block,
 //----------------------------------------------------------------------
 
 void EnzoSolverBiCgStab::loop_0(EnzoBlock* block) throw() {
+  if (mixed_precision_) loop_0_<float>     (block);
+  else                  loop_0_<enzo_float>(block);
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoSolverBiCgStab::loop_0_(EnzoBlock* block) throw() {
 
   /// verify legal floating-point value for preceding reduction result
 
@@ -683,7 +765,13 @@ void EnzoSolverBiCgStab::loop_0(EnzoBlock* block) throw() {
   const bool reuse_x = reuse_solution_ (cycle);
 
   const int iter = (s_iter_(block));
-  if (iter == 0) {
+
+  /// whether the residual was just recomputed by restart_() in a
+  /// mixed-precision solve, in which case R0 == R
+  const bool is_restart =
+    mixed_precision_ && (iter > 0) && (iter == s_iter_exact_(block));
+
+  if (iter == 0 || is_restart) {
     const long double s_r0s = S(r0s);
     const long double s_c =   S(c);
     if (is_singular_()) {
@@ -691,9 +779,9 @@ void EnzoSolverBiCgStab::loop_0(EnzoBlock* block) throw() {
 	
       if (is_finest_(block)) {
 	Field field = block->data()->field();
-	enzo_float* R0 = (enzo_float*) field.values(ir0_);
-	enzo_float* P  = (enzo_float*) field.values(ip_);
-	enzo_float* R  = (enzo_float*) field.values(ir_);
+	T* R0 = (T*) field.values(ir0_);
+	T* P  = (T*) field.values(ip_);
+	T* R  = (T*) field.values(ir_);
 	for (int i=0; i<m_; i++) {
 	  R0[i] -= shift;
 	  R[i]  -= shift;
@@ -703,6 +791,8 @@ void EnzoSolverBiCgStab::loop_0(EnzoBlock* block) throw() {
 	TRACE_SCALAR(block,"beta_n",S(beta_n));
       }
     }
+  }
+  if (iter == 0) {
     S(rho0) = sqrt(S(bnorm)); // ||B||
     
     TRACE_SCALAR(block,"rho0_",S(rho0));
@@ -713,6 +803,7 @@ void EnzoSolverBiCgStab::loop_0(EnzoBlock* block) throw() {
     S(err_min) = S(err);
     S(err_max) = S(err);
   } else {
+    if (is_restart) S(rr) = S(beta_n);
     S(err) =
       sqrt(S(rr)) / S(rho0);
     S(err_min) =
@@ -722,9 +813,20 @@ void EnzoSolverBiCgStab::loop_0(EnzoBlock* block) throw() {
   }
   TRACE_SCALAR(block,"err_",S(err));
 
+  /// In mixed precision, only accept convergence of a residual
+  /// computed directly from X, and recompute it once the recurrence
+  /// residual has been sufficiently reduced
 
-  const bool is_converged = (S(err) < res_tol_);
+  const bool is_exact =
+    (! mixed_precision_) || (iter == s_iter_exact_(block));
+
+  if (is_exact) S(err_exact) = S(err);
+
+  const bool is_converged = is_exact && (S(err) < res_tol_);
   const bool is_diverged  = (iter >= iter_max_);
+  const bool is_refine = (! is_exact) &&
+    ( (S(err) < res_tol_) ||
+      (S(err) < MIXED_PRECISION_TOLERANCE*S(err_exact)) );
 
   if (is_converged) {
     if (block->level() == coarse_level_) {
@@ -798,6 +900,12 @@ void EnzoSolverBiCgStab::loop_0(EnzoBlock* block) throw() {
     this->end(block, return_diverged);
 
     
+  } else if (is_refine) {
+
+    s_iter_exact_(block) = iter;
+
+    restart_<T>(block);
+
   } else {
 
     loop_2(block);
@@ -808,6 +916,14 @@ void EnzoSolverBiCgStab::loop_0(EnzoBlock* block) throw() {
 //----------------------------------------------------------------------
 
 void EnzoSolverBiCgStab::loop_2(EnzoBlock* block) throw() {
+  if (mixed_precision_) loop_2_<float>     (block);
+  else                  loop_2_<enzo_float>(block);
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoSolverBiCgStab::loop_2_(EnzoBlock* block) throw() {
 
   /// access field container on this block
 
@@ -817,7 +933,7 @@ void EnzoSolverBiCgStab::loop_2(EnzoBlock* block) throw() {
 
   if (index_precon_ >= 0) {
 
-    enzo_float * Y = (enzo_float*) field.values(iy_);
+    T* Y = (T*) field.values(iy_);
 
     for (int i=0; i<m_; i++) Y[i] = 0.0;
 
@@ -847,7 +963,7 @@ void EnzoSolverBiCgStab::loop_2(EnzoBlock* block) throw() {
 #ifdef DEBUG_READ
     char buffer[40];
     sprintf (buffer,"Q.%s",block->name().c_str());
-    enzo_float * P = (enzo_float*) field.values(ip_);
+    T* P = (T*) field.values(ip_);
     FILE * fp = fopen(buffer,"r");
     for (int i=0; i<m_; i++) fscanf (fp,"%g",P+i);
     fclose(fp);
@@ -861,8 +977,8 @@ void EnzoSolverBiCgStab::loop_2(EnzoBlock* block) throw() {
     
   } else { // no preconditioner
 
-    enzo_float * Y = (enzo_float*) field.values(iy_);
-    enzo_float * P = (enzo_float*) field.values(ip_);
+    T* Y = (T*) field.values(iy_);
+    T* P = (T*) field.values(ip_);
     
     /// LINE 04: Y = M \ P  [ M = I ]
     for (int i=0; i<m_; i++) Y[i] = P[i];
@@ -880,9 +996,11 @@ void EnzoBlock::p_solver_bicgstab_loop_2() {
   TRACE_BCG(this,static_cast<EnzoSolverBiCgStab*> (solver()),"p_loop_2");
 
   performance_start_(perf_compute,__FILE__,__LINE__);
+  const int index_region = performance_solver_start_();
 
   static_cast<EnzoSolverBiCgStab*> (solver())->loop_25(this);
   
+  performance_solver_stop_(index_region);
   performance_stop_(perf_compute,__FILE__,__LINE__);
 
 }
@@ -912,9 +1030,11 @@ void EnzoBlock::p_solver_bicgstab_loop_3() {
   TRACE_BCG(this,static_cast<EnzoSolverBiCgStab*> (solver()),"p_loop_3");
 
   performance_start_(perf_compute,__FILE__,__LINE__);
+  const int index_region = performance_solver_start_();
 
   static_cast<EnzoSolverBiCgStab*> (solver())->loop_4(this);
   
+  performance_solver_stop_(index_region);
   performance_stop_(perf_compute,__FILE__,__LINE__);
   
 }
@@ -922,6 +1042,14 @@ void EnzoBlock::p_solver_bicgstab_loop_3() {
 //----------------------------------------------------------------------
 
 void EnzoSolverBiCgStab::loop_4(EnzoBlock* block) throw() {
+  if (mixed_precision_) loop_4_<float>     (block);
+  else                  loop_4_<enzo_float>(block);
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoSolverBiCgStab::loop_4_(EnzoBlock* block) throw() {
 
   TRACE_BCG(block,this,"loop_4");
   
@@ -952,8 +1080,8 @@ void EnzoSolverBiCgStab::loop_4(EnzoBlock* block) throw() {
   
   if (is_finest_(block)) {
     
-    enzo_float* R0 = (enzo_float*) field.values(ir0_);
-    enzo_float* V  = (enzo_float*) field.values(iv_);
+    T* R0 = (T*) field.values(ir0_);
+    T* V  = (T*) field.values(iv_);
 
     /// LINE 07 [part]  vr0_ = V*R0
     
@@ -971,8 +1099,8 @@ void EnzoSolverBiCgStab::loop_4(EnzoBlock* block) throw() {
 
     if (is_singular_()) {
 
-      enzo_float* Y = (enzo_float*) field.values(iy_);
-      enzo_float* V = (enzo_float*) field.values(iv_);
+      T* Y = (T*) field.values(iy_);
+      T* V = (T*) field.values(iv_);
 
       /// ys_ = sum (Y[i])
       /// vs_ = sum (V[i])
@@ -1018,9 +1146,11 @@ void EnzoSolverBiCgStab::loop_4(EnzoBlock* block) throw() {
 void EnzoBlock::r_solver_bicgstab_loop_5(CkReductionMsg* msg) {
 
   performance_start_(perf_compute,__FILE__,__LINE__);
+  const int index_region = performance_solver_start_();
 
   static_cast<EnzoSolverBiCgStab*> (solver())->loop_6(this,msg);
 
+  performance_solver_stop_(index_region);
   performance_stop_(perf_compute,__FILE__,__LINE__);
 }
 
@@ -1028,6 +1158,15 @@ void EnzoBlock::r_solver_bicgstab_loop_5(CkReductionMsg* msg) {
 
 void EnzoSolverBiCgStab::loop_6(EnzoBlock* block,
 				CkReductionMsg * msg) throw() {
+  if (mixed_precision_) loop_6_<float>     (block,msg);
+  else                  loop_6_<enzo_float>(block,msg);
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoSolverBiCgStab::loop_6_(EnzoBlock* block,
+				 CkReductionMsg * msg) throw() {
 
   TRACE_BCG(block,this,"loop_6");
 
@@ -1061,8 +1200,8 @@ void EnzoSolverBiCgStab::loop_6(EnzoBlock* block,
 
     if (is_singular_()) {
     
-      enzo_float* Y = (enzo_float*) field.values(iy_);
-      enzo_float* V = (enzo_float*) field.values(iv_);
+      T* Y = (T*) field.values(iy_);
+      T* V = (T*) field.values(iv_);
 
       enzo_float y_shift = ys / S(c);
       enzo_float v_shift = vs / S(c);
@@ -1087,11 +1226,11 @@ void EnzoSolverBiCgStab::loop_6(EnzoBlock* block,
     /// update vectors (on leaf blocks only)
 
     /// access relevant fields
-    enzo_float* Q = (enzo_float*) field.values(iq_);
-    enzo_float* R = (enzo_float*) field.values(ir_);
-    enzo_float* V = (enzo_float*) field.values(iv_);
+    T* Q = (T*) field.values(iq_);
+    T* R = (T*) field.values(ir_);
+    T* V = (T*) field.values(iv_);
     enzo_float* X = (enzo_float*) field.values(ix_);
-    enzo_float* Y = (enzo_float*) field.values(iy_);
+    T* Y = (T*) field.values(iy_);
 
     /// LINE 08: Q = R - alpha * V
     /// LINE 09: X = X + alpha * Y
@@ -1117,6 +1256,14 @@ void EnzoSolverBiCgStab::loop_6(EnzoBlock* block,
 //----------------------------------------------------------------------
 
 void EnzoSolverBiCgStab::loop_8(EnzoBlock* block) throw() {
+  if (mixed_precision_) loop_8_<float>     (block);
+  else                  loop_8_<enzo_float>(block);
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoSolverBiCgStab::loop_8_(EnzoBlock* block) throw() {
 
   TRACE_BCG(block,this,"loop_8");
 
@@ -1126,7 +1273,7 @@ void EnzoSolverBiCgStab::loop_8(EnzoBlock* block) throw() {
 
   if (index_precon_ >= 0) {
 
-    enzo_float* Y = (enzo_float*) field.values(iy_);
+    T* Y = (T*) field.values(iy_);
 
     for (int i=0; i<m_; i++) Y[i] = 0.0;
 
@@ -1157,7 +1304,7 @@ void EnzoSolverBiCgStab::loop_8(EnzoBlock* block) throw() {
     char buffer[40];
     sprintf (buffer,"Q.%s",block->name().c_str());
     FILE * fp = fopen(buffer,"w");
-    enzo_float * Q = (enzo_float*) field.values(iq_);
+    T* Q = (T*) field.values(iq_);
     for (int i=0; i<m_; i++) fprintf (fp,"%g\n",Q[i]);
     fclose(fp);
 #endif    
@@ -1169,8 +1316,8 @@ void EnzoSolverBiCgStab::loop_8(EnzoBlock* block) throw() {
     
   } else {
 
-    enzo_float * Y = (enzo_float*) field.values(iy_);
-    enzo_float * Q = (enzo_float*) field.values(iq_);
+    T* Y = (T*) field.values(iy_);
+    T* Q = (T*) field.values(iq_);
 
     /// LINE 10: Y = M \ Q  [ M = I ]
 
@@ -1186,9 +1333,11 @@ void EnzoBlock::p_solver_bicgstab_loop_8() {
   TRACE_BCG(this,static_cast<EnzoSolverBiCgStab*> (solver()),"p_loop_8");
 
   performance_start_(perf_compute,__FILE__,__LINE__);
+  const int index_region = performance_solver_start_();
 
   static_cast<EnzoSolverBiCgStab*> (solver())->loop_85(this);
   
+  performance_solver_stop_(index_region);
   performance_stop_(perf_compute,__FILE__,__LINE__);
 
 }
@@ -1218,9 +1367,11 @@ void EnzoBlock::p_solver_bicgstab_loop_9() {
 
   TRACE_BCG(this,static_cast<EnzoSolverBiCgStab*> (solver()),"p_loop_9");
   performance_start_(perf_compute,__FILE__,__LINE__);
+  const int index_region = performance_solver_start_();
   
   static_cast<EnzoSolverBiCgStab*> (solver())->loop_10(this);
   
+  performance_solver_stop_(index_region);
   performance_stop_(perf_compute,__FILE__,__LINE__);
   
 }
@@ -1228,6 +1379,14 @@ void EnzoBlock::p_solver_bicgstab_loop_9() {
 //----------------------------------------------------------------------
 
 void EnzoSolverBiCgStab::loop_10(EnzoBlock* block) throw() {
+  if (mixed_precision_) loop_10_<float>     (block);
+  else                  loop_10_<enzo_float>(block);
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoSolverBiCgStab::loop_10_(EnzoBlock* block) throw() {
 
   TRACE_BCG(block,this,"loop_10");
 
@@ -1255,8 +1414,8 @@ void EnzoSolverBiCgStab::loop_10(EnzoBlock* block) throw() {
   
   if (is_finest_(block)) {
     
-    enzo_float* U  = (enzo_float*) field.values(iu_);
-    enzo_float* Q  = (enzo_float*) field.values(iq_);
+    T* U  = (T*) field.values(iu_);
+    T* Q  = (T*) field.values(iq_);
     
     /// omega_n = DOT(U, Q)
     /// omega_d = DOT(U, U)
@@ -1275,8 +1434,8 @@ void EnzoSolverBiCgStab::loop_10(EnzoBlock* block) throw() {
 
     if (is_singular_()) {
 
-      enzo_float* Y = (enzo_float*) field.values(iy_);
-      enzo_float* U = (enzo_float*) field.values(iu_);
+      T* Y = (T*) field.values(iy_);
+      T* U = (T*) field.values(iu_);
 
       /// ys_ = SUM(Y)
       /// us_ = SUM(U)
@@ -1333,9 +1492,11 @@ void EnzoSolverBiCgStab::loop_10(EnzoBlock* block) throw() {
 void EnzoBlock::r_solver_bicgstab_loop_11(CkReductionMsg* msg) {
 
   performance_start_(perf_compute,__FILE__,__LINE__);
+  const int index_region = performance_solver_start_();
 
   static_cast<EnzoSolverBiCgStab*> (solver())->loop_12(this,msg);
   
+  performance_solver_stop_(index_region);
   performance_stop_(perf_compute,__FILE__,__LINE__);
 }
 
@@ -1343,6 +1504,15 @@ void EnzoBlock::r_solver_bicgstab_loop_11(CkReductionMsg* msg) {
 
 void EnzoSolverBiCgStab::loop_12(EnzoBlock* block,
 				 CkReductionMsg * msg) throw() {
+  if (mixed_precision_) loop_12_<float>     (block,msg);
+  else                  loop_12_<enzo_float>(block,msg);
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoSolverBiCgStab::loop_12_(EnzoBlock* block,
+				  CkReductionMsg * msg) throw() {
 
   TRACE_BCG(block,this,"loop_12");
 
@@ -1383,8 +1553,8 @@ void EnzoSolverBiCgStab::loop_12(EnzoBlock* block,
     S(omega_d) -= us*us/ S(c);
 
     if (is_finest_(block)) {
-      enzo_float* Y = (enzo_float*) field.values(iy_);
-      enzo_float* U = (enzo_float*) field.values(iu_);
+      T* Y = (T*) field.values(iy_);
+      T* U = (T*) field.values(iu_);
       enzo_float y_shift = ys / S(c);
       enzo_float u_shift = us / S(c);
       for (int i=0; i<m_; i++) {
@@ -1428,10 +1598,10 @@ void EnzoSolverBiCgStab::loop_12(EnzoBlock* block,
   if (is_finest_(block)) {
 
     enzo_float* X = (enzo_float*) field.values(ix_);
-    enzo_float* Y = (enzo_float*) field.values(iy_);
-    enzo_float* R = (enzo_float*) field.values(ir_);
-    enzo_float* Q = (enzo_float*) field.values(iq_);
-    enzo_float* U = (enzo_float*) field.values(iu_);
+    T* Y = (T*) field.values(iy_);
+    T* R = (T*) field.values(ir_);
+    T* Q = (T*) field.values(iq_);
+    T* U = (T*) field.values(iu_);
     
     /// LINE 13:     X = X + omega * Y
     /// LINE 14:     R = Q - omega * U
@@ -1457,8 +1627,8 @@ void EnzoSolverBiCgStab::loop_12(EnzoBlock* block,
   
   if (is_finest_(block)) {
     
-    enzo_float* R  = (enzo_float*) field.values(ir_);
-    enzo_float* R0 = (enzo_float*) field.values(ir0_);
+    T* R  = (T*) field.values(ir_);
+    T* R0 = (T*) field.values(ir0_);
     
     for (int iz=gz_; iz<mz_-gz_; iz++) {
       for (int iy=gy_; iy<my_-gy_; iy++) {
@@ -1500,9 +1670,11 @@ void EnzoSolverBiCgStab::loop_12(EnzoBlock* block,
 void EnzoBlock::r_solver_bicgstab_loop_13(CkReductionMsg* msg) {
 
   performance_start_(perf_compute,__FILE__,__LINE__);
+  const int index_region = performance_solver_start_();
 
   static_cast<EnzoSolverBiCgStab*> (solver())->loop_14(this,msg);
 
+  performance_solver_stop_(index_region);
   performance_stop_(perf_compute,__FILE__,__LINE__);
 }
 
@@ -1510,6 +1682,15 @@ void EnzoBlock::r_solver_bicgstab_loop_13(CkReductionMsg* msg) {
 
 void EnzoSolverBiCgStab::loop_14(EnzoBlock* block,
 				 CkReductionMsg * msg) throw() {
+  if (mixed_precision_) loop_14_<float>     (block,msg);
+  else                  loop_14_<enzo_float>(block,msg);
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoSolverBiCgStab::loop_14_(EnzoBlock* block,
+				  CkReductionMsg * msg) throw() {
 
   TRACE_BCG(block,this,"loop_14");
 
@@ -1556,9 +1737,9 @@ void EnzoSolverBiCgStab::loop_14(EnzoBlock* block,
   
   if (is_finest_(block)) {
 
-    enzo_float* P = (enzo_float*) field.values(ip_);
-    enzo_float* R = (enzo_float*) field.values(ir_);
-    enzo_float* V = (enzo_float*) field.values(iv_);
+    T* P = (T*) field.values(ip_);
+    T* R = (T*) field.values(ir_);
+    T* V = (T*) field.values(iv_);
 
     /// LINE 16:     P = R + beta * (P - omega * V)
 
@@ -1588,9 +1769,11 @@ void EnzoSolverBiCgStab::loop_14(EnzoBlock* block,
 void EnzoBlock::r_solver_bicgstab_loop_15(CkReductionMsg* msg) {
 
   performance_start_(perf_compute,__FILE__,__LINE__);
+  const int index_region = performance_solver_start_();
 
   static_cast<EnzoSolverBiCgStab*> (solver())->loop_0b(this,msg);
 
+  performance_solver_stop_(index_region);
   performance_stop_(perf_compute,__FILE__,__LINE__);
 }
 
@@ -1605,6 +1788,36 @@ void EnzoSolverBiCgStab::end (EnzoBlock* block, int retval) throw () {
   Solver::end_(block);
 }
 
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoSolverBiCgStab::residual_(EnzoBlock* block) throw() {
+
+  if (! mixed_precision_) {
+    A_->residual (ir_, ib_, ix_, block);
+    return;
+  }
+
+  /// compute A*X in the precision of X, since R = B - A*X is much
+  /// smaller than either term near convergence
+
+  Field field = block->data()->field();
+
+  field.allocate_temporary(iw_);
+
+  enzo_float* B = (enzo_float*) field.values(ib_);
+  enzo_float* W = (enzo_float*) field.values(iw_);
+  T* R = (T*) field.values(ir_);
+
+  std::fill_n(W,m_,0.0);
+
+  A_->matvec(iw_, ix_, block);
+
+  for (int i=0; i<m_; i++) R[i] = B[i] - W[i];
+
+  field.deallocate_temporary(iw_);
+}
+
 //======================================================================
 
 void EnzoSolverBiCgStab::inner_product_
@@ -48,7 +48,8 @@ public: // interface
 		     int iter_max, 
 		     double res_tol,
 		     int index_precon,
-		     int coarse_level);
+		     int coarse_level,
+		     bool mixed_precision = false);
 
   /// default constructor
   EnzoSolverBiCgStab()
@@ -60,6 +61,7 @@ public: // interface
       is_r0s_(-1),    is_c_(-1),       is_bs_(-1),       is_xs_(-1),
       is_bnorm_(-1),  is_vr0_(-1),     is_ys_(-1),       is_vs_(-1),
       is_us_(-1),     is_qs_(-1),      is_dot_sync_(-1), is_iter_(-1),
+      is_err_exact_(-1), is_iter_exact_(-1),
       res_tol_(0),
       index_precon_(-1),
       iter_max_(-1),
@@ -75,7 +77,9 @@ public: // interface
       gx_(0), gy_(0), gz_(0),
       coarse_level_(0),
       ir_loop_3_(-1),
-      ir_loop_9_(-1)
+      ir_loop_9_(-1),
+      mixed_precision_(false),
+      iw_(-1)
   {};
 
   /// Charm++ PUP::able declarations
@@ -91,6 +95,7 @@ public: // interface
       is_r0s_(-1),    is_c_(-1),       is_bs_(-1),       is_xs_(-1),
       is_bnorm_(-1),  is_vr0_(-1),     is_ys_(-1),       is_vs_(-1),
       is_us_(-1),     is_qs_(-1),      is_dot_sync_(-1), is_iter_(-1),
+      is_err_exact_(-1), is_iter_exact_(-1),
       res_tol_(0.0),
       index_precon_(-1),
       iter_max_(0), 
@@ -100,7 +105,9 @@ public: // interface
       gx_(0), gy_(0), gz_(0),
       coarse_level_(0),
       ir_loop_3_(-1),
-      ir_loop_9_(-1)
+      ir_loop_9_(-1),
+      mixed_precision_(false),
+      iw_(-1)
           
   {}
 
@@ -169,6 +176,39 @@ public: // interface
   /// internal routine to handle actual start to solver
   void compute_(EnzoBlock * enzo_block) throw();
 
+  /// Templated on the precision T of the BiCgStab vectors R, R0, P,
+  /// Y, V, Q, U
+  
+  template <class T>
+  void compute_(EnzoBlock * enzo_block) throw();
+  template <class T>
+  void start_2_(EnzoBlock* enzo_block, CkReductionMsg * msg) throw();
+  template <class T>
+  void loop_0_(EnzoBlock* enzo_block) throw();
+  template <class T>
+  void loop_2_(EnzoBlock* enzo_block) throw();
+  template <class T>
+  void loop_4_(EnzoBlock* enzo_block) throw();
+  template <class T>
+  void loop_6_(EnzoBlock* enzo_block, CkReductionMsg * msg) throw();
+  template <class T>
+  void loop_8_(EnzoBlock* enzo_block) throw();
+  template <class T>
+  void loop_10_(EnzoBlock* enzo_block) throw();
+  template <class T>
+  void loop_12_(EnzoBlock* enzo_block, CkReductionMsg * msg) throw();
+  template <class T>
+  void loop_14_(EnzoBlock* enzo_block, CkReductionMsg * msg) throw();
+
+  /// Compute R = B - A*X, set R0 = P = R, and begin DOT(R,R0), B*B,
+  /// and SUM(R); also used to restart a mixed-precision solve
+  template <class T>
+  void restart_(EnzoBlock* enzo_block) throw();
+
+  /// Compute R = B - A*X, with A*X computed in the precision of X
+  template <class T>
+  void residual_(EnzoBlock* enzo_block) throw();
+
   /// Allocate temporary Fields
   void allocate_temporary_(Block * block)
   {
@@ -242,6 +282,9 @@ protected:
   int & s_iter_(EnzoBlock * block)
   { return *block->data()->scalar_int().value(is_iter_); }
 
+  int & s_iter_exact_(EnzoBlock * block)
+  { return *block->data()->scalar_int().value(is_iter_exact_); }
+
   /// Register all refresh phases
   void new_register_refresh_();
   
@@ -278,6 +321,11 @@ protected: // attributes
   int is_dot_sync_;
   int is_iter_;
 
+  /// Error and iteration when the residual was last computed directly
+  /// from X in a mixed-precision solve
+  int is_err_exact_;
+  int is_iter_exact_;
+
   typedef void (EnzoSolverBiCgStab::*enzo_solver_bicgstab_member)(EnzoBlock *, CkReductionMsg *) ;
   
   /// Convergence tolerance on the relative residual
@@ -309,6 +357,13 @@ protected: // attributes
   /// Refresh id's
   int ir_loop_3_;
   int ir_loop_9_;
+
+  /// Whether BiCgStab vectors are single precision, with the residual
+  /// periodically recomputed from X in full precision
+  bool mixed_precision_;
+
+  /// Full-precision temporary for A*X when recomputing the residual
+  int iw_;
 };
 
 #endif /* ENZO_ENZO_SOLVER_BICGSTAB_HPP */
@@ -19,7 +19,8 @@ EnzoSolverCg::EnzoSolverCg
  int solve_type,
  int min_level, int max_level,
  int iter_max, double res_tol,
- int index_precon
+ int index_precon,
+ bool mixed_precision
  )
   : Solver(name,
 	   field_x,
@@ -44,7 +45,11 @@ EnzoSolverCg::EnzoSolverCg
     bc_(0.0),
     local_(solve_type==solve_block),
     ir_matvec_(-1),
-    ir_loop_2_(-1)
+    ir_loop_2_(-1),
+    mixed_precision_(mixed_precision),
+    iw_(-1),
+    iter_exact_(0),
+    rr_exact_(0.0)
     
 {
   FieldDescr * field_descr = cello::field_descr();
@@ -54,6 +59,20 @@ EnzoSolverCg::EnzoSolverCg
   iy_ = field_descr->insert_temporary();
   iz_ = field_descr->insert_temporary();
 
+  if (mixed_precision_) {
+
+    // CG vectors are single precision; X and B keep their precision,
+    // and the residual is periodically recomputed from X using the
+    // full-precision temporary W
+
+    field_descr->set_precision (id_,precision_single);
+    field_descr->set_precision (ir_,precision_single);
+    field_descr->set_precision (iy_,precision_single);
+    field_descr->set_precision (iz_,precision_single);
+
+    iw_ = field_descr->insert_temporary();
+  }
+
   /// Initialize default Refresh
 
   field_descr->ghost_depth    (ib_,&gx_,&gy_,&gz_);
@@ -148,6 +167,11 @@ void EnzoSolverCg::pup (PUP::er &p)
 
   p | ir_matvec_;
   p | ir_loop_2_;
+
+  p | mixed_precision_;
+  p | iw_;
+  p | iter_exact_;
+  p | rr_exact_;
   
 }
 
@@ -178,6 +202,15 @@ void EnzoSolverCg::apply ( std::shared_ptr<Matrix> A, Block * block) throw()
 
 //======================================================================
 
+void EnzoSolverCg::compute_ (EnzoBlock * enzo_block) throw()
+{
+  if (mixed_precision_) compute_<float>     (enzo_block);
+  else                  compute_<enzo_float>(enzo_block);
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
 void EnzoSolverCg::compute_ (EnzoBlock * enzo_block) throw()
 //     X = initial guess
 //     B = right-hand side
@@ -188,11 +221,12 @@ void EnzoSolverCg::compute_ (EnzoBlock * enzo_block) throw()
 {
   // If local, call serial CG solver
   if (local_) {
-    local_cg_(enzo_block);
+    local_cg_<T>(enzo_block);
     return;
   }
   
   iter_ = 0;
+  iter_exact_ = 0;
 
   Field field = enzo_block->data()->field();
 
@@ -201,9 +235,9 @@ void EnzoSolverCg::compute_ (EnzoBlock * enzo_block) throw()
   //  std::fill_n(X,mx_*my_*mz_,0.0);
 
   enzo_float * B = (enzo_float*) field.values(ib_);
-  enzo_float * R = (enzo_float*) field.values(ir_);
-  enzo_float * D = (enzo_float*) field.values(id_);
-  enzo_float * Z = (enzo_float*) field.values(iz_);
+  T * R = (T*) field.values(ir_);
+  T * D = (T*) field.values(id_);
+  T * Z = (T*) field.values(iz_);
 
   if (is_finest_(enzo_block)) {
 
@@ -219,9 +253,6 @@ void EnzoSolverCg::compute_ (EnzoBlock * enzo_block) throw()
 
   if (is_finest_(enzo_block)) {
 
-    enzo_float * B = (enzo_float*) field.values(ib_);
-    enzo_float * R = (enzo_float*) field.values(ir_);
-
     for (int iz=gz_; iz<mz_-gz_; iz++) {
       for (int iy=gy_; iy<my_-gy_; iy++) {
 	for (int ix=gx_; ix<mx_-gx_; ix++) {
@@ -249,11 +280,13 @@ void EnzoBlock::r_solver_cg_loop_0a (CkReductionMsg * msg)
 /// ==> refresh P for AP = MATVEC (A,P)
 {
   performance_start_(perf_compute,__FILE__,__LINE__);
+  const int index_region = performance_solver_start_();
 
   EnzoSolverCg * solver = 
     static_cast<EnzoSolverCg*> (this->solver());
 
   solver->loop_0a(this,msg);
+  performance_solver_stop_(index_region);
   performance_stop_(perf_compute,__FILE__,__LINE__);
 }
 
@@ -287,11 +320,13 @@ void EnzoBlock::r_solver_cg_loop_0b (CkReductionMsg * msg)
 /// ==> refresh P for AP = MATVEC (A,P)
 {
   performance_start_(perf_compute,__FILE__,__LINE__);
+  const int index_region = performance_solver_start_();
 
   EnzoSolverCg * solver = 
     static_cast<EnzoSolverCg*> (this->solver());
 
   solver->loop_0b(this,msg);
+  performance_solver_stop_(index_region);
   performance_stop_(perf_compute,__FILE__,__LINE__);
 }
 
@@ -321,6 +356,7 @@ void EnzoBlock::p_solver_cg_matvec()
 {
   
   performance_start_(perf_compute,__FILE__,__LINE__);
+  const int index_region = performance_solver_start_();
 
   EnzoSolverCg * solver = 
     static_cast<EnzoSolverCg*> (this->solver());
@@ -332,12 +368,22 @@ void EnzoBlock::p_solver_cg_matvec()
 
   solver->shift_1(this);
 
+  performance_solver_stop_(index_region);
   performance_stop_(perf_compute,__FILE__,__LINE__);
 }
 
 //----------------------------------------------------------------------
 
 void EnzoSolverCg::shift_1 (EnzoBlock * enzo_block) throw()
+{
+  if (mixed_precision_) shift_1_<float>     (enzo_block);
+  else                  shift_1_<enzo_float>(enzo_block);
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoSolverCg::shift_1_ (EnzoBlock * enzo_block) throw()
 {
   Data * data = enzo_block->data();
   Field field = data->field();
@@ -345,7 +391,7 @@ void EnzoSolverCg::shift_1 (EnzoBlock * enzo_block) throw()
   if (is_finest_(enzo_block)) {
 
     enzo_float * B  = (enzo_float*) field.values(ib_);
-    enzo_float * R  = (enzo_float*) field.values(ir_);
+    T * R  = (T*) field.values(ir_);
 
     if (iter_ == 0 && A_->is_singular())  {
 
@@ -357,8 +403,8 @@ void EnzoSolverCg::shift_1 (EnzoBlock * enzo_block) throw()
       // shift_ (B,shift,B);
   
       long double shift = -bs_ / bc_;
-      enzo_float * D = (enzo_float*) field.values(id_);
-      enzo_float * Z = (enzo_float*) field.values(iz_);
+      T * D = (T*) field.values(id_);
+      T * Z = (T*) field.values(iz_);
       for (int i=0; i<mx_*my_*mz_; i++) {
 	R[i] += shift;
 	B[i] += shift;
@@ -375,7 +421,7 @@ void EnzoSolverCg::shift_1 (EnzoBlock * enzo_block) throw()
 
   if (is_finest_(enzo_block)) {
 
-    enzo_float * R  = (enzo_float*) field.values(ir_);
+    T * R  = (T*) field.values(ir_);
     // reduce = field.dot(ir_,ir_);
 
     for (int iz=gz_; iz<mz_-gz_; iz++) {
@@ -401,16 +447,18 @@ void EnzoSolverCg::shift_1 (EnzoBlock * enzo_block) throw()
 void EnzoBlock::r_solver_cg_shift_1 (CkReductionMsg * msg)
 {
   performance_start_(perf_compute,__FILE__,__LINE__);
+  const int index_region = performance_solver_start_();
 
   EnzoSolverCg * solver = 
     static_cast<EnzoSolverCg*> (this->solver());
 
-  solver->set_rr( ((long double*)msg->getData())[0] );
+  solver->set_rr_exact( ((long double*)msg->getData())[0] );
 
   delete msg;
 
   solver -> loop_2a(this);
 
+  performance_solver_stop_(index_region);
   performance_stop_(perf_compute,__FILE__,__LINE__);
 }
 
@@ -431,11 +479,13 @@ void EnzoSolverCg::loop_2a (EnzoBlock * enzo_block) throw()
 void EnzoBlock::p_solver_cg_loop_2 ()
 {
   performance_start_(perf_compute,__FILE__,__LINE__);
+  const int index_region = performance_solver_start_();
   
   EnzoSolverCg * solver = 
     static_cast<EnzoSolverCg*> (this->solver());
 
   solver->loop_2b(this);
+  performance_solver_stop_(index_region);
   performance_stop_(perf_compute,__FILE__,__LINE__);
   
 }
@@ -443,6 +493,15 @@ void EnzoBlock::p_solver_cg_loop_2 ()
 //----------------------------------------------------------------------
 
 void EnzoSolverCg::loop_2b (EnzoBlock * enzo_block) throw()
+{
+  if (mixed_precision_) loop_2b_<float>     (enzo_block);
+  else                  loop_2b_<enzo_float>(enzo_block);
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoSolverCg::loop_2b_ (EnzoBlock * enzo_block) throw()
 {
   if (iter_ == 0) {
     rr0_ = rr_;
@@ -455,8 +514,20 @@ void EnzoSolverCg::loop_2b (EnzoBlock * enzo_block) throw()
 
   if (enzo_block->index().is_root()) monitor_output_(enzo_block);
 
-  const bool is_converged = (rr_ / rr0_ < res_tol_);
+  // In mixed precision, only accept convergence of a residual
+  // computed directly from X, and recompute it once the recurrence
+  // residual has been sufficiently reduced
+
+  const bool is_exact = (! mixed_precision_) || (iter_ == iter_exact_);
+
+  if (is_exact) rr_exact_ = rr_;
+
+  const double tol2 = MIXED_PRECISION_TOLERANCE*MIXED_PRECISION_TOLERANCE;
+  
+  const bool is_converged = is_exact && (rr_ / rr0_ < res_tol_);
   const bool is_diverged = (iter_ >= iter_max_);
+  const bool is_refine = (! is_exact) &&
+    ( (rr_ / rr0_ < res_tol_) || (rr_ < tol2*rr_exact_) );
     
   if (is_converged) {
 
@@ -466,6 +537,10 @@ void EnzoSolverCg::loop_2b (EnzoBlock * enzo_block) throw()
 
     end (enzo_block,return_error);
 
+  } else if (is_refine) {
+
+    refine_<T>(enzo_block);
+
   } else {
 
     // else continue
@@ -482,10 +557,10 @@ void EnzoSolverCg::loop_2b (EnzoBlock * enzo_block) throw()
 
     if (is_finest_(enzo_block)) {
 
-      enzo_float * D = (enzo_float*) field.values(id_);
-      enzo_float * Y = (enzo_float*) field.values(iy_);
-      enzo_float * R = (enzo_float*) field.values(ir_);
-      enzo_float * Z = (enzo_float*) field.values(iz_);
+      T * D = (T*) field.values(id_);
+      T * Y = (T*) field.values(iy_);
+      T * R = (T*) field.values(ir_);
+      T * Z = (T*) field.values(iz_);
 
       for (int iz=gz_; iz<mz_-gz_; iz++) {
 	for (int iy=gy_; iy<my_-gy_; iy++) {
@@ -513,6 +588,7 @@ void EnzoSolverCg::loop_2b (EnzoBlock * enzo_block) throw()
 void EnzoBlock::r_solver_cg_loop_3 (CkReductionMsg * msg)
 {
   performance_start_(perf_compute,__FILE__,__LINE__);
+  const int index_region = performance_solver_start_();
 
   EnzoSolverCg * solver = 
     static_cast<EnzoSolverCg*> (this->solver());
@@ -527,6 +603,7 @@ void EnzoBlock::r_solver_cg_loop_3 (CkReductionMsg * msg)
 
   solver -> loop_4(this);
 
+  performance_solver_stop_(index_region);
   performance_stop_(perf_compute,__FILE__,__LINE__);
 
 }
@@ -534,6 +611,15 @@ void EnzoBlock::r_solver_cg_loop_3 (CkReductionMsg * msg)
 //----------------------------------------------------------------------
 
 void EnzoSolverCg::loop_4 (EnzoBlock * enzo_block) throw ()
+{
+  if (mixed_precision_) loop_4_<float>     (enzo_block);
+  else                  loop_4_<enzo_float>(enzo_block);
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoSolverCg::loop_4_ (EnzoBlock * enzo_block) throw ()
 //  a = rz / dy;
 //  X = X + a*D;
 //  R = R - a*Y;
@@ -554,9 +640,9 @@ void EnzoSolverCg::loop_4 (EnzoBlock * enzo_block) throw ()
   if (is_finest_(enzo_block)) {
 
     enzo_float * X = (enzo_float*) field.values(ix_);
-    enzo_float * D = (enzo_float*) field.values(id_);
-    enzo_float * R = (enzo_float*) field.values(ir_);
-    enzo_float * Y = (enzo_float*) field.values(iy_);
+    T * D = (T*) field.values(id_);
+    T * R = (T*) field.values(ir_);
+    T * Y = (T*) field.values(iy_);
 
     enzo_float a = rz_ / dy_;
 
@@ -569,7 +655,7 @@ void EnzoSolverCg::loop_4 (EnzoBlock * enzo_block) throw ()
       R[i] -= a * Y[i];
     }
 
-    enzo_float * Z = (enzo_float*) field.values(iz_);
+    T * Z = (T*) field.values(iz_);
     
     // M_->matvec(iz_,ir_,enzo_block);
     for (int i=0; i<mx_*my_*mz_; i++) {
@@ -583,8 +669,8 @@ void EnzoSolverCg::loop_4 (EnzoBlock * enzo_block) throw ()
   if (is_finest_(enzo_block)) {
 
     enzo_float * X = (enzo_float*) field.values(ix_);
-    enzo_float * R = (enzo_float*) field.values(ir_);
-    enzo_float * Z = (enzo_float*) field.values(iz_);
+    T * R = (T*) field.values(ir_);
+    T * Z = (T*) field.values(iz_);
 
     //    reduce[0] = field.dot(ir_,iz_);
     //    reduce[1] = sum_(R);
@@ -616,6 +702,7 @@ void EnzoBlock::r_solver_cg_loop_5 (CkReductionMsg * msg)
 /// ==> solver_cg_loop_6
 {
   performance_start_(perf_compute,__FILE__,__LINE__);
+  const int index_region = performance_solver_start_();
 
   EnzoSolverCg * solver = 
     static_cast<EnzoSolverCg*> (this->solver());
@@ -630,12 +717,22 @@ void EnzoBlock::r_solver_cg_loop_5 (CkReductionMsg * msg)
 
   solver -> loop_6(this);
 
+  performance_solver_stop_(index_region);
   performance_stop_(perf_compute,__FILE__,__LINE__);
 }
 
 //----------------------------------------------------------------------
 
 void EnzoSolverCg::loop_6 (EnzoBlock * enzo_block) throw ()
+{
+  if (mixed_precision_) loop_6_<float>     (enzo_block);
+  else                  loop_6_<enzo_float>(enzo_block);
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoSolverCg::loop_6_ (EnzoBlock * enzo_block) throw ()
 //  rz2 = dot(R,Z)
 //  b = rz2 / rz;
 //  D = Z + b*D;
@@ -657,7 +754,7 @@ void EnzoSolverCg::loop_6 (EnzoBlock * enzo_block) throw ()
       // eT*b == sum_i=1,n B[i]
 
       enzo_float * X  = (enzo_float*) field.values(ix_);
-      enzo_float * R  = (enzo_float*) field.values(ir_);
+      T * R  = (T*) field.values(ir_);
 
       // shift_ (X,T(-xs_/bc_),X);
       // shift_ (R,T(-rs_/bc_),R);
@@ -669,8 +766,8 @@ void EnzoSolverCg::loop_6 (EnzoBlock * enzo_block) throw ()
       
     }
 
-    enzo_float * D  = (enzo_float*) field.values(id_);
-    enzo_float * Z  = (enzo_float*) field.values(iz_);
+    T * D  = (T*) field.values(id_);
+    T * Z  = (T*) field.values(iz_);
 
     enzo_float b = rz2_ / rz_;
 
@@ -698,16 +795,91 @@ void EnzoSolverCg::loop_6 (EnzoBlock * enzo_block) throw ()
 
 //----------------------------------------------------------------------
 
+void EnzoSolverCg::refine_ (EnzoBlock * enzo_block) throw()
+{
+  if (mixed_precision_) refine_<float>     (enzo_block);
+  else                  refine_<enzo_float>(enzo_block);
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoSolverCg::refine_ (EnzoBlock * enzo_block) throw()
+//  R = B - A*X
+//  D = Z = R
+//  rr = dot(R,R)
+//  ==> loop_2a
+{
+  long double reduce = 0.0;
+
+  if (is_finest_(enzo_block)) {
+
+    residual_<T>(enzo_block);
+
+    T * R = (T*) enzo_block->data()->field().values(ir_);
+
+    for (int iz=gz_; iz<mz_-gz_; iz++) {
+      for (int iy=gy_; iy<my_-gy_; iy++) {
+	for (int ix=gx_; ix<mx_-gx_; ix++) {
+	  int i = ix + mx_*(iy + my_*iz);
+	  reduce += R[i]*R[i];
+	}
+      }
+    }
+  }
+
+  CkCallback callback(CkIndex_EnzoBlock::r_solver_cg_shift_1(NULL), 
+		      enzo_block->proxy_array());
+
+  enzo_block->contribute (sizeof(long double), &reduce, 
+			  sum_long_double_type, 
+			  callback);
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoSolverCg::residual_ (EnzoBlock * enzo_block) throw()
+{
+  Field field = enzo_block->data()->field();
+
+  // X ghost zones are current: X is only updated using refreshed D
+
+  field.allocate_temporary(iw_);
+
+  enzo_float * B = (enzo_float*) field.values(ib_);
+  enzo_float * W = (enzo_float*) field.values(iw_);
+
+  std::fill_n(W,mx_*my_*mz_,0.0);
+
+  A_->matvec(iw_,ix_,enzo_block);
+
+  T * R = (T*) field.values(ir_);
+  T * D = (T*) field.values(id_);
+  T * Z = (T*) field.values(iz_);
+
+  for (int i=0; i<mx_*my_*mz_; i++) {
+    R[i] = B[i] - W[i];
+    D[i] = R[i];
+    Z[i] = R[i];
+  }
+
+  field.deallocate_temporary(iw_);
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
 void EnzoSolverCg::local_cg_(EnzoBlock * enzo_block)
 {
   Field field = enzo_block->data()->field();
 
   enzo_float * B = (enzo_float*) field.values(ib_);
-  enzo_float * D = (enzo_float*) field.values(id_);
-  enzo_float * R = (enzo_float*) field.values(ir_);
+  T * D = (T*) field.values(id_);
+  T * R = (T*) field.values(ir_);
   enzo_float * X = (enzo_float*) field.values(ix_);
-  enzo_float * Y = (enzo_float*) field.values(iy_);
-  enzo_float * Z = (enzo_float*) field.values(iz_);
+  T * Y = (T*) field.values(iy_);
+  T * Z = (T*) field.values(iz_);
 
   if ( ! is_finest_(enzo_block)) {
     
@@ -727,11 +899,11 @@ void EnzoSolverCg::local_cg_(EnzoBlock * enzo_block)
   bs_ = 0.0;
   bc_ = 0.0;
 
-  refresh_local_(ib_,enzo_block);
-  refresh_local_(ix_,enzo_block);
-  refresh_local_(ir_,enzo_block);
-  refresh_local_(id_,enzo_block);
-  refresh_local_(iz_,enzo_block);
+  refresh_local_<enzo_float>(ib_,enzo_block);
+  refresh_local_<enzo_float>(ix_,enzo_block);
+  refresh_local_<T>(ir_,enzo_block);
+  refresh_local_<T>(id_,enzo_block);
+  refresh_local_<T>(iz_,enzo_block);
 
   // Compute shift and update B if needed
   if (iter_ == 0 && A_->is_singular()) {
@@ -769,16 +941,19 @@ void EnzoSolverCg::local_cg_(EnzoBlock * enzo_block)
   }
 
   rr0_ = rr_;
+  rr_exact_ = rr_;
   
   bool is_converged = (rr_ / rr0_ < res_tol_);
   bool is_diverged = iter_ >= iter_max_;
 
+  const double tol2 = MIXED_PRECISION_TOLERANCE*MIXED_PRECISION_TOLERANCE;
+
   while ( (! is_converged) && (! is_diverged) ) {
 
     rr_min_ = std::min(rr_min_,rr_);
     rr_max_ = std::max(rr_max_,rr_);
 
-    refresh_local_(id_,enzo_block);
+    refresh_local_<T>(id_,enzo_block);
 
     A_->matvec(iy_,id_,enzo_block);
 
@@ -850,6 +1025,29 @@ void EnzoSolverCg::local_cg_(EnzoBlock * enzo_block)
     
     is_converged = (rr_ / rr0_ < res_tol_);
     is_diverged = iter_ >= iter_max_;
+
+    if (mixed_precision_ && (! is_diverged) &&
+	(is_converged || (rr_ < tol2*rr_exact_))) {
+
+      // Recompute the residual in full precision and restart
+
+      refresh_local_<enzo_float>(ix_,enzo_block);
+
+      residual_<T>(enzo_block);
+
+      rr_ = 0.0;
+      for (int iz=gz_; iz<mz_-gz_; iz++) {
+	for (int iy=gy_; iy<my_-gy_; iy++) {
+	  for (int ix=gx_; ix<mx_-gx_; ix++) {
+	    int i = ix + mx_*(iy + my_*iz);
+	    rr_ += R[i]*R[i];
+	  }
+	}
+      }
+      rr_exact_ = rr_;
+
+      is_converged = (rr_ / rr0_ < res_tol_);
+    }
   }
 
   if (is_converged) {
@@ -866,17 +1064,18 @@ void EnzoSolverCg::local_cg_(EnzoBlock * enzo_block)
 
 //----------------------------------------------------------------------
 
+template <class T>
 void EnzoSolverCg::refresh_local_(int ix,EnzoBlock * enzo_block)
 {
 
-  enzo_float * X = (enzo_float*) enzo_block->data()->field().values(ix);
+  T * X = (T*) enzo_block->data()->field().values(ix);
 
   // ASSUMES SINGULAR MATRIX IMPLIES PERIODIC DOMAIN.
 
   if (A_->is_singular()) {
 
     // shift first
-    shift_local_(ix, enzo_block);
+    shift_local_<T>(ix, enzo_block);
     
     // XM ghost <- XP face (y)(z)
     for (int iz=gz_; iz<nz_+gz_; iz++) {
@@ -956,10 +1155,11 @@ void EnzoSolverCg::refresh_local_(int ix,EnzoBlock * enzo_block)
 
 //----------------------------------------------------------------------
 
+template <class T>
 void EnzoSolverCg::shift_local_(int i_x,EnzoBlock * enzo_block)
 {
   if (A_->is_singular()) {
-    enzo_float * X = (enzo_float*) enzo_block->data()->field().values(i_x);
+    T * X = (T*) enzo_block->data()->field().values(i_x);
     long double xs = 0.0;
     long double xc = 0.0;
     for (int iz=gz_; iz<mz_-gz_; iz++) {
@@ -986,7 +1186,8 @@ void EnzoSolverCg::end (EnzoBlock * enzo_block,int retval) throw ()
 ///       ERROR (return-)
 ///    }
 {
-  if (local_ && is_finest_(enzo_block)) refresh_local_(ix_,enzo_block);
+  if (local_ && is_finest_(enzo_block))
+    refresh_local_<enzo_float>(ix_,enzo_block);
 
   Field field = enzo_block->data()->field();
 
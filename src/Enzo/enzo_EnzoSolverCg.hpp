@@ -26,7 +26,8 @@ public: // interface
 		int max_level,
 		int iter_max, 
 		double res_tol,
-		int index_precon);
+		int index_precon,
+		bool mixed_precision = false);
 
   /// Constructor
   EnzoSolverCg() throw()
@@ -46,7 +47,11 @@ public: // interface
     bc_(0.0),
     local_(false),
     ir_matvec_(-1),
-    ir_loop_2_(-1)
+    ir_loop_2_(-1),
+    mixed_precision_(false),
+    iw_(-1),
+    iter_exact_(0),
+    rr_exact_(0.0)
     
   {};
 
@@ -71,7 +76,11 @@ public: // interface
       bc_(0.0),
       local_(false),
       ir_matvec_(-1),
-      ir_loop_2_(-1)
+      ir_loop_2_(-1),
+      mixed_precision_(false),
+      iw_(-1),
+      iter_exact_(0),
+      rr_exact_(0.0)
       
   {}
 
@@ -124,6 +133,11 @@ public: // virtual functions
   /// Set rr_ by EnzoBlock after reduction
   void set_rr(double rr) throw()    {  rr_ = rr; }
 
+  /// Set rr_ by EnzoBlock after reduction of a residual computed
+  /// directly as B - A*X rather than updated by recurrence
+  void set_rr_exact(double rr) throw()
+  { rr_ = rr; iter_exact_ = iter_; }
+
   /// Set rr_new_ by EnzoBlock after reduction
   void set_rz2(double rz2) throw()  {  rz2_ = rz2; }
 
@@ -147,6 +161,30 @@ protected: // methods
 
   void compute_ (EnzoBlock * enzo_block) throw();
 
+  /// Recompute the residual in full precision and restart the
+  /// iteration (mixed_precision_ only)
+  void refine_ (EnzoBlock * enzo_block) throw();
+
+  /// Templated on the precision T of the CG vectors R, D, Y, Z
+
+  template <class T>
+  void compute_ (EnzoBlock * enzo_block) throw();
+  template <class T>
+  void shift_1_ (EnzoBlock * enzo_block) throw();
+  template <class T>
+  void loop_2b_ (EnzoBlock * enzo_block) throw();
+  template <class T>
+  void loop_4_ (EnzoBlock * enzo_block) throw();
+  template <class T>
+  void loop_6_ (EnzoBlock * enzo_block) throw();
+  template <class T>
+  void refine_ (EnzoBlock * enzo_block) throw();
+
+  /// Set R = B - A*X, with A*X computed in the precision of X, and
+  /// D = Z = R
+  template <class T>
+  void residual_ (EnzoBlock * enzo_block) throw();
+
   void begin_1_() throw();
 
   /// Allocate temporary Fields
@@ -168,12 +206,15 @@ protected: // methods
   }
 
   /// Serial CG solver if local_ == true
+  template <class T>
   void local_cg_ (EnzoBlock * enzo_block);
 
   /// Apply boundary conditions for the Field on the local block
+  template <class T>
   void refresh_local_(int ix, EnzoBlock * enzo_block);
 
   /// Shift Field so that sum(x) == 0
+  template <class T>
   void shift_local_(int ix, EnzoBlock * enzo_block);
   
   void monitor_output_(EnzoBlock *);
@@ -245,6 +286,19 @@ protected: // attributes
   int ir_matvec_;
   int ir_loop_2_;
 
+  /// Whether CG vectors are single precision, with the residual
+  /// periodically recomputed from X in full precision
+  bool mixed_precision_;
+
+  /// Full-precision temporary for A*X when recomputing the residual
+  int iw_;
+
+  /// Iteration at which the residual was last computed directly
+  int iter_exact_;
+
+  /// dot (R,R) when the residual was last computed directly
+  double rr_exact_;
+
 };
 
 #endif /* ENZO_ENZO_SOLVER_CG_HPP */
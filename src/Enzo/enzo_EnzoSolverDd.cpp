@@ -417,15 +417,7 @@ FieldMsg * EnzoSolverDd::pack_field_(EnzoBlock * enzo_block,
 				     int refresh_type,
 				     int * ic3)
 {
-  int  if3[3] = {0,0,0};
-  bool lg3[3];
-  for (int i=0; i<3; i++) lg3[i] = (refresh_type == refresh_fine);
-
-  Refresh * refresh = new Refresh;
-  refresh->add_field(index_field);
-
-  FieldFace * field_face = enzo_block->create_face
-    (if3, ic3, lg3, refresh_type, refresh, true);
+  FieldFace * field_face = field_face_child_(index_field,refresh_type,ic3);
 
   if (refresh_type == refresh_coarse)
     field_face->set_restrict(restrict_);
@@ -433,17 +425,13 @@ FieldMsg * EnzoSolverDd::pack_field_(EnzoBlock * enzo_block,
     field_face->set_prolong(prolong_);
   
   Field field = enzo_block->data()->field();
-  int narray; 
-  char * array;
-  field_face->face_to_array(field,&narray,&array);
 
-  delete field_face;
+  const int narray = field_face->num_bytes_array(field);
 
   FieldMsg * msg  = new (narray) FieldMsg;
  
   msg->n = narray;
-  memcpy (msg->a, array, narray);
-  delete [] array;
+  field_face->face_to_array(field,msg->a);
   
   msg->ic3[0] = ic3[0];
   msg->ic3[1] = ic3[1];
@@ -461,16 +449,7 @@ void EnzoSolverDd::unpack_field_
  int index_field,
  int refresh_type)
 {
-  int if3[3] = {0,0,0};
-  bool lg3[3];
-  for (int i=0; i<3; i++) lg3[i] = (refresh_type == refresh_fine);
-  Refresh * refresh = new Refresh;
-  refresh->add_field(index_field);
-
-  int * ic3 = msg->ic3;
-
-  FieldFace * field_face = enzo_block->create_face 
-    (if3, ic3, lg3, refresh_type, refresh, true);
+  FieldFace * field_face = field_face_child_(index_field,refresh_type,msg->ic3);
 
   if (refresh_type == refresh_coarse)
     field_face->set_restrict(restrict_);
@@ -479,10 +458,7 @@ void EnzoSolverDd::unpack_field_
 
   Field field = enzo_block->data()->field();
   
-  char * a = msg->a;
-  field_face->array_to_face(a, field);
-  delete field_face;
+  field_face->array_to_face(msg->a, field);
 
   delete msg;
 }
-
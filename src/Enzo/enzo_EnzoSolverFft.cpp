@@ -0,0 +1,396 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoSolverFft.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-19
+/// @brief    Implements the EnzoSolverFft class
+///
+/// 0. Blocks in the solve level send interior B values to ip_gather_
+/// 1. ip_gather_ forward transforms B
+/// 2. X = B / lambda(k), where lambda(k) are the eigenvalues of the
+///    periodic discrete Laplacian, with X(0) = 0
+/// 3. ip_gather_ inverse transforms X
+/// 4. ip_gather_ sends X, including periodic ghost zones, to Blocks
+///
+/// Blocks not in the solve level exit the solver immediately; callers
+/// synchronize all Blocks after the coarse solve.
+
+#include "cello.hpp"
+#include "enzo.hpp"
+
+//======================================================================
+
+EnzoSolverFft::EnzoSolverFft
+(std::string name,
+ std::string field_x,
+ std::string field_b,
+ int monitor_iter,
+ int restart_cycle,
+ int solve_type,
+ int min_level,
+ int max_level,
+ int max_size) throw()
+  : Solver(name,
+	   field_x,
+	   field_b,
+	   monitor_iter,
+	   restart_cycle,
+	   solve_type,
+	   min_level,
+	   max_level),
+    ip_gather_(0),
+    max_size_(max_size),
+    count_(0),
+    order_(0),
+    index_list_(),
+    ib3_list_(),
+    grid_()
+{
+  for (int i=0; i<3; i++) {
+    n3_[i] = 1;
+    nb3_[i] = 1;
+    g3_[i] = 0;
+    h3_[i] = 0.0;
+  }
+
+  ASSERT2("EnzoSolverFft::EnzoSolverFft()",
+	  "Solver %s type %s must be solve_level",
+	  name.c_str(), solve_string[solve_type],
+	  solve_type == solve_level);
+
+  Refresh * refresh = cello::refresh(ir_post_);
+  cello::simulation()->new_refresh_set_name(ir_post_,name);
+
+  refresh->add_field (ix_);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverFft::apply ( std::shared_ptr<Matrix> A, Block * block) throw()
+{
+  Solver::begin_(block);
+
+  if (! is_finest_(block)) {
+    Solver::end_(block);
+    return;
+  }
+
+  EnzoMatrixLaplace * matrix = dynamic_cast<EnzoMatrixLaplace *> (A.get());
+
+  ASSERT1("EnzoSolverFft::apply()",
+	  "Solver %s requires the Laplace matrix",
+	  name_.c_str(),
+	  matrix != NULL);
+
+  ASSERT2("EnzoSolverFft::apply()",
+	  "Solver %s level %d must not be finer than the root level",
+	  name_.c_str(), block->level(),
+	  block->level() <= 0);
+
+  const int rank = cello::rank();
+
+  bool periodic[3];
+  block->periodicity(periodic);
+  for (int axis=0; axis<rank; axis++) {
+    ASSERT2("EnzoSolverFft::apply()",
+	    "Solver %s requires periodic boundaries along axis %d",
+	    name_.c_str(), axis,
+	    periodic[axis]);
+  }
+
+  Field field = block->data()->field();
+
+  int m3[3],g3[3],n3[3];
+  field.dimensions (ib_,&m3[0],&m3[1],&m3[2]);
+  field.ghost_depth(ib_,&g3[0],&g3[1],&g3[2]);
+  for (int i=0; i<3; i++) {
+    if (i >= rank) g3[i] = 0;
+    n3[i] = m3[i] - 2*g3[i];
+  }
+
+  int ib3[3],nb3[3];
+  block->index_global (&ib3[0],&ib3[1],&ib3[2],&nb3[0],&nb3[1],&nb3[2]);
+
+  // The whole level is transformed on one process, so its size is
+  // limited by that process's memory and compute time
+
+  const long long size =
+    (long long)(n3[0]*nb3[0])*(n3[1]*nb3[1])*(n3[2]*nb3[2]);
+  if (size > max_size_) {
+    ERROR3("EnzoSolverFft::apply()",
+	   "Solver %s level has %lld cells, more than max_size = %d",
+	   name_.c_str(), size, max_size_);
+  }
+
+  double h3[3];
+  block->cell_width (&h3[0],&h3[1],&h3[2]);
+
+  // Pack interior B values
+
+  const enzo_float * B = (const enzo_float *) field.values(ib_);
+  const int n = n3[0]*n3[1]*n3[2];
+  std::vector<enzo_float> values (n);
+
+  for (int iz=0; iz<n3[2]; iz++) {
+    for (int iy=0; iy<n3[1]; iy++) {
+      for (int ix=0; ix<n3[0]; ix++) {
+	const int i_m = (ix+g3[0]) + m3[0]*((iy+g3[1]) + m3[1]*(iz+g3[2]));
+	const int i_n = ix + n3[0]*(iy + n3[1]*iz);
+	values[i_n] = B[i_m];
+      }
+    }
+  }
+
+  proxy_enzo_simulation[ip_gather_].p_solver_fft_gather
+    (index_, block->index(), matrix->order(), h3, ib3, nb3, n3, g3,
+     n, &values[0]);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSimulation::p_solver_fft_gather
+(int index_solver, Index index, int order, double h3[3],
+ int ib3[3], int nb3[3], int n3[3], int g3[3],
+ int n, enzo_float values[])
+{
+  EnzoSolverFft * solver =
+    static_cast<EnzoSolverFft*> (cello::solver(index_solver));
+
+  solver->gather_recv (index,order,h3,ib3,nb3,n3,g3,n,values);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverFft::gather_recv
+(Index index, int order, const double h3[3],
+ const int ib3[3], const int nb3[3], const int n3[3], const int g3[3],
+ int n, const enzo_float * values) throw()
+{
+  if (count_ == 0) {
+
+    order_ = order;
+    for (int i=0; i<3; i++) {
+      n3_[i]  = n3[i];
+      nb3_[i] = nb3[i];
+      g3_[i]  = g3[i];
+      h3_[i]  = h3[i];
+    }
+    const int nx = n3_[0]*nb3_[0];
+    const int ny = n3_[1]*nb3_[1];
+    const int nz = n3_[2]*nb3_[2];
+
+    grid_.resize(nx*ny*nz);
+    index_list_.clear();
+    ib3_list_.clear();
+  }
+
+  ASSERT3("EnzoSolverFft::gather_recv()",
+	  "Solver %s received %d values but expected %d",
+	  name_.c_str(), n, n3_[0]*n3_[1]*n3_[2],
+	  n == n3_[0]*n3_[1]*n3_[2]);
+
+  // Copy Block values into the gathered grid
+
+  const int nx = n3_[0]*nb3_[0];
+  const int ny = n3_[1]*nb3_[1];
+  const int ox = ib3[0]*n3_[0];
+  const int oy = ib3[1]*n3_[1];
+  const int oz = ib3[2]*n3_[2];
+
+  for (int iz=0; iz<n3_[2]; iz++) {
+    for (int iy=0; iy<n3_[1]; iy++) {
+      for (int ix=0; ix<n3_[0]; ix++) {
+	const int i_g = (ox+ix) + nx*((oy+iy) + ny*(oz+iz));
+	const int i_n = ix + n3_[0]*(iy + n3_[1]*iz);
+	grid_[i_g] = std::complex<double> (values[i_n],0.0);
+      }
+    }
+  }
+
+  index_list_.push_back(index);
+  for (int i=0; i<3; i++) ib3_list_.push_back(ib3[i]);
+
+  if (++count_ == nb3_[0]*nb3_[1]*nb3_[2]) {
+    count_ = 0;
+    solve_();
+    scatter_();
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverFft::solve_() throw()
+{
+  const int nx = n3_[0]*nb3_[0];
+  const int ny = n3_[1]*nb3_[1];
+  const int nz = n3_[2]*nb3_[2];
+
+  fft_3d_(-1);
+
+  // Divide by eigenvalues of the discrete operator; the singular
+  // constant mode is set to zero
+
+  EnzoMatrixLaplace matrix (order_);
+
+  const double scale = 1.0 / (double(nx)*ny*nz);
+  const double two_pi = 2.0*cello::pi;
+
+  for (int kz=0; kz<nz; kz++) {
+    for (int ky=0; ky<ny; ky++) {
+      for (int kx=0; kx<nx; kx++) {
+	const int i = kx + nx*(ky + ny*kz);
+	if (kx == 0 && ky == 0 && kz == 0) {
+	  grid_[i] = 0.0;
+	} else {
+	  const double theta3[3] =
+	    { two_pi*kx/nx, two_pi*ky/ny, two_pi*kz/nz };
+	  const double lambda = matrix.eigenvalue(theta3,h3_);
+	  grid_[i] *= scale / lambda;
+	}
+      }
+    }
+  }
+
+  fft_3d_(+1);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverFft::scatter_() throw()
+{
+  const int nx = n3_[0]*nb3_[0];
+  const int ny = n3_[1]*nb3_[1];
+  const int nz = n3_[2]*nb3_[2];
+
+  const int m3[3] = { n3_[0] + 2*g3_[0],
+		      n3_[1] + 2*g3_[1],
+		      n3_[2] + 2*g3_[2] };
+  const int m = m3[0]*m3[1]*m3[2];
+
+  std::vector<enzo_float> values (m);
+
+  for (size_t ib=0; ib<index_list_.size(); ib++) {
+
+    const int * ib3 = &ib3_list_[3*ib];
+
+    // Copy Block values including ghost zones, wrapping periodically
+
+    for (int iz=0; iz<m3[2]; iz++) {
+      const int jz = (ib3[2]*n3_[2] + iz - g3_[2] + nz) % nz;
+      for (int iy=0; iy<m3[1]; iy++) {
+	const int jy = (ib3[1]*n3_[1] + iy - g3_[1] + ny) % ny;
+	for (int ix=0; ix<m3[0]; ix++) {
+	  const int jx = (ib3[0]*n3_[0] + ix - g3_[0] + nx) % nx;
+	  const int i_m = ix + m3[0]*(iy + m3[1]*iz);
+	  values[i_m] = grid_[jx + nx*(jy + ny*jz)].real();
+	}
+      }
+    }
+
+    enzo::block_array()[index_list_[ib]].p_solver_fft_scatter
+      (m, &values[0]);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_solver_fft_scatter(int n, enzo_float values[])
+{
+  static_cast<EnzoSolverFft*> (solver())->scatter_recv(this,n,values);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverFft::scatter_recv
+(EnzoBlock * enzo_block, int n, const enzo_float * values) throw()
+{
+  Field field = enzo_block->data()->field();
+
+  int mx,my,mz;
+  field.dimensions (ix_,&mx,&my,&mz);
+
+  ASSERT3("EnzoSolverFft::scatter_recv()",
+	  "Solver %s received %d values but expected %d",
+	  name_.c_str(), n, mx*my*mz,
+	  n == mx*my*mz);
+
+  std::copy_n (values, n, (enzo_float *) field.values(ix_));
+
+  Solver::end_(enzo_block);
+}
+
+//======================================================================
+
+void EnzoSolverFft::fft_3d_(int sign) throw()
+{
+  const int n3[3] = { n3_[0]*nb3_[0], n3_[1]*nb3_[1], n3_[2]*nb3_[2] };
+  const int d3[3] = { 1, n3[0], n3[0]*n3[1] };
+
+  const int n_max = std::max(n3[0],std::max(n3[1],n3[2]));
+  std::vector< std::complex<double> > line (n_max), work (n_max);
+
+  // Transform each line along each axis in turn
+
+  for (int axis=0; axis<3; axis++) {
+
+    const int n = n3[axis];
+    if (n == 1) continue;
+
+    const int a1 = (axis+1) % 3;
+    const int a2 = (axis+2) % 3;
+
+    for (int i2=0; i2<n3[a2]; i2++) {
+      for (int i1=0; i1<n3[a1]; i1++) {
+	const int i0 = i1*d3[a1] + i2*d3[a2];
+	for (int i=0; i<n; i++) line[i] = grid_[i0 + i*d3[axis]];
+	fft_1d (&line[0],n,sign,&work[0]);
+	for (int i=0; i<n; i++) grid_[i0 + i*d3[axis]] = line[i];
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverFft::fft_1d
+(std::complex<double> * x, int n, int sign,
+ std::complex<double> * work) throw()
+{
+  if (n == 1) return;
+
+  // Mixed-radix decimation in time: split into p subsequences using
+  // the smallest prime factor p of n
+
+  int p = 2;
+  while (n % p != 0 && p*p <= n) ++p;
+  if (n % p != 0) p = n;
+  const int m = n / p;
+
+  for (int r=0; r<p; r++) {
+    for (int k=0; k<m; k++) {
+      work[r*m + k] = x[k*p + r];
+    }
+  }
+
+  // Transform subsequences, using x as work space
+
+  for (int r=0; r<p; r++) {
+    fft_1d (work + r*m, m, sign, x + r*m);
+  }
+
+  // Combine: X[k + q*m] = sum_r w^(r*(k + q*m)) Y_r[k]
+
+  const double angle = sign*2.0*cello::pi / n;
+
+  for (int q=0; q<p; q++) {
+    for (int k=0; k<m; k++) {
+      const int j = k + q*m;
+      std::complex<double> sum = 0.0;
+      for (int r=0; r<p; r++) {
+	const double t = angle * ((r*j) % n);
+	sum += std::complex<double>(cos(t),sin(t)) * work[r*m + k];
+      }
+      x[j] = sum;
+    }
+  }
+}
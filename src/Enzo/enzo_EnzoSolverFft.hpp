@@ -0,0 +1,152 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoSolverFft.hpp
+/// @author   agent (agent@local)
+/// @date     2026-10-19
+/// @brief    [\ref Enzo] Declaration of the EnzoSolverFft class
+///
+/// Direct FFT solver for the periodic Poisson problem on a single
+/// complete mesh level, intended as the coarse solver for
+/// EnzoSolverMg0 and EnzoSolverDd
+
+#ifndef ENZO_ENZO_SOLVER_FFT_HPP
+#define ENZO_ENZO_SOLVER_FFT_HPP
+
+#include <complex>
+
+class EnzoSolverFft : public Solver {
+
+  /// @class    EnzoSolverFft
+  /// @ingroup  Enzo
+  ///
+  /// @brief [\ref Enzo] Gathers the right-hand side of all Blocks in
+  /// the solve level onto one process, solves A X = B directly by
+  /// diagonalizing the EnzoMatrixLaplace operator with a discrete
+  /// Fourier transform, and scatters the solution, including ghost
+  /// zones, back to the Blocks.  Requires periodic boundary
+  /// conditions and a solve level no finer than the root level.
+  /// Since the transform is not distributed, the solve level may
+  /// have at most max_size cells.
+
+public: // interface
+
+  /// Create a new EnzoSolverFft object
+  EnzoSolverFft
+  (std::string name,
+   std::string field_x,
+   std::string field_b,
+   int monitor_iter,
+   int restart_cycle,
+   int solve_type,
+   int min_level,
+   int max_level,
+   int max_size) throw();
+
+  EnzoSolverFft() {};
+
+  /// Charm++ PUP::able declarations
+  PUPable_decl(EnzoSolverFft);
+
+  /// Charm++ PUP::able migration constructor
+  EnzoSolverFft (CkMigrateMessage *m)
+    : Solver(m),
+      ip_gather_(0),
+      max_size_(0),
+      count_(0),
+      order_(0),
+      index_list_(),
+      ib3_list_(),
+      grid_()
+  {
+    for (int i=0; i<3; i++) {
+      n3_[i] = 1;
+      nb3_[i] = 1;
+      g3_[i] = 0;
+      h3_[i] = 0.0;
+    }
+  }
+
+  /// CHARM++ Pack / Unpack function
+  void pup (PUP::er &p)
+  {
+    // NOTE: change this function whenever attributes change
+
+    TRACEPUP;
+
+    Solver::pup(p);
+
+    p | ip_gather_;
+    p | max_size_;
+
+    // NOTE: gathered solve data are not packed since no solve is in
+    // progress during load balancing or checkpointing
+  }
+
+public: // virtual methods
+
+  /// Solve the linear system
+  virtual void apply ( std::shared_ptr<Matrix> A, Block * block) throw();
+
+  /// Type of this solver
+  virtual std::string type() const { return "fft"; }
+
+public: // methods
+
+  /// Receive the right-hand side of a Block on the gather process
+  void gather_recv
+  (Index index, int order, const double h3[3],
+   const int ib3[3], const int nb3[3], const int n3[3], const int g3[3],
+   int n, const enzo_float * values) throw();
+
+  /// Receive the solution on a Block and exit the solver
+  void scatter_recv (EnzoBlock * enzo_block,
+		     int n, const enzo_float * values) throw();
+
+  /// In-place complex discrete Fourier transform of length n, with
+  /// sign -1 for forward and +1 for inverse (unscaled).  The work
+  /// array must have length n
+  static void fft_1d (std::complex<double> * x, int n, int sign,
+		      std::complex<double> * work) throw();
+
+protected: // methods
+
+  /// Solve the gathered system in Fourier space
+  void solve_() throw();
+
+  /// Send the solution to all Blocks in the solve level
+  void scatter_() throw();
+
+  /// Transform the gathered grid along all axes
+  void fft_3d_(int sign) throw();
+
+protected: // attributes
+
+  /// Process onto which the right-hand side is gathered
+  int ip_gather_;
+
+  /// Maximum number of cells in the solve level
+  int max_size_;
+
+  /// Number of Blocks received on the gather process
+  int count_;
+
+  /// Order of the EnzoMatrixLaplace operator
+  int order_;
+
+  /// Block cells, Blocks, and ghost depth along each axis
+  int n3_[3];
+  int nb3_[3];
+  int g3_[3];
+
+  /// Cell widths in the solve level
+  double h3_[3];
+
+  /// Index and level position of each gathered Block
+  std::vector<Index> index_list_;
+  std::vector<int> ib3_list_;
+
+  /// Gathered grid of size (nb3_[i]*n3_[i])
+  std::vector< std::complex<double> > grid_;
+};
+
+#endif /* ENZO_ENZO_SOLVER_FFT_HPP */
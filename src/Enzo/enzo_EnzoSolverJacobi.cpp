@@ -147,6 +147,7 @@ void EnzoBlock::p_solver_jacobi_continue()
 {
  
   performance_start_(perf_compute,__FILE__,__LINE__);
+  const int index_region = performance_solver_start_();
 
   EnzoSolverJacobi * solver = nullptr;  
   TRACE_JACOBI(this,solver,"p_solver_jacobi_continue()");
@@ -156,6 +157,7 @@ void EnzoBlock::p_solver_jacobi_continue()
 
   solver->compute(this);
 
+  performance_solver_stop_(index_region);
   performance_stop_(perf_compute,__FILE__,__LINE__);
 }
 
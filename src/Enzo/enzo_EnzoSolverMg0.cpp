@@ -324,9 +324,11 @@ void EnzoSolverMg0::compute_shift_
 void EnzoBlock::r_solver_mg0_begin_solve(CkReductionMsg* msg)
 {
   performance_start_(perf_compute,__FILE__,__LINE__);
+  const int index_region = performance_solver_start_();
 
   static_cast<EnzoSolverMg0*> (solver())->begin_solve(this,msg);
 
+  performance_solver_stop_(index_region);
   performance_stop_(perf_compute,__FILE__,__LINE__);
 }
 
@@ -454,6 +456,7 @@ void EnzoBlock::p_solver_mg0_solve_coarse()
 {
   SOLVER_CONTROL(this,"*","*", "p_solve_coarse");
   performance_start_(perf_compute,__FILE__,__LINE__);
+  const int index_region = performance_solver_start_();
   
   EnzoSolverMg0 * solver = 
     static_cast<EnzoSolverMg0*> (this->solver());
@@ -464,7 +467,8 @@ void EnzoBlock::p_solver_mg0_solve_coarse()
   long double data[1] = {solver->rr_local()};
 
   contribute(sizeof(long double), data,  sum_long_double_type, callback);
-  performance_stop_(perf_compute,__FILE__,__LINE__);  
+  performance_solver_stop_(index_region);
+  performance_stop_(perf_compute,__FILE__,__LINE__);
 }
 
 //----------------------------------------------------------------------
@@ -475,6 +479,7 @@ void EnzoBlock::r_solver_mg0_barrier(CkReductionMsg* msg)
     static_cast<EnzoSolverMg0*> (this->solver());
 
   performance_start_(perf_compute,__FILE__,__LINE__);
+  const int index_region = performance_solver_start_();
 
   long double rr = ((long double*) msg->getData())[0];
   solver->set_rr(rr);
@@ -485,6 +490,7 @@ void EnzoBlock::r_solver_mg0_barrier(CkReductionMsg* msg)
 
   solver->prolong(this);
 
+  performance_solver_stop_(index_region);
   performance_stop_(perf_compute,__FILE__,__LINE__);
 }
 
@@ -495,12 +501,14 @@ void EnzoBlock::p_solver_mg0_restrict()
   SOLVER_CONTROL(this,"*","*", "p_restrict");
 
   performance_start_(perf_compute,__FILE__,__LINE__);
+  const int index_region = performance_solver_start_();
   
   EnzoSolverMg0 * solver = 
     static_cast<EnzoSolverMg0*> (this->solver());
 
   solver->restrict(this);
 
+  performance_solver_stop_(index_region);
   performance_stop_(perf_compute,__FILE__,__LINE__);
 }
 
@@ -641,12 +649,14 @@ void EnzoBlock::p_solver_mg0_restrict_recv(FieldMsg * msg)
   SOLVER_CONTROL(this,"*","*", "p_restrict_recv");
 
   performance_start_(perf_compute,__FILE__,__LINE__);
+  const int index_region = performance_solver_start_();
 
   EnzoSolverMg0 * solver = 
     static_cast<EnzoSolverMg0*> (this->solver());
 
   solver->restrict_recv(this,msg);
 
+  performance_solver_stop_(index_region);
   performance_stop_(perf_compute,__FILE__,__LINE__);
 
 }
@@ -742,7 +752,9 @@ void EnzoBlock::p_solver_mg0_prolong_recv(FieldMsg * msg)
 {
   SOLVER_CONTROL(this,"*","*", "p_prolong_recv");
   performance_start_(perf_compute,__FILE__,__LINE__);
+  const int index_region = performance_solver_start_();
   solver_mg0_prolong_recv(msg);
+  performance_solver_stop_(index_region);
   performance_stop_(perf_compute,__FILE__,__LINE__);
   
 }
@@ -810,12 +822,14 @@ void EnzoBlock::p_solver_mg0_post_smooth()
   SOLVER_CONTROL(this,"*","*", "p_post_smooth");
 
   performance_start_(perf_compute,__FILE__,__LINE__);
+  const int index_region = performance_solver_start_();
   
   EnzoSolverMg0 * solver = 
     static_cast<EnzoSolverMg0*> (this->solver());
 
   solver->post_smooth(this);
   
+  performance_solver_stop_(index_region);
   performance_stop_(perf_compute,__FILE__,__LINE__);
 }
 
@@ -914,11 +928,13 @@ void EnzoBlock::p_solver_mg0_last_smooth()
 {
   SOLVER_CONTROL(this,"*","*", "p_last_smooth");
   performance_start_(perf_compute,__FILE__,__LINE__);
+  const int index_region = performance_solver_start_();
 
   EnzoSolverMg0 * solver = static_cast<EnzoSolverMg0*> (this->solver());
 
   solver->end(this);
   
+  performance_solver_stop_(index_region);
   performance_stop_(perf_compute,__FILE__,__LINE__);
 }
 
@@ -928,48 +944,26 @@ FieldMsg * EnzoSolverMg0::pack_residual_(EnzoBlock * enzo_block) throw()
 {
   Index index        = enzo_block->index();
   const  int level   = index.level();  
-  // copy face data to FieldFace
 
   // Pack and send "R" to parent
 
   int ic3[3];
   index.child(level,&ic3[0],&ic3[1],&ic3[2],min_level_);
   
-  // <COMMON CODE> in restrict_send_() and prolong_send_()
-  
-  int if3[3] = {0,0,0};
-  bool lg3[3] = {false,false,false};
-  Refresh * refresh = new Refresh;
-  refresh->add_field(ir_);
-
-  // copy data from EnzoBlock to array via FieldFace
-
-  FieldFace * field_face = enzo_block->create_face
-    (if3, ic3, lg3, refresh_coarse, refresh, true);
-
+  FieldFace * field_face = field_face_child_(ir_,refresh_coarse,ic3);
   field_face->set_restrict(restrict_);
-  
-  int narray; 
-  char * array;
 
   Field field = enzo_block->data()->field();
 
-  field_face->face_to_array(field,&narray,&array);
-
-  delete field_face;
-
-  // Create a FieldMsg for sending data to parent
+  // Restrict directly into a FieldMsg for sending data to parent
   // (note: charm messages not deleted on send; are deleted on receive)
 
+  const int narray = field_face->num_bytes_array(field);
+
   FieldMsg * msg  = new (narray) FieldMsg;
  
-  /// WARNING: double copy
-
-  // Copy FieldFace data to msg
-
   msg->n = narray;
-  memcpy (msg->a, array, narray);
-  delete [] array;
+  field_face->face_to_array(field,msg->a);
   msg->ic3[0] = ic3[0];
   msg->ic3[1] = ic3[1];
   msg->ic3[2] = ic3[2];
@@ -983,25 +977,14 @@ FieldMsg * EnzoSolverMg0::pack_residual_(EnzoBlock * enzo_block) throw()
 void EnzoSolverMg0::unpack_residual_
 (EnzoBlock * enzo_block,FieldMsg * msg) throw()
 {
-  int if3[3] = {0,0,0};
-  bool lg3[3] = {false,false,false};
-  Refresh * refresh = new Refresh;
-  refresh->add_field(ib_);
-
   // copy data from msg to this EnzoBlock
 
-  int * ic3 = msg->ic3;
-
-  FieldFace * field_face = enzo_block->create_face 
-    (if3, ic3, lg3, refresh_coarse, refresh, true);
-
+  FieldFace * field_face = field_face_child_(ib_,refresh_coarse,msg->ic3);
   field_face->set_restrict(restrict_);
 
   Field field = enzo_block->data()->field();
   
-  char * a = msg->a;
-  field_face->array_to_face(a, field);
-  delete field_face;
+  field_face->array_to_face(msg->a, field);
 
   delete msg;
 }
@@ -1013,46 +996,24 @@ FieldMsg * EnzoSolverMg0::pack_correction_
 {
   // Pack and send "X" to children
 
-  // <COMMON CODE> in restrict_send_() and prolong_send_()
-
-  int if3[3] = {0,0,0};
-  bool lg3[3] = {true,true,true};
-  Refresh * refresh = new Refresh;
-  refresh->add_field(ix_);
-    
-  // copy data from EnzoBlock to array via FieldFace
-
-  FieldFace * field_face = enzo_block->create_face
-    (if3, ic3, lg3, refresh_fine, refresh, true);
-
-  Field field = enzo_block->data()->field();
+  FieldFace * field_face = field_face_child_(ix_,refresh_fine,ic3);
   field_face->set_prolong(prolong_);
 
-  int narray; 
-  char * array;
-    
-  field_face->face_to_array (field,&narray,&array);
-
-  delete field_face;
+  Field field = enzo_block->data()->field();
 
-  // Create a FieldMsg for sending data to parent
+  // Copy directly into a FieldMsg for sending data to child
   // (note: charm messages not deleted on send; are deleted on receive)
     
-  FieldMsg * msg  = new (narray) FieldMsg;
+  const int narray = field_face->num_bytes_array(field);
 
-  /// WARNING: double copy
-
-  // Copy FieldFace data to msg
+  FieldMsg * msg  = new (narray) FieldMsg;
 
   msg->n = narray;
-  memcpy (msg->a, array, narray);
-  delete [] array;
+  field_face->face_to_array (field,msg->a);
   msg->ic3[0] = ic3[0];
   msg->ic3[1] = ic3[1];
   msg->ic3[2] = ic3[2];
 
-  //  </COMMON CODE>
-
   return msg;
 }
 
@@ -1061,23 +1022,15 @@ FieldMsg * EnzoSolverMg0::pack_correction_
 void EnzoSolverMg0::unpack_correction_
 (EnzoBlock * enzo_block, FieldMsg * msg) throw()
 {
-  int if3[3] = {0,0,0};
-  bool lg3[3] = {true,true,true};
-  Refresh * refresh = new Refresh;
-  refresh->add_field(ic_);
-
   // copy data from msg to this EnzoBlock
 
-  FieldFace * field_face = enzo_block->create_face 
-    (if3, msg->ic3, lg3, refresh_fine, refresh, true);
-
+  FieldFace * field_face = field_face_child_(ic_,refresh_fine,msg->ic3);
   field_face->set_prolong(prolong_);
 
   Field field = enzo_block->data()->field();
   
   field_face->array_to_face (msg->a, field);
 
-  delete field_face;
   delete msg;
 
 }
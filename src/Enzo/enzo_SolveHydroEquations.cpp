@@ -7,17 +7,32 @@
 
 #include "cello.hpp"
 #include "enzo.hpp"
+#include "CkLoopAPI.h"
 #include <stdio.h>
+#include <functional>
 
 // #define IE_ERROR_FIELD
 // #define DEBUG_PPM
 //----------------------------------------------------------------------
 
+/// CkLoop helper function: call the sweep function for chunks
+/// first through last
+
+static void ppm_sweep_chunks_
+(int first, int last, void * result, int num_params, void * params)
+{
+  auto & sweep_chunk = *(std::function<void (int)> *) params;
+  for (int chunk=first; chunk<=last; chunk++) sweep_chunk(chunk);
+}
+
+//----------------------------------------------------------------------
+
 int EnzoBlock::SolveHydroEquations 
 (
  enzo_float time,
  enzo_float dt,
- bool comoving_coordinates
+ bool comoving_coordinates,
+ int num_threads
  )
 {
   /* initialize */
@@ -30,11 +45,16 @@ int EnzoBlock::SolveHydroEquations
   field.ghost_depth(0,&gx,&gy,&gz);
   field.dimensions(0,&mx,&my,&mz);
 
+  // Work arrays are reused between calls to avoid allocating and
+  // deallocating them for every Block
+
+  Scratch * scratch = Scratch::instance();
+
 #ifdef IE_ERROR_FIELD  
   int num_ie_error = 0;
-  int *ie_error_x = new int [mx*my*mz];
-  int *ie_error_y = new int [mx*my*mz];
-  int *ie_error_z = new int [mx*my*mz];
+  int *ie_error_x = scratch->array<int>(enzo_scratch_ppm_ie_error,3*mx*my*mz);
+  int *ie_error_y = ie_error_x + mx*my*mz;
+  int *ie_error_z = ie_error_y + mx*my*mz;
 #else
   int num_ie_error = -1;
   int *ie_error_x = nullptr;
@@ -55,13 +75,18 @@ int EnzoBlock::SolveHydroEquations
   enzo_float * colorpt = (enzo_float *) field.permanent();
 
   // coloff: offsets into the color array (for each color field)
-  int * coloff   = (ncolor > 0) ? (new int [ncolor]) : NULL;
+  int * coloff   = (ncolor > 0) ?
+    scratch->array<int>(enzo_scratch_ppm_color_offset,ncolor) : NULL;
   int index_color = 0;
   for (int index_field = 0;
        index_field < field.field_count();
        index_field++) {
     std::string name = field.field_name(index_field);
     if (field.groups()->is_in(name,"color")) {
+      ASSERT1 ("EnzoBlock::SolveHydroEquations()",
+	       "Color field %s must not use swap history",
+	       name.c_str(),
+	       field.history_mode(index_field) != history_swap);
       coloff[index_color++] 
 	= (enzo_float *)(field.values(index_field)) - colorpt;
     }
@@ -95,15 +120,15 @@ int EnzoBlock::SolveHydroEquations
   if (rank >= 2) {
     velocity_y = (enzo_float *) field.values("velocity_y");
   } else {
-    velocity_y = new enzo_float[size];
-    for (int i=0; i<size; i++) velocity_y[i] = 0.0;
+    velocity_y = scratch->array<enzo_float>
+      (enzo_scratch_ppm_velocity_y,size,true);
   }
 
     if (rank >= 3) {
     velocity_z = (enzo_float *) field.values("velocity_z");
   } else {
-    velocity_z = new enzo_float[size];
-    for (int i=0; i<size; i++) velocity_z[i] = 0.0;
+    velocity_z = scratch->array<enzo_float>
+      (enzo_scratch_ppm_velocity_z,size,true);
   }
 
   enzo_float * acceleration_x  = field.is_field("acceleration_x") ? 
@@ -148,14 +173,14 @@ int EnzoBlock::SolveHydroEquations
 			 GridDimension[1]*GridDimension[2]),
 		     GridDimension[2]*GridDimension[0]);
 
-  enzo_float *temp = new enzo_float[tempsize*(32+ncolor*4)];
+  enzo_float *temp = scratch->array<enzo_float>
+    (enzo_scratch_ppm_temp,tempsize*(32+ncolor*4));
 
   /* create and fill in arrays which are easier for the solver to
      understand. */
 
   size = NumberOfSubgrids*3*(18+2*ncolor) + 1;
-  int * array = new int[size];
-  for (int i=0; i<size; i++) array[i] = 0;
+  int * array = scratch->array<int>(enzo_scratch_ppm_index,size,true);
 
   int * p = array;
   int *leftface  = p; p+=3;
@@ -241,8 +266,12 @@ int EnzoBlock::SolveHydroEquations
   /* Create a cell width array to pass (and convert to absolute coords). */
 
   enzo_float * CellWidthTemp[MAX_DIMENSION];
+  enzo_float * cell_width = scratch->array<enzo_float>
+    (enzo_scratch_ppm_cell_width,
+     GridDimension[0]+GridDimension[1]+GridDimension[2]);
   for (dim = 0; dim < MAX_DIMENSION; dim++) {
-    CellWidthTemp[dim] = new enzo_float [GridDimension[dim]];
+    CellWidthTemp[dim] = cell_width;
+    cell_width += GridDimension[dim];
     if (dim < rank) {
       for (int i=0; i<GridDimension[dim]; i++) 
 	CellWidthTemp[dim][i] = (cosmo_a*CellWidth[dim]);
@@ -265,31 +294,107 @@ int EnzoBlock::SolveHydroEquations
 
   int error = 0;
 
-  FORTRAN_NAME(ppm_de)
-    (
-     density, total_energy, velocity_x, velocity_y, velocity_z,
-     internal_energy,
-     &gravity_on, 
-     acceleration_x,
-     acceleration_y,
-     acceleration_z,
-     &Gamma[in], &dt, &cycle_,
-     CellWidthTemp[0], CellWidthTemp[1], CellWidthTemp[2],
-     &rank, &GridDimension[0], &GridDimension[1],
-     &GridDimension[2], GridStartIndex, GridEndIndex,
-     &PPMFlatteningParameter[in],
-     &PressureFree[in],
-     &iconsrec, &iposrec,
-     &PPMDiffusionParameter[in], &PPMSteepeningParameter[in],
-     &DualEnergyFormalism[in], &DualEnergyFormalismEta1[in],
-     &DualEnergyFormalismEta2[in],
-     &NumberOfSubgrids, leftface, rightface,
-     istart, iend, jstart, jend,
-     standard, dindex, Eindex, uindex, vindex, windex,
-     geindex, temp,
-     &ncolor, colorpt, coloff, colindex,
-     &error, ie_error_x,ie_error_y,ie_error_z,&num_ie_error
-     );
+#ifdef IE_ERROR_FIELD
+  // ie_error_[xyz] are shared between slices
+  num_threads = 1;
+#endif
+
+  if (num_threads <= 1) {
+
+    FORTRAN_NAME(ppm_de)
+      (
+       density, total_energy, velocity_x, velocity_y, velocity_z,
+       internal_energy,
+       &gravity_on, 
+       acceleration_x,
+       acceleration_y,
+       acceleration_z,
+       &Gamma[in], &dt, &cycle_,
+       CellWidthTemp[0], CellWidthTemp[1], CellWidthTemp[2],
+       &rank, &GridDimension[0], &GridDimension[1],
+       &GridDimension[2], GridStartIndex, GridEndIndex,
+       &PPMFlatteningParameter[in],
+       &PressureFree[in],
+       &iconsrec, &iposrec,
+       &PPMDiffusionParameter[in], &PPMSteepeningParameter[in],
+       &DualEnergyFormalism[in], &DualEnergyFormalismEta1[in],
+       &DualEnergyFormalismEta2[in],
+       &NumberOfSubgrids, leftface, rightface,
+       istart, iend, jstart, jend,
+       standard, dindex, Eindex, uindex, vindex, windex,
+       geindex, temp,
+       &ncolor, colorpt, coloff, colindex,
+       &error, ie_error_x,ie_error_y,ie_error_z,&num_ie_error
+       );
+
+  } else {
+
+    // Same operator splitting as ppm_de(), but with the slices of each
+    // sweep divided into num_threads chunks updated concurrently by
+    // PEs in this node.  Each chunk gets its own work array and error
+    // flag; the fields and face fluxes of different slices are disjoint
+
+    const int ntemp = tempsize*(32+ncolor*4);
+    enzo_float * temp_chunks = scratch->array<enzo_float>
+      (enzo_scratch_ppm_sweep,size_t(num_threads)*ntemp);
+    std::vector<int> error_chunks (num_threads,0);
+
+    // number of slices for x-, y-, and z-sweeps (over k, i, and j)
+    const int num_slices[3] =
+      { GridDimension[2], GridDimension[0], GridDimension[1] };
+
+    const int ixyz = cycle_ % rank;
+    for (int n=ixyz; n<ixyz+rank; n++) {
+
+      int axis = n % rank;
+      if (GridEndIndex[axis] - GridStartIndex[axis] + 1 <= 1) continue;
+
+      const int ns = num_slices[axis];
+      const int num_chunks = std::min(num_threads,ns);
+
+      std::function<void (int)> sweep_chunk = [&] (int chunk)
+      {
+        int l1 = 1 + (chunk*ns)/num_chunks;
+        int l2 = ((chunk+1)*ns)/num_chunks;
+        FORTRAN_NAME(ppm_de_sweep)
+          (
+           &axis, &l1, &l2,
+           density, total_energy, velocity_x, velocity_y, velocity_z,
+           internal_energy,
+           &gravity_on, 
+           acceleration_x,
+           acceleration_y,
+           acceleration_z,
+           &Gamma[in], &dt,
+           CellWidthTemp[0], CellWidthTemp[1], CellWidthTemp[2],
+           &GridDimension[0], &GridDimension[1],
+           &GridDimension[2], GridStartIndex, GridEndIndex,
+           &PPMFlatteningParameter[in],
+           &PressureFree[in],
+           &iconsrec, &iposrec,
+           &PPMDiffusionParameter[in], &PPMSteepeningParameter[in],
+           &DualEnergyFormalism[in], &DualEnergyFormalismEta1[in],
+           &DualEnergyFormalismEta2[in],
+           &NumberOfSubgrids, leftface, rightface,
+           istart, iend, jstart, jend,
+           standard, dindex, Eindex, uindex, vindex, windex,
+           geindex, temp_chunks + size_t(chunk)*ntemp,
+           &ncolor, colorpt, coloff, colindex,
+           &error_chunks[chunk], ie_error_x,ie_error_y,ie_error_z,
+           &num_ie_error
+           );
+      };
+
+      // one chunk per CkLoop task; returns when all chunks are done
+      CkLoop_Parallelize
+        (ppm_sweep_chunks_, 1, &sweep_chunk,
+         num_chunks, 0, num_chunks - 1);
+    }
+
+    for (int chunk=0; chunk<num_threads; chunk++) {
+      if (error_chunks[chunk] != 0) error = error_chunks[chunk];
+    }
+  }
 
   if (error != 0) {
     char buffer[256];
@@ -313,25 +418,8 @@ int EnzoBlock::SolveHydroEquations
   }
 #endif
   
-  for (dim = 0; dim < MAX_DIMENSION; dim++) {
-    delete [] CellWidthTemp[dim];
-  }
-
-  /* deallocate temporary space for solver */
-
-  delete [] temp;
-  if (rank < 2) delete [] velocity_y;
-  if (rank < 3) delete [] velocity_z;
+  // (temporary space for solver is kept in Scratch for the next call)
 
-  delete [] array;
-
-  delete [] coloff;
-#ifdef IE_ERROR_FIELD  
-  delete [] ie_error_x;
-  delete [] ie_error_y;
-  delete [] ie_error_z;
-#endif  
-  
   return ENZO_SUCCESS;
 
 }
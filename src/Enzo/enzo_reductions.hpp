@@ -2,4 +2,8 @@ extern CkReduction::reducerType r_method_turbulence_type;
 extern CkReductionMsg * r_method_turbulence(int n, CkReductionMsg ** msgs);
 extern void register_method_turbulence(void);
 
+extern CkReduction::reducerType r_method_profile_type;
+extern CkReductionMsg * r_method_profile(int n, CkReductionMsg ** msgs);
+extern void register_method_profile(void);
+
 
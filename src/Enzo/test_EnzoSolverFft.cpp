@@ -0,0 +1,168 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_EnzoSolverFft.cpp
+/// @author   agent (agent@local)
+/// @date     2026-10-19
+/// @brief    Test program for the EnzoSolverFft class
+
+#include "test.hpp"
+#include "main.hpp"
+#include "enzo.hpp"
+
+//----------------------------------------------------------------------
+
+/// Return the maximum difference between fft_1d() and a direct
+/// discrete Fourier transform of a length n sequence
+double fft_error (int n, int sign)
+{
+  std::vector< std::complex<double> > x(n), y(n), work(n);
+
+  for (int i=0; i<n; i++) {
+    x[i] = std::complex<double> (cos(0.3*i*i) + 0.1*i, sin(1.7*i) - 0.2);
+  }
+
+  for (int k=0; k<n; k++) {
+    y[k] = 0.0;
+    for (int j=0; j<n; j++) {
+      const double t = sign*2.0*cello::pi*((1.0*j*k)/n);
+      y[k] += x[j] * std::complex<double>(cos(t),sin(t));
+    }
+  }
+
+  EnzoSolverFft::fft_1d (x.data(),n,sign,work.data());
+
+  double error = 0.0;
+  for (int k=0; k<n; k++) error = std::max(error,std::abs(x[k]-y[k]));
+  return error;
+}
+
+//----------------------------------------------------------------------
+
+/// Solve the periodic Poisson problem phi'' = rho on [0,1) with n
+/// cells using fft_1d() and the eigenvalues of the given order
+/// operator, and return the maximum error relative to the analytic
+/// solution
+double poisson_error (int n, int order)
+{
+  const double h = 1.0 / n;
+  const double k1 = 2.0*cello::pi;
+  const double k3 = 6.0*cello::pi;
+
+  std::vector< std::complex<double> > x(n), work(n);
+
+  // rho = cos(k1 x) + sin(k3 x) at cell centers
+
+  for (int i=0; i<n; i++) {
+    const double xc = (i + 0.5)*h;
+    x[i] = cos(k1*xc) + sin(k3*xc);
+  }
+
+  EnzoSolverFft::fft_1d (x.data(),n,-1,work.data());
+
+  EnzoMatrixLaplace matrix (order);
+  const double h3[3] = { h, 1.0, 1.0 };
+  for (int k=0; k<n; k++) {
+    const double theta3[3] = { 2.0*cello::pi*k/n, 0.0, 0.0 };
+    const double lambda = matrix.eigenvalue(theta3,h3);
+    x[k] = (k == 0) ? 0.0 : x[k] / lambda;
+  }
+
+  EnzoSolverFft::fft_1d (x.data(),n,+1,work.data());
+
+  // phi = -cos(k1 x)/k1^2 - sin(k3 x)/k3^2
+
+  double error = 0.0;
+  for (int i=0; i<n; i++) {
+    const double xc = (i + 0.5)*h;
+    const double phi = -cos(k1*xc)/(k1*k1) - sin(k3*xc)/(k3*k3);
+    error = std::max(error,std::abs(x[i]/(1.0*n) - phi));
+  }
+  return error;
+}
+
+//----------------------------------------------------------------------
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class ("EnzoSolverFft");
+
+  //--------------------------------------------------
+
+  unit_func ("fft_1d()");
+
+  // powers of two, small primes, mixed radix, and a large prime
+
+  const int n_list[] = { 1, 2, 3, 4, 5, 6, 7, 8, 12, 30, 64, 90, 97 };
+  const int num_n = sizeof(n_list)/sizeof(n_list[0]);
+
+  for (int i=0; i<num_n; i++) {
+    const int n = n_list[i];
+    unit_assert (fft_error (n,-1) < 1e-10*n);
+    unit_assert (fft_error (n,+1) < 1e-10*n);
+  }
+
+  //--------------------------------------------------
+
+  unit_class ("EnzoMatrixLaplace");
+
+  unit_func ("eigenvalue()");
+
+  // eigenvalues equal the symbol of the stencil used by matvec()
+
+  const double c2[] = { 1.0, -2.0, 1.0 };
+  const double c4[] = { -1.0/12, 16.0/12, -30.0/12, 16.0/12, -1.0/12 };
+  const double c6[] = { 1.0/1080, -96.0/1080, 1455.0/1080, -2720.0/1080,
+			1455.0/1080, -96.0/1080, 1.0/1080 };
+  const double * stencil[3] = { c2, c4, c6 };
+
+  const double h = 0.125;
+  const double h3[3] = { h, 1.0, 1.0 };
+
+  for (int io=0; io<3; io++) {
+    const int order = 2*(io + 1);
+    EnzoMatrixLaplace matrix (order);
+    bool ok = true;
+    for (int k=0; k<16; k++) {
+      const double theta = 2.0*cello::pi*k/16;
+      const double theta3[3] = { theta, 0.0, 0.0 };
+      double symbol = 0.0;
+      for (int j=-order/2; j<=order/2; j++) {
+	symbol += stencil[io][j+order/2] * cos(j*theta);
+      }
+      symbol /= h*h;
+      if (std::abs(matrix.eigenvalue(theta3,h3) - symbol) >
+	  1e-10*std::abs(symbol) + 1e-10) ok = false;
+    }
+    unit_assert (ok);
+  }
+
+  //--------------------------------------------------
+
+  unit_func ("Poisson");
+
+  // error decreases at the accuracy of the operator; the leading
+  // error term of the order 6 stencil is fourth order
+
+  const int accuracy[3] = { 2, 4, 4 };
+
+  for (int io=0; io<3; io++) {
+    const int order = 2*(io + 1);
+    const double e1 = poisson_error (32,order);
+    const double e2 = poisson_error (64,order);
+    const double rate = log(e1/e2)/log(2.0);
+    CkPrintf ("order %d errors %g %g rate %g\n",order,e1,e2,rate);
+    unit_assert (e2 < e1);
+    unit_assert (rate > accuracy[io] - 0.2);
+  }
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
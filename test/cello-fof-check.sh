@@ -0,0 +1,47 @@
+#!/bin/bash
+#
+# usage: cello-fof-check.sh <catalog> <tolerance> <count> <x> <y> ...
+#
+# Check a "fof" halo catalog against the expected halos, given in
+# order of decreasing mass as (count, x, y) triples.  Results are
+# written in unit test format so they are counted by build.sh
+
+catalog=$1
+tolerance=$2
+shift 2
+
+echo "UNIT TEST BEGIN"
+
+result () {
+    if [ $1 == 0 ]; then
+	echo " pass  0/1 $catalog $2 EnzoMethodFof $3"
+    else
+	echo " FAIL  0/1 $catalog $2 EnzoMethodFof $3"
+    fi
+}
+
+if [ ! -e "$catalog" ]; then
+    result 1 0 "catalog"
+    echo "UNIT TEST END"
+    exit
+fi
+
+num_expect=$(( $# / 3 ))
+num_halos=`awk 'NR==1 {print $7}' $catalog`
+
+[ "$num_halos" == "$num_expect" ]
+result $? 1 "halos"
+
+k=0
+while [ $# -ge 3 ]; do
+    line=$(( k + 3 ))
+    awk -v n=$1 -v x=$2 -v y=$3 -v t=$tolerance -v l=$line '
+      function abs(a) { return (a < 0) ? -a : a }
+      NR == l { found = 1; ok = ($2 == n && abs($4-x) < t && abs($5-y) < t) }
+      END { exit (found && ok) ? 0 : 1 }' $catalog
+    result $? $line "halo $k"
+    k=$(( k + 1 ))
+    shift 3
+done
+
+echo "UNIT TEST END"
@@ -0,0 +1,24 @@
+#!/bin/bash
+#
+# usage: cello-image-parts-check.sh <prefix>
+#
+# Check that each image product written by the "parts" file set in
+# input/output-image-parts.incl is identical to the image of the same
+# field written by its own single-product file set.  Results are
+# written in unit test format so they are counted by build.sh
+
+prefix=$1
+
+echo "UNIT TEST BEGIN"
+
+for field in density radius; do
+    single=$prefix-$field-000000.raw
+    part=$prefix-000000-$field-z-sum.raw
+    if [ -e "$single" ] && [ -e "$part" ] && cmp -s $single $part; then
+	echo " pass  0/1 $part 0 OutputImage $field"
+    else
+	echo " FAIL  0/1 $part 0 OutputImage $field"
+    fi
+done
+
+echo "UNIT TEST END"
@@ -0,0 +1,84 @@
+#!/bin/bash
+#
+# usage: cello-profile-check.sh <profile>
+#
+# Check a "profile" method output file for the problem in
+# input/profile.incl against its analytic initial conditions: density
+# is 2 inside radius 0.25 of the domain center and 1 outside it, and
+# the "radius" field is the distance of the cell center from the
+# domain center, on a 32 x 32 unit square.  Results are written in
+# unit test format so they are counted by build.sh
+
+profile=$1
+
+echo "UNIT TEST BEGIN"
+
+if [ ! -e "$profile" ]; then
+    echo " FAIL  0/1 $profile 0 EnzoMethodProfile file"
+    echo "UNIT TEST END"
+    exit
+fi
+
+awk -v file=$profile '
+  function abs(a) { return (a < 0) ? -a : a }
+  function close_to(a,b,t) { return abs(a-b) <= t*abs(b) }
+  function result(ok,name) {
+    printf ("%s 0/1 %s %d EnzoMethodProfile %s\n",
+            ok ? " pass " : " FAIL ", file, NR, name)
+  }
+
+  BEGIN { h = 1.0/32; pi = 3.14159265358979; section = "" }
+
+  # field extrema: radius ranges from the cells nearest the center
+  # to the corner cells
+
+  $2 == "field" && $3 == "density" {
+    result($5 == 1.0 && $7 == 2.0, "density extrema")
+  }
+  $2 == "field" && $3 == "radius" {
+    result(close_to($5,sqrt(2.0)*0.5*h,1e-5) &&
+           close_to($7,sqrt(2.0)*(0.5-0.5*h),1e-5), "radius extrema")
+  }
+
+  $2 == "radial"    { section = "radial";    next }
+  $2 == "histogram" { section = $3;          ih = 0; next }
+  /^#/ || NF == 0   { next }
+
+  # radial bins: average radius lies within the bin, density is
+  # constant within each bin, and mass is density times volume
+
+  section == "radial" {
+    r_min = $1; r_max = $2; volume = $3; mass = $4
+    dv = $5; rv = $6; dm = $7; rm = $8
+    d = (r_max <= 0.25) ? 2.0 : 1.0
+    result(r_min - 1e-6 <= rv && rv <= r_max + 1e-6 &&
+           r_min - 1e-6 <= rm && rm <= r_max + 1e-6, "radial radius")
+    result(close_to(dv,d,1e-6) && close_to(dm,d,1e-6), "radial density")
+    result(close_to(mass,d*volume,1e-6), "radial mass")
+    volume_total += volume
+    if (r_max <= 0.25) volume_inner += volume
+    ++num_radial
+  }
+
+  # histograms: density bins [0.5,1.5] and [1.5,2.5], radius bins
+  # [0,0.5] and [0.5,1]; first and last rows are out of range
+
+  section == "density" { density_volume[ih++] = $3 }
+  section == "radius"  { radius_volume[ih++]  = $3 }
+
+  END {
+    NR = 0
+    result(num_radial == 8, "radial bins")
+    result(close_to(volume_total,pi/4,0.02),  "radial volume")
+    result(close_to(volume_inner,pi/16,0.05), "radial inner volume")
+    result(density_volume[0] == 0 && density_volume[3] == 0 &&
+           close_to(density_volume[1] + density_volume[2],1.0,1e-6) &&
+           close_to(density_volume[2],volume_inner,1e-6),
+           "histogram density")
+    result(radius_volume[0] == 0 && radius_volume[3] == 0 &&
+           close_to(radius_volume[1],volume_total,1e-6) &&
+           close_to(radius_volume[1] + radius_volume[2],1.0,1e-6),
+           "histogram radius")
+  }' $profile
+
+echo "UNIT TEST END"
@@ -0,0 +1,20 @@
+#!/bin/bash
+#
+# usage: cello-raw-compare.sh <image> <image_reference>
+#
+# Check that a raw image file is identical to a reference image file
+# written by a different run of the same problem.  Results are written
+# in unit test format so they are counted by build.sh
+
+image=$1
+reference=$2
+
+echo "UNIT TEST BEGIN"
+
+if [ -e "$image" ] && [ -e "$reference" ] && cmp -s $image $reference; then
+    echo " pass  0/1 $image 0 OutputImage compare"
+else
+    echo " FAIL  0/1 $image 0 OutputImage compare"
+fi
+
+echo "UNIT TEST END"
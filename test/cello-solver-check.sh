@@ -0,0 +1,49 @@
+#!/bin/bash
+#
+# usage: cello-solver-check.sh <output> <solver> <iter_max> <res_tol>
+#
+# Check that every solve of the named Solver in an Enzo-E output file
+# converged: the last monitor line of each solve must report fewer
+# than iter_max iterations and a residual ratio below res_tol.
+# Results are written in unit test format so they are counted by
+# build.sh
+
+output=$1
+solver=$2
+iter_max=$3
+res_tol=$4
+
+# read all Solver lines before writing, since output may be the file
+# being appended to
+
+results=`awk -v file=$output -v solver=$solver \
+             -v iter_max=$iter_max -v res_tol=$res_tol '
+
+  function result(ok,line,name) {
+    printf ("%s 0/1 %s %d %s %s\n",
+            ok ? " pass " : " FAIL ", file, line, solver, name)
+  }
+  function solve_end() {
+    if (num_solves > 0) {
+      result(iter < iter_max + 0 && err < res_tol + 0, line, "converged")
+    }
+  }
+
+  $3 == "Solver" && $4 == solver {
+    for (i=5; i<NF; i++) {
+      if ($i == "iter") iter_line = $(i+1) + 0
+      if ($i == "err")  err_line  = $(i+1) + 0
+    }
+    # iteration 0 starts a new solve
+    if (iter_line == 0) { solve_end(); ++num_solves }
+    iter = iter_line; err = err_line; line = NR
+  }
+
+  END {
+    solve_end()
+    result(num_solves > 0, 0, "solves")
+  }' $output`
+
+echo "UNIT TEST BEGIN"
+echo "$results"
+echo "UNIT TEST END"
@@ -724,8 +724,8 @@ test_summary("Field",
 	     array(     "Field",      "FieldData",     "FieldDescr",     "FieldFace",     "ItIndex",      "Grouping"),
 	     array("test_Field", "test_FieldData","test_FieldDescr","test_FieldFace","test_ItIndex", "test_Grouping"),
 	     'test'); 
-test_summary("Memory",array("Memory"),
-	     array("test_Memory"),'test'); 
+test_summary("Memory",array("Memory","Scratch"),
+	     array("test_Memory","test_Scratch"),'test'); 
 test_summary("Mesh",
 	     array("Data",
 		   "Face",
@@ -762,8 +762,8 @@ test_summary("Performance",array("Papi", "Performance","Timer"),
 	     array("test_Papi","test_Performance","test_Timer"),'test'); 
 test_summary("Problem",array("Mask","Refresh","Value"),
 	     array("test_Mask","test_Refresh","test_Value"),'test'); 
-test_summary("Prolong",array("prolong_linear"),
-	     array("test_ProlongLinear"),'test'); 
+test_summary("Prolong",array("prolong_linear","prolong_restrict"),
+	     array("test_ProlongLinear","test_ProlongRestrict"),'test'); 
 test_summary("Schedule",array("Schedule"),
 	     array("test_Schedule"),'test'); 
 test_summary("Sync",array("Sync"),
@@ -2218,6 +2218,7 @@ test_group("Memory");
 
 begin_hidden("memory", "Memory");
 tests("Cello","test_Memory","test_Memory","","");
+tests("Cello","test_Scratch","test_Scratch","","");
 end_hidden("memory");
 
 
@@ -2340,6 +2341,7 @@ test_group("Prolong");
 
 begin_hidden("prolong", "ProlongLinear");
 tests("Cello","test_ProlongLinear",  "test_prolong_linear","ProlongLinear","");
+tests("Cello","test_ProlongRestrict",  "test_prolong_restrict","ProlongRestrict","");
 end_hidden("Prolong");
 
 //----------------------------------------------------------------------
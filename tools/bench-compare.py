@@ -0,0 +1,81 @@
+#!/usr/bin/python
+#
+# Compare benchmark results against a saved baseline
+#
+# usage: bench-compare.py [--threshold=T] <baseline> <current>
+#
+#   baseline, current  JSON files written by bench_* programs, or
+#                      directories containing them
+#   --threshold=T      relative slowdown in ns/element flagged as a
+#                      regression (default 0.10)
+#
+# Prints the ratio current / baseline time for each kernel present in
+# both, and exits with status 1 if any kernel slowed down by more than
+# the threshold.
+
+from __future__ import print_function
+
+import glob
+import json
+import os
+import sys
+
+def load(path):
+    """Return dictionary of kernel name -> ns per element"""
+    if os.path.isdir(path):
+        files = sorted(glob.glob(os.path.join(path,'*.json')))
+    else:
+        files = [path]
+    results = {}
+    for file_name in files:
+        with open(file_name) as fp:
+            data = json.load(fp)
+        for result in data['results']:
+            key = data['program'] + ' ' + result['name']
+            results[key] = result['ns_per_element']
+    return results
+
+def main(argv):
+    threshold = 0.10
+    args = []
+    for arg in argv:
+        if arg.startswith('--threshold='):
+            threshold = float(arg.split('=',1)[1])
+        else:
+            args.append(arg)
+
+    if len(args) != 2:
+        print('usage: bench-compare.py [--threshold=T] <baseline> <current>')
+        return 2
+
+    baseline = load(args[0])
+    current  = load(args[1])
+
+    num_slower = 0
+    print('%-64s %12s %12s %8s' % ('kernel','base ns/el','new ns/el','ratio'))
+    for key in sorted(current):
+        if key not in baseline:
+            print('%-64s %12s %12.4g %8s' % (key,'-',current[key],'new'))
+            continue
+        base = baseline[key]
+        ratio = current[key] / base if base > 0.0 else 1.0
+        flag = ''
+        if ratio > 1.0 + threshold:
+            flag = ' SLOWER'
+            num_slower += 1
+        elif ratio < 1.0 - threshold:
+            flag = ' faster'
+        print('%-64s %12.4g %12.4g %8.3f%s' % (key,base,current[key],ratio,flag))
+
+    for key in sorted(baseline):
+        if key not in current:
+            print('%-64s %12.4g %12s %8s' % (key,baseline[key],'-','missing'))
+
+    if num_slower > 0:
+        print('%d kernel(s) slower than baseline by more than %g%%' %
+              (num_slower,100.0*threshold))
+        return 1
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,44 @@
+#!/bin/bash
+#
+# Run all benchmark programs bin/bench_* and save their JSON results
+#
+# usage: tools/bench.sh [output-dir] [baseline-dir]
+#
+#   output-dir    directory for <program>.json results (default bench)
+#   baseline-dir  if given, compare results against this directory
+#                 using tools/bench-compare.py
+#
+# Environment variables
+#
+#   CELLO_BENCH_TIME  minimum time in seconds spent per kernel
+
+dir_tools=`dirname $0`
+
+out=${1:-bench}
+baseline=$2
+
+mkdir -p $out
+
+export CELLO_BENCH_DIR=`cd $out; pwd`
+
+status=0
+
+for bench in bin/bench_*; do
+   if [ -x $bench ]; then
+      name=`basename $bench`
+      path=`pwd`/$bench
+      printf "%-32s" $name
+      if (cd $out; $path > $name.out 2>&1); then
+         echo "done"
+      else
+         echo "FAIL (see $out/$name.out)"
+         status=1
+      fi
+   fi
+done
+
+if [ "x$baseline" != "x" ]; then
+   python $dir_tools/bench-compare.py $baseline $out || status=1
+fi
+
+exit $status